@@ -6,6 +6,8 @@
 
 #include "SSVoiceCulture.h"
 
+#include "SSVoiceCultureSyncLoadTracker.h"
+
 #define LOCTEXT_NAMESPACE "SSVoiceCulture"
 
 void FSSVoiceCultureModule::StartupModule()
@@ -14,6 +16,8 @@ void FSSVoiceCultureModule::StartupModule()
 
 void FSSVoiceCultureModule::ShutdownModule()
 {
+	// End of session: keep the sync load offenders of this run (QA playthroughs)
+	FSSVoiceCultureSyncLoadTracker::WriteSessionCsv();
 }
 
 #undef LOCTEXT_NAMESPACE
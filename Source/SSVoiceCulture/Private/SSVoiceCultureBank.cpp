@@ -0,0 +1,51 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "SSVoiceCultureBank.h"
+
+int32 USSVoiceCultureBank::FindLineIndex(FName LineId, int32 HintIndex) const
+{
+	// The index stored by the redirected voice asset, unless the bank was rebuilt since
+	if (LineIds.IsValidIndex(HintIndex) && LineIds[HintIndex] == LineId)
+		return HintIndex;
+
+	return LineIds.IndexOfByKey(LineId);
+}
+
+const FSSVoiceCultureBankCulture* USSVoiceCultureBank::FindCulture(const FString& CultureCode) const
+{
+	const FName CultureName(*CultureCode, FNAME_Find);
+	if (CultureName.IsNone())
+		return nullptr;
+
+	return Cultures.FindByPredicate([CultureName](const FSSVoiceCultureBankCulture& Culture)
+	{
+		return Culture.Culture == CultureName;
+	});
+}
+
+USoundBase* USSVoiceCultureBank::GetLoadedSound(int32 LineIndex, const FString& CultureCode) const
+{
+	const FSSVoiceCultureBankCulture* Culture = FindCulture(CultureCode);
+	if (!Culture)
+		return nullptr;
+
+	const USSVoiceCultureBankChunk* Chunk = Culture->Chunk.Get();
+	if (!Chunk || !Chunk->Sounds.IsValidIndex(LineIndex))
+		return nullptr;
+
+	return Chunk->Sounds[LineIndex];
+}
+
+#if WITH_EDITOR
+FSoftObjectPath USSVoiceCultureBank::GetChunkPath(const FSoftObjectPath& BankPath, const FString& CultureCode)
+{
+	const FString ChunkName = FString::Printf(TEXT("%s_%s"), *BankPath.GetAssetName(), *CultureCode.ToLower());
+	const FString ChunkPackageName = FPackageName::GetLongPackagePath(BankPath.GetLongPackageName()) / ChunkName;
+	return FSoftObjectPath(ChunkPackageName + TEXT(".") + ChunkName);
+}
+#endif
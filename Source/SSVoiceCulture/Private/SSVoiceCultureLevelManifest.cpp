@@ -0,0 +1,62 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "SSVoiceCultureLevelManifest.h"
+
+#include "Algo/BinarySearch.h"
+
+namespace
+{
+	struct FLevelPackageLess
+	{
+		bool operator()(const FSSVoiceCultureManifestLevel& A, const FSSVoiceCultureManifestLevel& B) const
+		{
+			return A.PackageName.LexicalLess(B.PackageName);
+		}
+	};
+}
+
+const FSSVoiceCultureManifestLevel* USSVoiceCultureLevelManifest::FindLevel(FName LevelPackageName) const
+{
+	FSSVoiceCultureManifestLevel Key;
+	Key.PackageName = LevelPackageName;
+
+	const int32 Index = Algo::BinarySearch(Levels, Key, FLevelPackageLess());
+	return Index != INDEX_NONE ? &Levels[Index] : nullptr;
+}
+
+bool USSVoiceCultureLevelManifest::GetLevelSounds(FName LevelPackageName, const FString& CultureCode,
+                                                  TArray<FSoftObjectPath>& OutSounds) const
+{
+	const FSSVoiceCultureManifestLevel* Level = FindLevel(LevelPackageName);
+	if (!Level)
+		return false;
+
+	for (const FSSVoiceCultureManifestCulture& Culture : Level->Cultures)
+	{
+		if (!Culture.Culture.Equals(CultureCode, ESearchCase::IgnoreCase))
+			continue;
+
+		OutSounds.Reserve(OutSounds.Num() + Culture.SoundIndices.Num());
+		for (const int32 SoundIndex : Culture.SoundIndices)
+		{
+			if (Sounds.IsValidIndex(SoundIndex))
+			{
+				OutSounds.Add(Sounds[SoundIndex]);
+			}
+		}
+		return Culture.SoundIndices.Num() > 0;
+	}
+	return false;
+}
+
+#if WITH_EDITOR
+void USSVoiceCultureLevelManifest::SortLevels()
+{
+	Levels.Sort(FLevelPackageLess());
+}
+#endif
@@ -7,13 +7,19 @@
 
 #include "SSVoiceCultureSound.h"
 
+#include "SSVoiceCultureBank.h"
 #include "SSVoiceCultureLog.h"
 #include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureStats.h"
 #include "SSVoiceCultureSubsystem.h"
+#include "SSVoiceCultureSyncLoadTracker.h"
+#include "SSVoiceCultureTable.h"
 #include "Sound/SoundWave.h"
+#include "AssetRegistry/IAssetRegistry.h"
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "UObject/AssetRegistryTagsContext.h"
+#include "UObject/ObjectSaveContext.h"
 
 USSVoiceCultureSound::USSVoiceCultureSound()
 {
@@ -21,25 +27,50 @@ USSVoiceCultureSound::USSVoiceCultureSound()
 
 USoundBase* USSVoiceCultureSound::ResolveSoftSound(const TSoftObjectPtr<USoundBase>& SoftSound, const FString& CultureCode) const
 {
-	if (SoftSound.IsNull())
+	return ResolveSoundPath(SoftSound.ToSoftObjectPath(), CultureCode);
+}
+
+USoundBase* USSVoiceCultureSound::ResolveSoundPath(const FSoftObjectPath& SoundPath, const FString& CultureCode) const
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_Resolve, "VoiceCulture::ResolveSoftSound");
+
+	if (SoundPath.IsNull())
 	{
 		return nullptr;
 	}
 
 	// Asset already loaded - return it directly, no cost
-	if (SoftSound.IsValid())
+	if (USoundBase* Sound = Cast<USoundBase>(SoundPath.ResolveObject()))
 	{
-		return SoftSound.Get();
+		FSSVoiceCultureStats::NotifyCacheHit();
+
+		// Loaded by someone else (level streaming, game streamables...), count it as resident all the same
+		FSSVoiceCultureStats::TrackResidentSound(CultureCode, Sound);
+		return Sound;
 	}
 
+	FSSVoiceCultureStats::NotifyCacheMiss();
+
 	// Asset not loaded yet - synchronous load with a verbose log so it's trackable
 	UE_LOG(LogVoiceCulture, Verbose,
 		TEXT("%s : Sound for culture [%s] is not loaded. Triggering synchronous load of [%s]."),
 		*GetNameSafe(this),
 		*CultureCode,
-		*SoftSound.ToSoftObjectPath().ToString());
+		*SoundPath.ToString());
 
-	USoundBase* Loaded =  SoftSound.LoadSynchronous();
+	USoundBase* Loaded = nullptr;
+	{
+		// Named after culture and asset so the hitch is readable in Insights
+		SS_VOICECULTURE_SCOPE_TEXT(STAT_VoiceCulture_SyncLoad,
+		                           *FString::Printf(TEXT("VoiceCulture::SyncLoad [%s] %s"), *CultureCode,
+		                                            *SoundPath.GetAssetName()));
+		FSSVoiceCultureStats::NotifySyncLoad();
+
+		const double StartTime = FPlatformTime::Seconds();
+		Loaded = Cast<USoundBase>(SoundPath.TryLoad());
+		FSSVoiceCultureSyncLoadTracker::Record(this, CultureCode, SoundPath, FPlatformTime::Seconds() - StartTime);
+	}
+	FSSVoiceCultureStats::TrackResidentSound(CultureCode, Loaded);
 
 	if (!Loaded)
 	{
@@ -47,20 +78,119 @@ USoundBase* USSVoiceCultureSound::ResolveSoftSound(const TSoftObjectPtr<USoundBa
 			TEXT("%s : Synchronous load failed for culture [%s] asset [%s]."),
 			*GetNameSafe(this),
 			*CultureCode,
-			*SoftSound.ToSoftObjectPath().ToString());
+			*SoundPath.ToString());
 	}
 
 	return Loaded;
 }
 
-USoundBase* USSVoiceCultureSound::GetSoundForCulture(const FString& CultureCode) const
+TOptional<FSoftObjectPath> USSVoiceCultureSound::FindCultureSoundPath(const FString& CultureCode) const
 {
-	for (const auto& Entry : VoiceCultures)
+	if (CookedCultureSounds.Num() > 0)
+	{
+		// Names compare case-insensitively; a culture never interned can't be in the table
+		const FName CultureName(*CultureCode, FNAME_Find);
+		if (CultureName.IsNone())
+			return {};
+
+		for (const FSSCookedCultureSound& Entry : CookedCultureSounds)
+		{
+			if (Entry.Culture == CultureName)
+				return Entry.Sound;
+		}
+		return {};
+	}
+
+	for (const FSSCultureAudioEntry& Entry : VoiceCultures)
 	{
 		if (Entry.Culture.Equals(CultureCode, ESearchCase::IgnoreCase))
+			return Entry.Sound.ToSoftObjectPath();
+	}
+
+	if (!Table.IsNull() && VoiceCultures.Num() == 0)
+		return FindTableSoundPath(CultureCode);
+
+	return {};
+}
+
+TOptional<FSoftObjectPath> USSVoiceCultureSound::FindTableSoundPath(const FString& CultureCode) const
+{
+	auto* Subsystem = GEngine ? GEngine->GetEngineSubsystem<USSVoiceCultureSubsystem>() : nullptr;
+	if (!Subsystem)
+		return {};
+
+	// Pinned column: the only lookup allowed off the game thread, where nothing may be loaded or pinned
+	TOptional<FSoftObjectPath> SoundPath = Subsystem->FindActiveTableSound(Table.ToSoftObjectPath(), GetTableLineId(), CultureCode);
+	if (SoundPath.IsSet())
+		return SoundPath;
+
+	if (!IsInGameThread())
+	{
+		UE_LOG(LogVoiceCulture, Verbose, TEXT("%s : Table column for culture [%s] is not pinned, resolve the line on the game thread first."),
+			*GetNameSafe(this),
+			*CultureCode);
+		return {};
+	}
+
+	const USSVoiceCultureTable* LoadedTable = Table.LoadSynchronous();
+	if (!LoadedTable)
+		return {};
+
+	const int32 LineIndex = LoadedTable->FindLineIndex(GetTableLineId());
+	if (LineIndex == INDEX_NONE)
+		return {};
+
+	const USSVoiceCultureTableColumn* Column = Subsystem->GetTableColumn(*LoadedTable, CultureCode);
+	if (!Column || !Column->Sounds.IsValidIndex(LineIndex))
+		return {};
+
+	return Column->Sounds[LineIndex].ToSoftObjectPath();
+}
+
+TArray<FString> USSVoiceCultureSound::GetAvailableCultures() const
+{
+	TArray<FString> Cultures;
+	ForEachCultureSound([&Cultures](FName Culture, const FSoftObjectPath&)
+	{
+		Cultures.Add(Culture.ToString());
+	});
+
+	// Migrated line: the table's cultures, without loading the table or any column
+	if (Cultures.Num() == 0 && !Table.IsNull())
+	{
+		if (const USSVoiceCultureTable* LoadedTable = Table.Get())
 		{
-			return ResolveSoftSound(Entry.Sound, CultureCode);
+			for (const FSSVoiceCultureTableCulture& TableCulture : LoadedTable->Cultures)
+			{
+				Cultures.Add(TableCulture.Culture.ToString());
+			}
 		}
+		else
+		{
+			Cultures = GetTableCulturesFromRegistry();
+		}
+	}
+	return Cultures;
+}
+
+TArray<FString> USSVoiceCultureSound::GetTableCulturesFromRegistry() const
+{
+	TArray<FString> Cultures;
+
+	FString CultureCSV;
+	const IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	if (AssetRegistry && AssetRegistry->GetAssetByObjectPath(Table.ToSoftObjectPath()).GetTagValue("VoiceCultures", CultureCSV))
+	{
+		CultureCSV.ParseIntoArray(Cultures, TEXT(","));
+	}
+	return Cultures;
+}
+
+USoundBase* USSVoiceCultureSound::GetSoundForCulture(const FString& CultureCode) const
+{
+	if (const TOptional<FSoftObjectPath> SoundPath = FindCultureSoundPath(CultureCode))
+	{
+		return ResolveSoundPath(SoundPath.GetValue(), CultureCode);
 	}
 	
 	UE_LOG(LogVoiceCulture, Error, TEXT("%s : Can't found valid CultureSound from given language [%s]"), *GetNameSafe(this), *CultureCode);
@@ -70,15 +200,36 @@ USoundBase* USSVoiceCultureSound::GetSoundForCulture(const FString& CultureCode)
 
 bool USSVoiceCultureSound::HaveValidSoundForCulture(const FString& CultureCode) const
 {
-	for (const auto& Entry : VoiceCultures)
+	// Only check that the soft reference points to something - do not trigger a load
+	if (Table.IsNull() || CookedCultureSounds.Num() > 0 || VoiceCultures.Num() > 0)
 	{
-		if (Entry.Culture.Equals(CultureCode, ESearchCase::IgnoreCase))
+		const TOptional<FSoftObjectPath> SoundPath = FindCultureSoundPath(CultureCode);
+		return SoundPath.IsSet() && !SoundPath->IsNull();
+	}
+
+	// Migrated line: the pinned column, else what is loaded of the table, else its registry entry
+	auto* Subsystem = GEngine ? GEngine->GetEngineSubsystem<USSVoiceCultureSubsystem>() : nullptr;
+	const TOptional<FSoftObjectPath> SoundPath = Subsystem ? Subsystem->FindActiveTableSound(Table.ToSoftObjectPath(), GetTableLineId(), CultureCode) : TOptional<FSoftObjectPath>();
+	if (SoundPath.IsSet())
+		return !SoundPath->IsNull();
+
+	const USSVoiceCultureTable* LoadedTable = Table.Get();
+	if (!LoadedTable)
+	{
+		return GetTableCulturesFromRegistry().ContainsByPredicate([&CultureCode](const FString& Culture)
 		{
-			// Only check that the soft reference points to something - do not trigger a load
-			return !Entry.Sound.IsNull();
-		}
+			return Culture.Equals(CultureCode, ESearchCase::IgnoreCase);
+		});
 	}
-	return false; // No matching culture entry found
+
+	const FSSVoiceCultureTableCulture* TableCulture = LoadedTable->FindCulture(CultureCode);
+	const int32 LineIndex = LoadedTable->FindLineIndex(GetTableLineId());
+	if (!TableCulture || TableCulture->Column.IsNull() || LineIndex == INDEX_NONE)
+		return false;
+
+	// Column not loaded: the line is assumed recorded in every culture of the table
+	const USSVoiceCultureTableColumn* Column = TableCulture->Column.Get();
+	return !Column || (Column->Sounds.IsValidIndex(LineIndex) && !Column->Sounds[LineIndex].IsNull());
 }
 
 bool USSVoiceCultureSound::IsCurrentCultureValid() const
@@ -106,6 +257,8 @@ USoundBase* USSVoiceCultureSound::GetCurrentCultureSound() const
 #if ENGINE_MAJOR_VERSION >= 5
 float USSVoiceCultureSound::GetDuration() const
 {
+	FSSVoiceCultureSyncLoadTracker::FSiteScope SiteScope(ESSVoiceSyncLoadSite::GetDuration);
+
 	if (USoundBase* Inner = ResolveEffectiveSound())
 	{
 		return Inner->GetDuration();
@@ -116,18 +269,137 @@ float USSVoiceCultureSound::GetDuration() const
 
 bool USSVoiceCultureSound::IsPlayable() const
 {
+	FSSVoiceCultureSyncLoadTracker::FSiteScope SiteScope(ESSVoiceSyncLoadSite::IsPlayable);
+
 	return ResolveEffectiveSound() != nullptr;
 }
 
 void USSVoiceCultureSound::Parse(class FAudioDevice* AudioDevice, const UPTRINT NodeWaveInstanceHash,
 	FActiveSound& ActiveSound, const FSoundParseParameters& ParseParams, TArray<FWaveInstance*>& WaveInstances)
 {
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_Parse, "VoiceCulture::Parse");
+	FSSVoiceCultureSyncLoadTracker::FSiteScope SiteScope(ESSVoiceSyncLoadSite::Parse);
+
 	if (USoundBase* Inner = ResolveEffectiveSound())
 	{
 		Inner->Parse(AudioDevice, NodeWaveInstanceHash, ActiveSound, ParseParams, WaveInstances);
 	}
 }
 
+void USSVoiceCultureSound::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	if (CumulativeResourceSize.GetResourceSizeMode() != EResourceSizeMode::EstimatedTotal)
+		return;
+
+	ForEachCultureSound([&CumulativeResourceSize](FName, const FSoftObjectPath& SoundPath)
+	{
+		// Only what is resident, never trigger a load for accounting
+		if (USoundBase* Sound = Cast<USoundBase>(SoundPath.ResolveObject()))
+		{
+			Sound->GetResourceSizeEx(CumulativeResourceSize);
+		}
+	});
+}
+
+void USSVoiceCultureSound::Serialize(FArchive& Ar)
+{
+#if WITH_EDITORONLY_DATA
+	if (Ar.IsSaving() && Ar.IsCooking())
+	{
+		// Only the packed table built in PreSave goes to the cooked package, the editor object keeps its VoiceCultures
+		TArray<FSSCultureAudioEntry> EditorCultures = MoveTemp(VoiceCultures);
+		VoiceCultures.Reset();
+
+		Super::Serialize(Ar);
+
+		VoiceCultures = MoveTemp(EditorCultures);
+		return;
+	}
+#endif
+
+	Super::Serialize(Ar);
+}
+
+#if WITH_EDITOR
+void USSVoiceCultureSound::PreSave(FObjectPreSaveContext ObjectSaveContext)
+{
+	Super::PreSave(ObjectSaveContext);
+
+	if (!ObjectSaveContext.IsCooking())
+		return;
+
+	// Bank chunks are resolved from the line's own data and the asset registry, the cook must not load the bank
+	IAssetRegistry* AssetRegistry = Bank.IsNull() || BankLineId.IsNone() ? nullptr : IAssetRegistry::Get();
+
+	CookedCultureSounds.Reset(VoiceCultures.Num());
+	for (const FSSCultureAudioEntry& Entry : VoiceCultures)
+	{
+		FSSCookedCultureSound& Cooked = CookedCultureSounds.AddDefaulted_GetRef();
+		Cooked.Culture = FName(*Entry.Culture.ToLower());
+		Cooked.Sound = Entry.Sound.ToSoftObjectPath();
+
+		if (!AssetRegistry || !BankCultures.Contains(Cooked.Culture))
+			continue;
+
+		// Redirected to its bank: point at the chunk copy, loading it brings the whole culture of the bank
+		const FSoftObjectPath ChunkPath = USSVoiceCultureBank::GetChunkPath(Bank.ToSoftObjectPath(), Entry.Culture);
+		if (AssetRegistry->GetAssetByObjectPath(ChunkPath, /*bIncludeOnlyOnDiskAssets*/ true).IsValid())
+		{
+			Cooked.Sound = FSoftObjectPath(ChunkPath.ToString() + SUBOBJECT_DELIMITER + BankLineId.ToString());
+		}
+		else
+		{
+			UE_LOG(LogVoiceCulture, Warning,
+				TEXT("%s : Bank chunk [%s] is missing, cooking culture [%s] from its own sound."),
+				*GetNameSafe(this),
+				*ChunkPath.ToString(),
+				*Entry.Culture);
+		}
+	}
+
+	// Deterministic cook output; stable so the first of duplicated cultures still wins
+	CookedCultureSounds.StableSort([](const FSSCookedCultureSound& A, const FSSCookedCultureSound& B)
+	{
+		return A.Culture.LexicalLess(B.Culture);
+	});
+}
+
+void USSVoiceCultureSound::PostSaveRoot(FObjectPostSaveRootContext ObjectSaveContext)
+{
+	Super::PostSaveRoot(ObjectSaveContext);
+
+	// The editor object resolves from VoiceCultures again
+	CookedCultureSounds.Empty();
+}
+#endif
+
+FString USSVoiceCultureSound::GetEffectiveVoiceCulture()
+{
+	auto* Subsystem = GEngine ? GEngine->GetEngineSubsystem<USSVoiceCultureSubsystem>() : nullptr;
+	if (!Subsystem)
+		return FString();
+
+#if WITH_EDITOR
+	// Same rules as ResolveEffectiveSound
+	if (GIsEditor && GWorld && (!GWorld->IsGameWorld() || USSVoiceCultureSettings::GetSetting()->bUsePreviewLanguageInGame))
+	{
+		return Subsystem->GetEditorPreviewLanguage();
+	}
+#endif
+	return Subsystem->GetCurrentVoiceCulture();
+}
+
+FString USSVoiceCultureSound::GetVoiceActorName() const
+{
+	TArray<FString> Parts;
+	GetName().ParseIntoArray(Parts, TEXT("_"));
+
+	// <Prefix>_<Actor>_<Line...>
+	return Parts.Num() >= 3 ? Parts[1] : FString();
+}
+
 #if WITH_EDITOR
 USoundBase* USSVoiceCultureSound::GetEditorPreviewSound() const
 {
@@ -161,12 +433,89 @@ FString USSVoiceCultureSound::GetVoiceCultureCSV() const
 	return Cultures;
 }
 
+FString USSVoiceCultureSound::GetCultureAnalysisTag() const
+{
+	FString Tag;
+	for (const FSSCultureSoundAnalysis& Analysis : CultureAnalysis)
+	{
+		if (!Tag.IsEmpty())
+		{
+			Tag += TEXT(";");
+		}
+		Tag += FString::Printf(TEXT("%s=%.1f/%.1f/%.3f/%.3f/%.3f"), *Analysis.Culture.ToLower(), Analysis.IntegratedLoudness,
+		                       Analysis.PeakDb, Analysis.LeadingSilence, Analysis.TrailingSilence, Analysis.Duration);
+	}
+	return Tag;
+}
+
+FString USSVoiceCultureSound::GetCultureDurationTag() const
+{
+	const IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+
+	FString Tag;
+	for (const FSSCultureAudioEntry& Entry : VoiceCultures)
+	{
+		if (Entry.Sound.IsNull())
+			continue;
+
+		float Duration = 0.f;
+		if (const FSSCultureSoundAnalysis* Analysis = CultureAnalysis.FindByPredicate(
+			[&Entry](const FSSCultureSoundAnalysis& CultureAnalysisEntry)
+			{
+				return CultureAnalysisEntry.Culture.Equals(Entry.Culture, ESearchCase::IgnoreCase);
+			}))
+		{
+			Duration = Analysis->Duration;
+		}
+		else if (const USoundBase* Sound = Entry.Sound.Get())
+		{
+			Duration = Sound->Duration;
+		}
+		else if (AssetRegistry)
+		{
+			const FAssetData SoundAsset = AssetRegistry->GetAssetByObjectPath(Entry.Sound.ToSoftObjectPath());
+			SoundAsset.GetTagValue(GET_MEMBER_NAME_CHECKED(USoundBase, Duration), Duration);
+		}
+
+		// Unknown or looping
+		if (Duration <= 0.f || Duration >= INDEFINITELY_LOOPING_DURATION)
+			continue;
+
+		if (!Tag.IsEmpty())
+		{
+			Tag += TEXT(",");
+		}
+		Tag += FString::Printf(TEXT("%s=%.3f"), *Entry.Culture.ToLower(), Duration);
+	}
+	return Tag;
+}
+
+FString USSVoiceCultureSound::GetCultureSoundsTag() const
+{
+	FString Tag;
+	for (const FSSCultureAudioEntry& Entry : VoiceCultures)
+	{
+		if (Entry.Sound.IsNull())
+			continue;
+
+		if (!Tag.IsEmpty())
+		{
+			Tag += TEXT(",");
+		}
+		Tag += Entry.Culture.ToLower() + TEXT("=") + Entry.Sound.ToString();
+	}
+	return Tag;
+}
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
 void USSVoiceCultureSound::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
 {
 	Super::GetAssetRegistryTags(Context);
 	
 	Context.AddTag(FAssetRegistryTag("VoiceCultures", GetVoiceCultureCSV(), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag("VoiceLoudness", GetCultureAnalysisTag(), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag("VoiceDurations", GetCultureDurationTag(), FAssetRegistryTag::TT_Hidden));
+	Context.AddTag(FAssetRegistryTag("VoiceCultureSounds", GetCultureSoundsTag(), FAssetRegistryTag::TT_Hidden));
 }
 
 #else
@@ -176,6 +525,9 @@ void USSVoiceCultureSound::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTa
 	Super::GetAssetRegistryTags(OutTags);
 	
 	OutTags.Add(FAssetRegistryTag("VoiceCultures", GetVoiceCultureCSV(), FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(FAssetRegistryTag("VoiceLoudness", GetCultureAnalysisTag(), FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(FAssetRegistryTag("VoiceDurations", GetCultureDurationTag(), FAssetRegistryTag::TT_Hidden));
+	OutTags.Add(FAssetRegistryTag("VoiceCultureSounds", GetCultureSoundsTag(), FAssetRegistryTag::TT_Hidden));
 }
 #endif
 
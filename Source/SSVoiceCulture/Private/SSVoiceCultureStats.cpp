@@ -0,0 +1,281 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "SSVoiceCultureStats.h"
+
+#include "SSVoiceCultureSound.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Sound/SoundBase.h"
+#include "UObject/UObjectIterator.h"
+#include <atomic>
+
+DEFINE_STAT(STAT_VoiceCulture_Resolve);
+DEFINE_STAT(STAT_VoiceCulture_Parse);
+DEFINE_STAT(STAT_VoiceCulture_SyncLoad);
+DEFINE_STAT(STAT_VoiceCulture_AsyncLoadRequest);
+DEFINE_STAT(STAT_VoiceCulture_AsyncLoadComplete);
+DEFINE_STAT(STAT_VoiceCulture_CultureSwitch);
+
+DEFINE_STAT(STAT_VoiceCulture_CacheHits);
+DEFINE_STAT(STAT_VoiceCulture_CacheMisses);
+DEFINE_STAT(STAT_VoiceCulture_SyncLoads);
+DEFINE_STAT(STAT_VoiceCulture_PendingLoads);
+DEFINE_STAT(STAT_VoiceCulture_ResidentBytes);
+
+UE_TRACE_CHANNEL_DEFINE(VoiceCultureChannel);
+
+TRACE_DECLARE_INT_COUNTER(VoiceCulture_CacheHits, TEXT("VoiceCulture/Cache Hits"));
+TRACE_DECLARE_INT_COUNTER(VoiceCulture_CacheMisses, TEXT("VoiceCulture/Cache Misses"));
+TRACE_DECLARE_INT_COUNTER(VoiceCulture_SyncLoads, TEXT("VoiceCulture/Sync Loads"));
+TRACE_DECLARE_INT_COUNTER(VoiceCulture_PendingLoads, TEXT("VoiceCulture/Pending Loads"));
+TRACE_DECLARE_MEMORY_COUNTER(VoiceCulture_ResidentBytes, TEXT("VoiceCulture/Resident Bytes"));
+
+namespace
+{
+	// Totals since startup (trace counters are set from these, they are not atomic themselves)
+	std::atomic<int64> NumCacheHits{0};
+	std::atomic<int64> NumCacheMisses{0};
+	std::atomic<int64> NumSyncLoads{0};
+	std::atomic<int32> NumPendingLoads{0};
+
+	/** Loaded culture sounds per culture, and one Insights counter per culture */
+	struct FCultureResidency
+	{
+		TSet<TWeakObjectPtr<USoundBase>> Sounds;
+		FString CounterName;
+#if COUNTERSTRACE_ENABLED
+		TUniquePtr<FCountersTrace::FCounterInt> Counter;
+#endif
+	};
+
+	FRWLock ResidencyLock;
+	TMap<FString, FCultureResidency> ResidencyByCulture;
+
+	/** Every tracked sound, whatever its culture, so cache hits find it without building a key */
+	TSet<TWeakObjectPtr<USoundBase>> TrackedSounds;
+
+	/** Resident bytes and sound count of one group of the memory report */
+	struct FMemReportBucket
+	{
+		int64 Bytes = 0;
+		int32 NumSounds = 0;
+		int64 WastedBytes = 0;
+
+		void Add(int64 InBytes, bool bWasted)
+		{
+			Bytes += InBytes;
+			WastedBytes += bWasted ? InBytes : 0;
+			NumSounds++;
+		}
+	};
+
+	void LogBuckets(FOutputDevice& Ar, const TCHAR* Title, TMap<FString, FMemReportBucket>& Buckets, int32 MaxRows)
+	{
+		Buckets.ValueSort([](const FMemReportBucket& A, const FMemReportBucket& B) { return A.Bytes > B.Bytes; });
+
+		Ar.Logf(TEXT("%s:"), Title);
+		Ar.Logf(TEXT("%12s %12s %8s  %s"), TEXT("KB"), TEXT("Waste KB"), TEXT("Sounds"), TEXT("Name"));
+
+		int32 Row = 0;
+		for (const TPair<FString, FMemReportBucket>& Pair : Buckets)
+		{
+			if (MaxRows > 0 && Row++ >= MaxRows)
+			{
+				Ar.Logf(TEXT("  ... %d more"), Buckets.Num() - MaxRows);
+				break;
+			}
+			Ar.Logf(TEXT("%12.1f %12.1f %8d  %s"), Pair.Value.Bytes / 1024.0, Pair.Value.WastedBytes / 1024.0,
+			        Pair.Value.NumSounds, *Pair.Key);
+		}
+	}
+
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("VoiceCulture.MemReport"),
+		TEXT("Resident voice memory by culture and voice actor, including loaded sounds of non-current cultures. Optional: max rows (default 20, 0 for all)."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda(
+			[](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+			{
+				FSSVoiceCultureStats::DumpMemReport(Ar, Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 20);
+			}));
+}
+
+void FSSVoiceCultureStats::NotifyCacheHit()
+{
+	INC_DWORD_STAT(STAT_VoiceCulture_CacheHits);
+	// Counted outside the trace macro, which compiles away without COUNTERSTRACE_ENABLED
+	[[maybe_unused]] const int64 Hits = ++NumCacheHits;
+	TRACE_COUNTER_SET(VoiceCulture_CacheHits, Hits);
+}
+
+void FSSVoiceCultureStats::NotifyCacheMiss()
+{
+	INC_DWORD_STAT(STAT_VoiceCulture_CacheMisses);
+	[[maybe_unused]] const int64 Misses = ++NumCacheMisses;
+	TRACE_COUNTER_SET(VoiceCulture_CacheMisses, Misses);
+}
+
+void FSSVoiceCultureStats::NotifySyncLoad()
+{
+	INC_DWORD_STAT(STAT_VoiceCulture_SyncLoads);
+	[[maybe_unused]] const int64 SyncLoads = ++NumSyncLoads;
+	TRACE_COUNTER_SET(VoiceCulture_SyncLoads, SyncLoads);
+}
+
+void FSSVoiceCultureStats::NotifyAsyncLoadRequested(int32 NumSounds)
+{
+	INC_DWORD_STAT_BY(STAT_VoiceCulture_PendingLoads, NumSounds);
+	[[maybe_unused]] const int32 PendingLoads = NumPendingLoads += NumSounds;
+	TRACE_COUNTER_SET(VoiceCulture_PendingLoads, PendingLoads);
+}
+
+void FSSVoiceCultureStats::NotifyAsyncLoadCompleted(int32 NumSounds)
+{
+	DEC_DWORD_STAT_BY(STAT_VoiceCulture_PendingLoads, NumSounds);
+	[[maybe_unused]] const int32 PendingLoads = NumPendingLoads -= NumSounds;
+	TRACE_COUNTER_SET(VoiceCulture_PendingLoads, PendingLoads);
+}
+
+int32 FSSVoiceCultureStats::GetNumPendingLoads()
+{
+	return NumPendingLoads;
+}
+
+int64 FSSVoiceCultureStats::GetNumCacheHits()
+{
+	return NumCacheHits;
+}
+
+int64 FSSVoiceCultureStats::GetNumCacheMisses()
+{
+	return NumCacheMisses;
+}
+
+int64 FSSVoiceCultureStats::GetNumSyncLoads()
+{
+	return NumSyncLoads;
+}
+
+void FSSVoiceCultureStats::TrackResidentSound(const FString& CultureCode, USoundBase* Sound)
+{
+	if (!Sound)
+		return;
+
+	const TWeakObjectPtr<USoundBase> WeakSound(Sound);
+	{
+		// Every resolve lands here, already tracked sounds only take the read lock
+		FReadScopeLock ReadLock(ResidencyLock);
+		if (TrackedSounds.Contains(WeakSound))
+			return;
+	}
+
+	FWriteScopeLock WriteLock(ResidencyLock);
+
+	bool bAlreadyTracked = false;
+	TrackedSounds.Add(WeakSound, &bAlreadyTracked);
+	if (bAlreadyTracked)
+		return;
+
+	FCultureResidency& Residency = ResidencyByCulture.FindOrAdd(CultureCode.ToLower());
+	Residency.Sounds.Add(WeakSound);
+}
+
+void FSSVoiceCultureStats::UpdateResidentBytes()
+{
+	check(IsInGameThread());
+
+	FWriteScopeLock WriteLock(ResidencyLock);
+
+	int64 TotalBytes = 0;
+	for (TPair<FString, FCultureResidency>& Pair : ResidencyByCulture)
+	{
+		FCultureResidency& Residency = Pair.Value;
+
+		int64 CultureBytes = 0;
+		for (auto It = Residency.Sounds.CreateIterator(); It; ++It)
+		{
+			// Unloaded since: stop tracking it
+			USoundBase* Sound = It->Get();
+			if (!Sound)
+			{
+				TrackedSounds.Remove(*It);
+				It.RemoveCurrent();
+				continue;
+			}
+			CultureBytes += Sound->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+		TotalBytes += CultureBytes;
+
+#if COUNTERSTRACE_ENABLED
+		if (!Residency.Counter.IsValid())
+		{
+			Residency.CounterName = FString::Printf(TEXT("VoiceCulture/Resident Bytes/%s"), *Pair.Key);
+			Residency.Counter = MakeUnique<FCountersTrace::FCounterInt>(*Residency.CounterName, TraceCounterDisplayHint_Memory);
+		}
+		Residency.Counter->Set(CultureBytes);
+#endif
+	}
+
+	SET_MEMORY_STAT(STAT_VoiceCulture_ResidentBytes, TotalBytes);
+	TRACE_COUNTER_SET(VoiceCulture_ResidentBytes, TotalBytes);
+}
+
+void FSSVoiceCultureStats::DumpMemReport(FOutputDevice& Ar, int32 MaxRows)
+{
+	check(IsInGameThread());
+
+	const FString CurrentCulture = USSVoiceCultureSound::GetEffectiveVoiceCulture();
+
+	TMap<FString, FMemReportBucket> ByCulture;
+	TMap<FString, FMemReportBucket> ByActor;
+	FMemReportBucket Total;
+	int32 NumWrappers = 0;
+
+	// A culture sound can be shared by several wrappers, count it once (first wrapper found owns it)
+	TSet<const USoundBase*> CountedSounds;
+
+	for (TObjectIterator<USSVoiceCultureSound> It; It; ++It)
+	{
+		const USSVoiceCultureSound* VoiceSound = *It;
+		if (VoiceSound->HasAnyFlags(RF_ClassDefaultObject))
+			continue;
+
+		NumWrappers++;
+
+		FString ActorName = VoiceSound->GetVoiceActorName();
+		if (ActorName.IsEmpty())
+			ActorName = TEXT("(unknown)");
+
+		VoiceSound->ForEachCultureSound([&](FName Culture, const FSoftObjectPath& SoundPath)
+		{
+			USoundBase* Sound = Cast<USoundBase>(SoundPath.ResolveObject());
+			if (!Sound)
+				return;
+
+			bool bAlreadyCounted = false;
+			CountedSounds.Add(Sound, &bAlreadyCounted);
+			if (bAlreadyCounted)
+				return;
+
+			const FString CultureCode = Culture.ToString().ToLower();
+			const int64 Bytes = Sound->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			const bool bWasted = !CultureCode.Equals(CurrentCulture, ESearchCase::IgnoreCase);
+
+			ByCulture.FindOrAdd(CultureCode).Add(Bytes, bWasted);
+			ByActor.FindOrAdd(ActorName).Add(Bytes, bWasted);
+			Total.Add(Bytes, bWasted);
+		});
+	}
+
+	Ar.Logf(TEXT("VoiceCulture memory: %.1f KB in %d culture sound(s) from %d loaded voice asset(s), current culture [%s]"),
+	        Total.Bytes / 1024.0, Total.NumSounds, NumWrappers, *CurrentCulture);
+	Ar.Logf(TEXT("Loaded but not current culture (waste): %.1f KB"), Total.WastedBytes / 1024.0);
+
+	LogBuckets(Ar, TEXT("By culture"), ByCulture, 0);
+	LogBuckets(Ar, TEXT("By voice actor"), ByActor, MaxRows);
+}
@@ -9,19 +9,47 @@
 
 #include "Engine/World.h"
 #include "Engine/Engine.h"
+#include "Engine/LevelStreaming.h"
+#include "Misc/PackageName.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureLevelManifest.h"
 #include "SSVoiceCultureLog.h"
 #include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureSound.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureSyncLoadTracker.h"
+#include "SSVoiceCultureTable.h"
+#include "Components/AudioComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/ScopeRWLock.h"
 
 void USSVoiceCultureSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	OnStartGameInstanceHandle = FWorldDelegates::OnStartGameInstance.AddUObject(this, &USSVoiceCultureSubsystem::HandleStartGameInstance);
+
+	StatsTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USSVoiceCultureSubsystem::TickStats), 1.0f);
+
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &USSVoiceCultureSubsystem::HandlePreLoadMap);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USSVoiceCultureSubsystem::HandlePostLoadMap);
+	LevelStreamingTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USSVoiceCultureSubsystem::TickLevelStreaming), 0.1f);
 }
 
 void USSVoiceCultureSubsystem::Deinitialize()
 {
 	FWorldDelegates::OnStartGameInstance.Remove(OnStartGameInstanceHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(StatsTickerHandle);
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(LevelStreamingTickerHandle);
+
+	ReleasePrefetchedSounds();
+	ReleaseLevelPrefetches();
+	ResetActiveTableColumns();
+	ActiveTables.Reset();
 	
 	Super::Deinitialize();
 }
@@ -38,9 +66,32 @@ void USSVoiceCultureSubsystem::HandleStartGameInstance(UGameInstance* GameInstan
 
 void USSVoiceCultureSubsystem::SetCurrentVoiceCulture(const FString& Language, bool bPersist)
 {
+	SS_VOICECULTURE_SCOPE_TEXT(STAT_VoiceCulture_CultureSwitch,
+	                           *FString::Printf(TEXT("VoiceCulture::CultureSwitch [%s]"), *Language));
+
+	// Sounds prefetched for the previous culture are not needed anymore
+	const bool bCultureChanged = !Language.Equals(CurrentLanguage, ESearchCase::IgnoreCase);
+	if (bCultureChanged)
+	{
+		ReleasePrefetchedSounds();
+		ResetActiveTableColumns();
+	}
+
 	// Store the language in memory (applied immediately for runtime lookups)
 	CurrentLanguage = Language;
 
+	// Lines of the tables in use resolve on the audio thread from pinned columns only, pin the new culture's now
+	if (bCultureChanged)
+	{
+		for (const USSVoiceCultureTable* Table : TArray<TObjectPtr<USSVoiceCultureTable>>(ActiveTables))
+		{
+			if (Table)
+			{
+				GetTableColumn(*Table, CurrentLanguage);
+			}
+		}
+	}
+
 	// Persist the new culture setting into the user config file
 	auto* VoiceCultureSettings = USSVoiceCultureSettings::GetMutableSetting();
 	VoiceCultureSettings->CurrentLanguage = CurrentLanguage;
@@ -64,6 +115,421 @@ TArray<FString> USSVoiceCultureSubsystem::GetSupportedVoiceCultures() const
 	return Settings->SupportedVoiceCultures.Array();
 }
 
+void USSVoiceCultureSubsystem::PrefetchVoiceSounds(const TArray<USSVoiceCultureSound*>& VoiceSounds, const FString& CultureCode)
+{
+	const FString Culture = CultureCode.IsEmpty() ? CurrentLanguage : CultureCode;
+
+	TArray<FSoftObjectPath> SoundPaths;
+	for (const USSVoiceCultureSound* VoiceSound : VoiceSounds)
+	{
+		if (!VoiceSound)
+			continue;
+
+		const TOptional<FSoftObjectPath> SoundPath = VoiceSound->FindCultureSoundPath(Culture);
+
+		// Already loaded sounds need nothing
+		if (SoundPath.IsSet() && !SoundPath->IsNull() && !SoundPath->ResolveObject())
+		{
+			SoundPaths.AddUnique(SoundPath.GetValue());
+		}
+	}
+
+	FPrefetchRequest Request;
+	if (!RequestSoundsAsync(SoundPaths, Culture, Request))
+		return;
+
+	PrefetchRequests.Add(MoveTemp(Request));
+
+	UE_LOG(LogVoiceCulture, Verbose, TEXT("%s : Prefetching %d sound(s) for culture [%s]"), *GetNameSafe(this),
+	       SoundPaths.Num(), *Culture);
+}
+
+void USSVoiceCultureSubsystem::PrefetchVoiceBank(USSVoiceCultureBank* Bank, const FString& CultureCode)
+{
+	if (!Bank)
+		return;
+
+	const FString Culture = CultureCode.IsEmpty() ? CurrentLanguage : CultureCode;
+
+	const FSSVoiceCultureBankCulture* BankCulture = Bank->FindCulture(Culture);
+	if (!BankCulture || BankCulture->Chunk.IsNull())
+	{
+		UE_LOG(LogVoiceCulture, Warning, TEXT("%s : Bank [%s] has no chunk for culture [%s]"), *GetNameSafe(this),
+		       *GetNameSafe(Bank), *Culture);
+		return;
+	}
+
+	FPrefetchRequest Request;
+	if (!RequestSoundsAsync({BankCulture->Chunk.ToSoftObjectPath()}, Culture, Request))
+		return;
+
+	PrefetchRequests.Add(MoveTemp(Request));
+
+	UE_LOG(LogVoiceCulture, Verbose, TEXT("%s : Prefetching bank [%s] for culture [%s]"), *GetNameSafe(this),
+	       *GetNameSafe(Bank), *Culture);
+}
+
+void USSVoiceCultureSubsystem::PrefetchVoiceTable(USSVoiceCultureTable* Table, const FString& CultureCode)
+{
+	if (!Table)
+		return;
+
+	const FString Culture = CultureCode.IsEmpty() ? CurrentLanguage : CultureCode;
+
+	const FSSVoiceCultureTableCulture* TableCulture = Table->FindCulture(Culture);
+	if (!TableCulture || TableCulture->Column.IsNull())
+	{
+		UE_LOG(LogVoiceCulture, Warning, TEXT("%s : Table [%s] has no column for culture [%s]"), *GetNameSafe(this),
+		       *GetNameSafe(Table), *Culture);
+		return;
+	}
+
+	// Already loaded, ResolveVoiceLine finds it
+	if (TableCulture->Column.Get())
+		return;
+
+	FPrefetchRequest Request;
+	if (!RequestSoundsAsync({TableCulture->Column.ToSoftObjectPath()}, Culture, Request))
+		return;
+
+	PrefetchRequests.Add(MoveTemp(Request));
+
+	UE_LOG(LogVoiceCulture, Verbose, TEXT("%s : Prefetching table [%s] for culture [%s]"), *GetNameSafe(this),
+	       *GetNameSafe(Table), *Culture);
+}
+
+USoundBase* USSVoiceCultureSubsystem::ResolveVoiceLine(const USSVoiceCultureTable* Table, FName LineId)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_Resolve, "VoiceCulture::ResolveVoiceLine");
+
+	if (!Table)
+		return nullptr;
+
+	const int32 LineIndex = Table->FindLineIndex(LineId);
+	if (LineIndex == INDEX_NONE)
+	{
+		UE_LOG(LogVoiceCulture, Error, TEXT("%s : Table [%s] has no line [%s]"), *GetNameSafe(this), *GetNameSafe(Table),
+		       *LineId.ToString());
+		return nullptr;
+	}
+
+	const FString Culture = USSVoiceCultureSound::GetEffectiveVoiceCulture();
+	const USSVoiceCultureTableColumn* Column = GetTableColumn(*Table, Culture);
+	if (!Column || !Column->Sounds.IsValidIndex(LineIndex) || Column->Sounds[LineIndex].IsNull())
+	{
+		UE_LOG(LogVoiceCulture, Error, TEXT("%s : Line [%s] of table [%s] has no sound for culture [%s]"),
+		       *GetNameSafe(this), *LineId.ToString(), *GetNameSafe(Table), *Culture);
+		return nullptr;
+	}
+
+	const TSoftObjectPtr<USoundBase>& SoftSound = Column->Sounds[LineIndex];
+	if (USoundBase* Sound = SoftSound.Get())
+	{
+		FSSVoiceCultureStats::NotifyCacheHit();
+		FSSVoiceCultureStats::TrackResidentSound(Culture, Sound);
+		return Sound;
+	}
+
+	FSSVoiceCultureStats::NotifyCacheMiss();
+
+	USoundBase* Loaded = nullptr;
+	{
+		SS_VOICECULTURE_SCOPE_TEXT(STAT_VoiceCulture_SyncLoad,
+		                           *FString::Printf(TEXT("VoiceCulture::SyncLoad [%s] %s"), *Culture,
+		                                            *LineId.ToString()));
+		FSSVoiceCultureStats::NotifySyncLoad();
+
+		const double StartTime = FPlatformTime::Seconds();
+		Loaded = SoftSound.LoadSynchronous();
+		FSSVoiceCultureSyncLoadTracker::Record(FString::Printf(TEXT("%s:%s"), *Table->GetPathName(), *LineId.ToString()),
+		                                       Culture, SoftSound.ToSoftObjectPath(), FPlatformTime::Seconds() - StartTime);
+	}
+	FSSVoiceCultureStats::TrackResidentSound(Culture, Loaded);
+
+	if (!Loaded)
+	{
+		UE_LOG(LogVoiceCulture, Error, TEXT("%s : Synchronous load failed for culture [%s] asset [%s]."),
+		       *GetNameSafe(this), *Culture, *SoftSound.ToString());
+	}
+	return Loaded;
+}
+
+UAudioComponent* USSVoiceCultureSubsystem::PlayVoiceLine(const UObject* WorldContextObject, const USSVoiceCultureTable* Table,
+                                                         FName LineId)
+{
+	USoundBase* Sound = ResolveVoiceLine(Table, LineId);
+	if (!Sound)
+		return nullptr;
+
+	return UGameplayStatics::SpawnSound2D(WorldContextObject, Sound);
+}
+
+USSVoiceCultureTableColumn* USSVoiceCultureSubsystem::GetTableColumn(const USSVoiceCultureTable& Table, const FString& Culture)
+{
+	check(IsInGameThread());
+
+	const FSSVoiceCultureTableCulture* TableCulture = Table.FindCulture(Culture);
+	if (!TableCulture || TableCulture->Column.IsNull())
+		return nullptr;
+
+	USSVoiceCultureTableColumn* Column = TableCulture->Column.Get();
+	if (!Column)
+	{
+		SS_VOICECULTURE_SCOPE_TEXT(STAT_VoiceCulture_SyncLoad,
+		                           *FString::Printf(TEXT("VoiceCulture::SyncLoad [%s] %s"), *Culture,
+		                                            *TableCulture->Column.GetAssetName()));
+		FSSVoiceCultureStats::NotifySyncLoad();
+
+		const double StartTime = FPlatformTime::Seconds();
+		Column = TableCulture->Column.LoadSynchronous();
+		FSSVoiceCultureSyncLoadTracker::Record(Table.GetPathName(), Culture, TableCulture->Column.ToSoftObjectPath(),
+		                                       FPlatformTime::Seconds() - StartTime);
+	}
+
+	// Keep it while the culture is active, even once a prefetch request is released
+	if (Column && !ActiveTableColumns.Contains(Column))
+	{
+		ActiveTables.AddUnique(const_cast<USSVoiceCultureTable*>(&Table));
+
+		FRWScopeLock Lock(ActiveTableColumnsLock, SLT_Write);
+		ActiveTableColumns.Add(Column);
+		ActiveTableColumnsByKey.Add({FSoftObjectPath(&Table), TableCulture->Culture}, {&Table, Column});
+	}
+	return Column;
+}
+
+TOptional<FSoftObjectPath> USSVoiceCultureSubsystem::FindActiveTableSound(const FSoftObjectPath& TablePath, FName LineId,
+                                                                          const FString& Culture) const
+{
+	const FName CultureName(*Culture, FNAME_Find);
+	if (CultureName.IsNone())
+		return {};
+
+	FRWScopeLock Lock(ActiveTableColumnsLock, SLT_ReadOnly);
+
+	const FActiveTableColumn* Active = ActiveTableColumnsByKey.Find({TablePath, CultureName});
+	if (!Active)
+		return {};
+
+	// Line indices and column rows are not modified at runtime
+	const int32 LineIndex = Active->Table->FindLineIndex(LineId);
+	if (!Active->Column->Sounds.IsValidIndex(LineIndex))
+		return {};
+
+	// Copied under the lock: the column may be unpinned and collected once it is released
+	return Active->Column->Sounds[LineIndex].ToSoftObjectPath();
+}
+
+void USSVoiceCultureSubsystem::ResetActiveTableColumns()
+{
+	FRWScopeLock Lock(ActiveTableColumnsLock, SLT_Write);
+	ActiveTableColumns.Reset();
+	ActiveTableColumnsByKey.Reset();
+}
+
+void USSVoiceCultureSubsystem::ReleasePrefetchedSounds()
+{
+	for (FPrefetchRequest& Request : PrefetchRequests)
+	{
+		ReleaseRequest(Request);
+	}
+	PrefetchRequests.Reset();
+}
+
+bool USSVoiceCultureSubsystem::RequestSoundsAsync(const TArray<FSoftObjectPath>& SoundPaths, const FString& Culture,
+                                                  FPrefetchRequest& Request)
+{
+	if (SoundPaths.Num() == 0)
+		return false;
+
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_AsyncLoadRequest, "VoiceCulture::AsyncLoadRequest");
+
+	*Request.NumPending = SoundPaths.Num();
+	FSSVoiceCultureStats::NotifyAsyncLoadRequested(SoundPaths.Num());
+
+	TSharedRef<int32> NumPending = Request.NumPending;
+	Request.Handle = StreamableManager.RequestAsyncLoad(SoundPaths, [NumPending, SoundPaths, Culture]()
+	{
+		SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_AsyncLoadComplete, "VoiceCulture::AsyncLoadComplete");
+
+		FSSVoiceCultureStats::NotifyAsyncLoadCompleted(*NumPending);
+		*NumPending = 0;
+
+		for (const FSoftObjectPath& SoundPath : SoundPaths)
+		{
+			UObject* Loaded = SoundPath.ResolveObject();
+
+			// Bank chunk: every line of the bank for this culture
+			if (const USSVoiceCultureBankChunk* Chunk = Cast<USSVoiceCultureBankChunk>(Loaded))
+			{
+				for (USoundBase* Sound : Chunk->Sounds)
+				{
+					FSSVoiceCultureStats::TrackResidentSound(Culture, Sound);
+				}
+				continue;
+			}
+			FSSVoiceCultureStats::TrackResidentSound(Culture, Cast<USoundBase>(Loaded));
+		}
+	}, FStreamableManager::AsyncLoadHighPriority);
+
+	return true;
+}
+
+void USSVoiceCultureSubsystem::ReleaseRequest(FPrefetchRequest& Request)
+{
+	// Cancelled requests never call back, stop counting them as pending
+	if (*Request.NumPending > 0)
+	{
+		FSSVoiceCultureStats::NotifyAsyncLoadCompleted(*Request.NumPending);
+		*Request.NumPending = 0;
+	}
+
+	if (!Request.Handle.IsValid())
+		return;
+
+	if (Request.Handle->IsLoadingInProgress())
+	{
+		Request.Handle->CancelHandle();
+	}
+	else
+	{
+		Request.Handle->ReleaseHandle();
+	}
+	Request.Handle.Reset();
+}
+
+const USSVoiceCultureLevelManifest* USSVoiceCultureSubsystem::GetLevelManifest()
+{
+	if (!bLevelManifestLoaded)
+	{
+		bLevelManifestLoaded = true;
+
+		const FSoftObjectPath& ManifestPath = USSVoiceCultureSettings::GetSetting()->LevelManifest;
+		if (!ManifestPath.IsNull())
+		{
+			LevelManifest = Cast<USSVoiceCultureLevelManifest>(ManifestPath.TryLoad());
+			if (!LevelManifest)
+			{
+				UE_LOG(LogVoiceCulture, Warning, TEXT("%s : Level manifest [%s] could not be loaded, level prefetch disabled."),
+				       *GetNameSafe(this), *ManifestPath.ToString());
+			}
+		}
+	}
+	return LevelManifest;
+}
+
+void USSVoiceCultureSubsystem::HandlePreLoadMap(const FString& MapName)
+{
+	const FString PackageName = UWorld::RemovePIEPrefix(MapName);
+	if (!FPackageName::IsValidLongPackageName(PackageName))
+		return;
+
+	// Start right away, LoadMap blocks until the map is loaded
+	LoadingMapPackage = FName(PackageName);
+	PrefetchLevel(LoadingMapPackage);
+}
+
+void USSVoiceCultureSubsystem::HandlePostLoadMap(UWorld* LoadedWorld)
+{
+	// The world now keeps its map wanted
+	LoadingMapPackage = NAME_None;
+}
+
+void USSVoiceCultureSubsystem::PrefetchLevel(FName LevelPackage)
+{
+	if (LevelPrefetchRequests.Contains(LevelPackage))
+		return;
+
+	const USSVoiceCultureLevelManifest* Manifest = GetLevelManifest();
+	if (!Manifest)
+		return;
+
+	if (LevelPrefetchCulture.IsEmpty())
+	{
+		LevelPrefetchCulture = USSVoiceCultureSound::GetEffectiveVoiceCulture();
+	}
+
+	// Added even without sounds so the level is not looked up again while it stays wanted
+	FPrefetchRequest& Request = LevelPrefetchRequests.Add(LevelPackage);
+
+	TArray<FSoftObjectPath> SoundPaths;
+	if (Manifest->GetLevelSounds(LevelPackage, LevelPrefetchCulture, SoundPaths) &&
+		RequestSoundsAsync(SoundPaths, LevelPrefetchCulture, Request))
+	{
+		UE_LOG(LogVoiceCulture, Verbose, TEXT("%s : Prefetching %d sound(s) of level [%s] for culture [%s]"),
+		       *GetNameSafe(this), SoundPaths.Num(), *LevelPackage.ToString(), *LevelPrefetchCulture);
+	}
+}
+
+void USSVoiceCultureSubsystem::ReleaseLevelPrefetches()
+{
+	for (TPair<FName, FPrefetchRequest>& Pair : LevelPrefetchRequests)
+	{
+		ReleaseRequest(Pair.Value);
+	}
+	LevelPrefetchRequests.Reset();
+}
+
+bool USSVoiceCultureSubsystem::TickLevelStreaming(float DeltaTime)
+{
+	TSet<FName> WantedLevels;
+	if (!LoadingMapPackage.IsNone())
+	{
+		WantedLevels.Add(LoadingMapPackage);
+	}
+
+	for (const FWorldContext& Context : GEngine->GetWorldContexts())
+	{
+		UWorld* World = Context.World();
+		if (!World || !World->IsGameWorld())
+			continue;
+
+		WantedLevels.Add(FName(UWorld::RemovePIEPrefix(World->GetOutermost()->GetName())));
+
+		for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			// Wanted before being loaded: prefetch while the level itself streams in
+			if (StreamingLevel && StreamingLevel->ShouldBeLoaded())
+			{
+				WantedLevels.Add(FName(UWorld::RemovePIEPrefix(StreamingLevel->GetWorldAssetPackageName())));
+			}
+		}
+	}
+
+	// Nothing to follow (e.g. editor without PIE): do not even load the manifest
+	if (WantedLevels.Num() == 0 && LevelPrefetchRequests.Num() == 0)
+		return true;
+
+	// Culture switched: prefetch again for the new one
+	const FString Culture = USSVoiceCultureSound::GetEffectiveVoiceCulture();
+	if (!Culture.Equals(LevelPrefetchCulture, ESearchCase::IgnoreCase))
+	{
+		ReleaseLevelPrefetches();
+		LevelPrefetchCulture = Culture;
+	}
+
+	for (auto It = LevelPrefetchRequests.CreateIterator(); It; ++It)
+	{
+		if (WantedLevels.Contains(It.Key()))
+			continue;
+
+		ReleaseRequest(It.Value());
+		It.RemoveCurrent();
+	}
+
+	for (const FName& LevelPackage : WantedLevels)
+	{
+		PrefetchLevel(LevelPackage);
+	}
+	return true;
+}
+
+bool USSVoiceCultureSubsystem::TickStats(float DeltaTime)
+{
+	FSSVoiceCultureStats::UpdateResidentBytes();
+	return true;
+}
+
 #if WITH_EDITOR
 FString USSVoiceCultureSubsystem::GetEditorPreviewLanguage() const
 {
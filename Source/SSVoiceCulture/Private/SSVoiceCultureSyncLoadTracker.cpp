@@ -0,0 +1,230 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "SSVoiceCultureSyncLoadTracker.h"
+
+#include "SSVoiceCultureLog.h"
+#include "SSVoiceCultureSound.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "UObject/Script.h"
+
+namespace
+{
+#if SS_VOICECULTURE_TRACK_SYNC_LOADS
+	TAutoConsoleVariable<bool> CVarTrackSyncLoads(
+		TEXT("VoiceCulture.SyncLoads.Track"),
+		true,
+		TEXT("Record synchronous culture sound loads for the VoiceCulture.SyncLoads report."));
+#endif
+
+	FCriticalSection EntriesLock;
+
+	/** Voice asset, culture and site -> aggregated entry */
+	TMap<FString, FSSVoiceCultureSyncLoadTracker::FEntry> Entries;
+
+	/** Call site of the current thread, as an uint8 so no enum default is needed before first use */
+	thread_local uint8 CurrentSite = static_cast<uint8>(ESSVoiceSyncLoadSite::Code);
+
+	ESSVoiceSyncLoadSite GetCurrentSite()
+	{
+		const ESSVoiceSyncLoadSite Site = static_cast<ESSVoiceSyncLoadSite>(CurrentSite);
+		if (Site != ESSVoiceSyncLoadSite::Code)
+			return Site;
+
+#if DO_BLUEPRINT_GUARD
+		// Inside a Blueprint graph
+		if (FBlueprintContextTracker::Get().GetScriptEntryTag() > 0)
+			return ESSVoiceSyncLoadSite::Blueprint;
+#endif
+		return ESSVoiceSyncLoadSite::Code;
+	}
+
+	FString GetCurrentThreadName()
+	{
+		if (IsInGameThread())
+			return TEXT("GameThread");
+
+		if (IsInAudioThread())
+			return TEXT("AudioThread");
+
+		const FString& Name = FThreadManager::GetThreadName(FPlatformTLS::GetCurrentThreadId());
+		return Name.IsEmpty() ? FString::Printf(TEXT("Thread%u"), FPlatformTLS::GetCurrentThreadId()) : Name;
+	}
+
+#if SS_VOICECULTURE_TRACK_SYNC_LOADS
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice DumpCommand(
+		TEXT("VoiceCulture.SyncLoads.Dump"),
+		TEXT("Prints the synchronous voice loads ranked by total stall time. Optional: max rows (default 50, 0 for all)."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda(
+			[](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+			{
+				const int32 MaxRows = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 50;
+				FSSVoiceCultureSyncLoadTracker::DumpReport(Ar, MaxRows);
+			}));
+
+	FAutoConsoleCommand ResetCommand(
+		TEXT("VoiceCulture.SyncLoads.Reset"),
+		TEXT("Clears the recorded synchronous voice loads."),
+		FConsoleCommandDelegate::CreateStatic(&FSSVoiceCultureSyncLoadTracker::Reset));
+
+	FAutoConsoleCommand WriteCsvCommand(
+		TEXT("VoiceCulture.SyncLoads.WriteCsv"),
+		TEXT("Writes the synchronous voice loads report to Saved/SSVoiceCulture."),
+		FConsoleCommandDelegate::CreateStatic(&FSSVoiceCultureSyncLoadTracker::WriteSessionCsv));
+#endif
+}
+
+const TCHAR* LexToString(ESSVoiceSyncLoadSite Site)
+{
+	switch (Site)
+	{
+	case ESSVoiceSyncLoadSite::Blueprint: return TEXT("Blueprint");
+	case ESSVoiceSyncLoadSite::Parse: return TEXT("Parse");
+	case ESSVoiceSyncLoadSite::GetDuration: return TEXT("GetDuration");
+	case ESSVoiceSyncLoadSite::IsPlayable: return TEXT("IsPlayable");
+	default: return TEXT("Code");
+	}
+}
+
+FSSVoiceCultureSyncLoadTracker::FSiteScope::FSiteScope(ESSVoiceSyncLoadSite InSite)
+	: PreviousSite(CurrentSite)
+{
+	CurrentSite = static_cast<uint8>(InSite);
+}
+
+FSSVoiceCultureSyncLoadTracker::FSiteScope::~FSiteScope()
+{
+	CurrentSite = PreviousSite;
+}
+
+bool FSSVoiceCultureSyncLoadTracker::IsEnabled()
+{
+#if SS_VOICECULTURE_TRACK_SYNC_LOADS
+	return CVarTrackSyncLoads.GetValueOnAnyThread();
+#else
+	return false;
+#endif
+}
+
+void FSSVoiceCultureSyncLoadTracker::Record(const USSVoiceCultureSound* Owner, const FString& CultureCode,
+                                            const FSoftObjectPath& SoundPath, double DurationSeconds)
+{
+	if (!IsEnabled())
+		return;
+
+	Record(Owner ? Owner->GetPathName() : FString(TEXT("None")), CultureCode, SoundPath, DurationSeconds);
+}
+
+void FSSVoiceCultureSyncLoadTracker::Record(const FString& VoiceAsset, const FString& CultureCode,
+                                            const FSoftObjectPath& SoundPath, double DurationSeconds)
+{
+	if (!IsEnabled())
+		return;
+
+	const ESSVoiceSyncLoadSite Site = GetCurrentSite();
+	const FString Culture = CultureCode.ToLower();
+	const FString ThreadName = GetCurrentThreadName();
+	const double DurationMs = DurationSeconds * 1000.0;
+
+	FScopeLock Lock(&EntriesLock);
+
+	FEntry& Entry = Entries.FindOrAdd(FString::Printf(TEXT("%s|%s|%d"), *VoiceAsset, *Culture, static_cast<int32>(Site)));
+	if (Entry.Count == 0)
+	{
+		Entry.VoiceAsset = VoiceAsset;
+		Entry.Culture = Culture;
+		Entry.SoundPath = SoundPath.ToString();
+		Entry.Site = Site;
+	}
+
+	Entry.Threads.AddUnique(ThreadName);
+	Entry.Count++;
+	Entry.TotalMs += DurationMs;
+	Entry.MaxMs = FMath::Max(Entry.MaxMs, DurationMs);
+}
+
+TArray<FSSVoiceCultureSyncLoadTracker::FEntry> FSSVoiceCultureSyncLoadTracker::GetRankedEntries()
+{
+	TArray<FEntry> Ranked;
+	{
+		FScopeLock Lock(&EntriesLock);
+		Entries.GenerateValueArray(Ranked);
+	}
+
+	Ranked.Sort([](const FEntry& A, const FEntry& B) { return A.TotalMs > B.TotalMs; });
+	return Ranked;
+}
+
+void FSSVoiceCultureSyncLoadTracker::DumpReport(FOutputDevice& Ar, int32 MaxRows)
+{
+	const TArray<FEntry> Ranked = GetRankedEntries();
+
+	double TotalMs = 0.0;
+	int32 TotalCount = 0;
+	for (const FEntry& Entry : Ranked)
+	{
+		TotalMs += Entry.TotalMs;
+		TotalCount += Entry.Count;
+	}
+
+	Ar.Logf(TEXT("VoiceCulture sync loads: %d load(s), %.2f ms total stall, %d offender(s)"), TotalCount, TotalMs, Ranked.Num());
+	Ar.Logf(TEXT("%10s %10s %6s %-12s %-8s %-24s %s"), TEXT("Total ms"), TEXT("Max ms"), TEXT("Count"), TEXT("Site"),
+	        TEXT("Culture"), TEXT("Threads"), TEXT("Voice asset"));
+
+	const int32 NumRows = MaxRows > 0 ? FMath::Min(MaxRows, Ranked.Num()) : Ranked.Num();
+	for (int32 Index = 0; Index < NumRows; ++Index)
+	{
+		const FEntry& Entry = Ranked[Index];
+		Ar.Logf(TEXT("%10.2f %10.2f %6d %-12s %-8s %-24s %s"), Entry.TotalMs, Entry.MaxMs, Entry.Count,
+		        LexToString(Entry.Site), *Entry.Culture, *FString::Join(Entry.Threads, TEXT(",")), *Entry.VoiceAsset);
+	}
+}
+
+bool FSSVoiceCultureSyncLoadTracker::WriteCsv(const FString& FilePath)
+{
+	const TArray<FEntry> Ranked = GetRankedEntries();
+
+	FString Csv = TEXT("TotalMs,MaxMs,Count,Site,Culture,Threads,VoiceAsset,Sound\n");
+	for (const FEntry& Entry : Ranked)
+	{
+		// Paths never contain commas, threads are joined with ';'
+		Csv += FString::Printf(TEXT("%.3f,%.3f,%d,%s,%s,%s,%s,%s\n"), Entry.TotalMs, Entry.MaxMs, Entry.Count,
+		                       LexToString(Entry.Site), *Entry.Culture, *FString::Join(Entry.Threads, TEXT(";")),
+		                       *Entry.VoiceAsset, *Entry.SoundPath);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Csv, *FilePath))
+	{
+		UE_LOG(LogVoiceCulture, Error, TEXT("Failed to write sync load report to %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCulture, Log, TEXT("Sync load report written to %s (%d offender(s))"), *FilePath, Ranked.Num());
+	return true;
+}
+
+void FSSVoiceCultureSyncLoadTracker::WriteSessionCsv()
+{
+	{
+		FScopeLock Lock(&EntriesLock);
+		if (Entries.Num() == 0)
+			return;
+	}
+
+	const FString FilePath = FPaths::ProjectSavedDir() /
+		FString::Printf(TEXT("SSVoiceCulture/SyncLoads_%s.csv"), *FDateTime::Now().ToString());
+	WriteCsv(FilePath);
+}
+
+void FSSVoiceCultureSyncLoadTracker::Reset()
+{
+	FScopeLock Lock(&EntriesLock);
+	Entries.Reset();
+}
@@ -0,0 +1,106 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "SSVoiceCultureTable.h"
+
+#include "SSVoiceCultureLog.h"
+#include "UObject/AssetRegistryTagsContext.h"
+
+int32 USSVoiceCultureTable::FindLineIndex(FName LineId) const
+{
+	const int32* LineIndex = LineIndices.Find(LineId);
+	return LineIndex ? *LineIndex : INDEX_NONE;
+}
+
+const FSSVoiceCultureTableCulture* USSVoiceCultureTable::FindCulture(const FString& CultureCode) const
+{
+	const FName CultureName(*CultureCode, FNAME_Find);
+	if (CultureName.IsNone())
+		return nullptr;
+
+	return Cultures.FindByPredicate([CultureName](const FSSVoiceCultureTableCulture& Culture)
+	{
+		return Culture.Culture == CultureName;
+	});
+}
+
+void USSVoiceCultureTable::RebuildLineIndices()
+{
+	LineIndices.Reset();
+	LineIndices.Reserve(LineIds.Num());
+
+	for (int32 LineIndex = 0; LineIndex < LineIds.Num(); ++LineIndex)
+	{
+		// First row wins, like a linear search would
+		if (LineIndices.Contains(LineIds[LineIndex]))
+		{
+			UE_LOG(LogVoiceCulture, Warning, TEXT("%s : Duplicate line ID [%s]"), *GetNameSafe(this),
+			       *LineIds[LineIndex].ToString());
+			continue;
+		}
+		LineIndices.Add(LineIds[LineIndex], LineIndex);
+	}
+}
+
+void USSVoiceCultureTable::PostLoad()
+{
+	Super::PostLoad();
+
+	RebuildLineIndices();
+}
+
+#if WITH_EDITOR
+int32 USSVoiceCultureTable::AddLine(FName LineId)
+{
+	if (const int32* LineIndex = LineIndices.Find(LineId))
+		return *LineIndex;
+
+	const int32 LineIndex = LineIds.Add(LineId);
+	LineIndices.Add(LineId, LineIndex);
+	return LineIndex;
+}
+
+void USSVoiceCultureTable::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	RebuildLineIndices();
+}
+
+FString USSVoiceCultureTable::GetCultureCSV() const
+{
+	FString CultureCSV;
+	for (const FSSVoiceCultureTableCulture& Culture : Cultures)
+	{
+		if (Culture.Column.IsNull())
+			continue;
+
+		if (!CultureCSV.IsEmpty())
+		{
+			CultureCSV += TEXT(",");
+		}
+		CultureCSV += Culture.Culture.ToString().ToLower();
+	}
+	return CultureCSV;
+}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+void USSVoiceCultureTable::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	Context.AddTag(FAssetRegistryTag("VoiceCultures", GetCultureCSV(), FAssetRegistryTag::TT_Hidden));
+}
+#else
+void USSVoiceCultureTable::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	Super::GetAssetRegistryTags(OutTags);
+
+	OutTags.Add(FAssetRegistryTag("VoiceCultures", GetCultureCSV(), FAssetRegistryTag::TT_Hidden));
+}
+#endif
+#endif
@@ -0,0 +1,391 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SSVoiceCultureLog.h"
+#include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureSound.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "Sound/SoundWave.h"
+#include "Tests/SSVoiceCultureTestUtils.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/UObjectArray.h"
+
+/**
+ * Runtime tests for USSVoiceCultureSound resolution: correctness, micro-benchmarks and a soak run.
+ *
+ * Everything is built in memory (transient voice assets and sound waves, nothing is loaded or played),
+ * so the suite runs headless: UnrealEditor-Cmd <Project> -nullrhi -nosound -unattended
+ *   -ExecCmds="Automation RunTests SSVoiceCulture.Runtime; Quit"
+ *
+ * Soak switches: -VoiceCultureSoakCycles=N (default 5000), -VoiceCultureSoakHitchMs=N (default 5).
+ * Run it with -LLM to also report memory growth.
+ */
+namespace SSVoiceCultureRuntimeTests
+{
+	/** Culture codes for the synthetic entries (c0, c1...) */
+	FString MakeCulture(int32 Index)
+	{
+		return FString::Printf(TEXT("c%d"), Index);
+	}
+
+	/** Transient voice asset with one transient sound wave per culture */
+	struct FTestVoiceAsset
+	{
+		TStrongObjectPtr<USSVoiceCultureSound> VoiceSound;
+		TArray<TStrongObjectPtr<USoundWave>> Waves;
+
+		FTestVoiceAsset(UPackage* Outer, int32 NumCultures)
+		{
+			VoiceSound.Reset(NewObject<USSVoiceCultureSound>(Outer, NAME_None, RF_Transient));
+
+			for (int32 Index = 0; Index < NumCultures; ++Index)
+			{
+				USoundWave* Wave = NewObject<USoundWave>(Outer, NAME_None, RF_Transient);
+				Wave->Duration = 1.f + Index;
+				Waves.Emplace(Wave);
+
+				FSSCultureAudioEntry& Entry = VoiceSound->VoiceCultures.AddDefaulted_GetRef();
+				Entry.Culture = MakeCulture(Index);
+				Entry.Sound = Wave;
+			}
+		}
+	};
+
+	/**
+	 * Switches the voice culture the way the game does, and the editor preview culture
+	 * since IsPlayable / GetDuration resolve through it outside of game worlds.
+	 * Everything is restored on destruction, nothing is saved to ini.
+	 */
+	struct FScopedCultureSwitcher
+	{
+		FScopedCultureSwitcher()
+		{
+			Subsystem = GEngine ? GEngine->GetEngineSubsystem<USSVoiceCultureSubsystem>() : nullptr;
+			Settings = USSVoiceCultureSettings::GetMutableSetting();
+
+			if (Subsystem)
+			{
+				SavedCurrent = Subsystem->GetCurrentVoiceCulture();
+			}
+			SavedSettingsCurrent = Settings->CurrentLanguage;
+			SavedPreview = Settings->PreviewLanguage;
+
+			// Switches log at Log level, keep the soak output readable
+			SavedVerbosity = LogVoiceCulture.GetVerbosity();
+			LogVoiceCulture.SetVerbosity(ELogVerbosity::Warning);
+		}
+
+		~FScopedCultureSwitcher()
+		{
+			if (Subsystem)
+			{
+				Subsystem->SetCurrentVoiceCulture(SavedCurrent, false);
+			}
+			Settings->CurrentLanguage = SavedSettingsCurrent;
+			Settings->PreviewLanguage = SavedPreview;
+
+			LogVoiceCulture.SetVerbosity(SavedVerbosity);
+		}
+
+		bool IsValid() const { return Subsystem != nullptr; }
+
+		void Switch(const FString& Culture)
+		{
+			Subsystem->SetCurrentVoiceCulture(Culture, false);
+			Settings->PreviewLanguage = Culture;
+		}
+
+	private:
+		USSVoiceCultureSubsystem* Subsystem = nullptr;
+		USSVoiceCultureSettings* Settings = nullptr;
+		FString SavedCurrent;
+		FString SavedSettingsCurrent;
+		FString SavedPreview;
+		ELogVerbosity::Type SavedVerbosity = ELogVerbosity::Log;
+	};
+
+	UPackage* MakeTestOuter()
+	{
+		return NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+	}
+}
+
+////////////////////////////////////////////////////////////////////
+// Resolution
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSSVoiceCultureSoundResolveTest, "SSVoiceCulture.Runtime.Resolve",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                 EAutomationTestFlags::EngineFilter)
+
+bool FSSVoiceCultureSoundResolveTest::RunTest(const FString& Parameters)
+{
+	using namespace SSVoiceCultureRuntimeTests;
+
+	FScopedCultureSwitcher Switcher;
+	if (!TestTrue(TEXT("Voice culture subsystem available"), Switcher.IsValid()))
+		return false;
+
+	const FTestVoiceAsset Asset(MakeTestOuter(), 4);
+	const USSVoiceCultureSound* VoiceSound = Asset.VoiceSound.Get();
+
+	TestTrue(TEXT("Exact culture"), VoiceSound->GetSoundForCulture(TEXT("c2")) == Asset.Waves[2].Get());
+	TestTrue(TEXT("Case-insensitive culture"), VoiceSound->GetSoundForCulture(TEXT("C3")) == Asset.Waves[3].Get());
+	TestTrue(TEXT("Valid culture"), VoiceSound->HaveValidSoundForCulture(TEXT("c0")));
+	TestFalse(TEXT("Unknown culture"), VoiceSound->HaveValidSoundForCulture(TEXT("zz")));
+
+	AddExpectedError(TEXT("Can't found valid CultureSound"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestNull(TEXT("Unknown culture resolves to null"), VoiceSound->GetSoundForCulture(TEXT("zz")));
+
+	for (int32 Index = 0; Index < Asset.Waves.Num(); ++Index)
+	{
+		Switcher.Switch(MakeCulture(Index));
+
+		TestTrue(TEXT("Current culture sound follows switches"),
+		         VoiceSound->GetCurrentCultureSound() == Asset.Waves[Index].Get());
+		TestTrue(TEXT("Playable after switch"), VoiceSound->IsPlayable());
+		TestEqual(TEXT("Duration follows switches"), VoiceSound->GetDuration(), 1.f + Index);
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////
+// Micro-benchmark
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FSSVoiceCultureSoundBenchmarkTest, "SSVoiceCulture.Runtime.Benchmark",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                  EAutomationTestFlags::PerfFilter)
+
+void FSSVoiceCultureSoundBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumCultures : {1, 4, 16, 64})
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("Cultures%d"), NumCultures));
+		OutTestCommands.Add(FString::FromInt(NumCultures));
+	}
+}
+
+bool FSSVoiceCultureSoundBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace SSVoiceCultureRuntimeTests;
+
+	const int32 NumCultures = FMath::Max(1, FCString::Atoi(*Parameters));
+	constexpr int32 NumCalls = 20000;
+
+	// Culture switches every few calls, as when several lines play around a language change
+	constexpr int32 CallsPerSwitch = 8;
+
+	FScopedCultureSwitcher Switcher;
+	if (!TestTrue(TEXT("Voice culture subsystem available"), Switcher.IsValid()))
+		return false;
+
+	const FTestVoiceAsset Asset(MakeTestOuter(), NumCultures);
+	const USSVoiceCultureSound* VoiceSound = Asset.VoiceSound.Get();
+
+	TArray<FString> Cultures;
+	for (int32 Index = 0; Index < NumCultures; ++Index)
+	{
+		Cultures.Add(MakeCulture(Index));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetNumberField(TEXT("Cultures"), NumCultures);
+	Root->SetNumberField(TEXT("Calls"), NumCalls);
+	Root->SetStringField(TEXT("Date"), FDateTime::UtcNow().ToIso8601());
+	TArray<TSharedPtr<FJsonValue>> JsonResults;
+
+	auto Measure = [&](const TCHAR* Name, TFunctionRef<void(const FString& Culture)> Call)
+	{
+		double Elapsed = 0.0;
+		int64 NumAllocs = 0;
+		{
+			SSVoiceCultureTests::FScopedAllocationCounter Allocations;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 CallIndex = 0; CallIndex < NumCalls; ++CallIndex)
+			{
+				const FString& Culture = Cultures[(CallIndex / CallsPerSwitch) % NumCultures];
+				if (CallIndex % CallsPerSwitch == 0)
+				{
+					Switcher.Switch(Culture);
+				}
+				Call(Culture);
+			}
+			Elapsed = FPlatformTime::Seconds() - StartTime;
+			NumAllocs = Allocations.GetNumAllocs();
+		}
+
+		const double NsPerCall = Elapsed * 1.0e9 / NumCalls;
+		const double AllocsPerCall = static_cast<double>(NumAllocs) / NumCalls;
+		AddInfo(FString::Printf(TEXT("%-24s %3d cultures  %8.1f ns/call  %6.2f allocs/call"),
+		                        Name, NumCultures, NsPerCall, AllocsPerCall));
+
+		TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+		JsonResult->SetStringField(TEXT("Name"), Name);
+		JsonResult->SetNumberField(TEXT("NsPerCall"), NsPerCall);
+		JsonResult->SetNumberField(TEXT("AllocsPerCall"), AllocsPerCall);
+		JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+	};
+
+	// Switch cost alone, subtracted mentally from the others
+	Measure(TEXT("SwitchOnly"), [](const FString&) {});
+	Measure(TEXT("GetSoundForCulture"), [VoiceSound](const FString& Culture) { VoiceSound->GetSoundForCulture(Culture); });
+	Measure(TEXT("GetCurrentCultureSound"), [VoiceSound](const FString&) { VoiceSound->GetCurrentCultureSound(); });
+	Measure(TEXT("IsPlayable"), [VoiceSound](const FString&) { VoiceSound->IsPlayable(); });
+	Measure(TEXT("GetDuration"), [VoiceSound](const FString&) { VoiceSound->GetDuration(); });
+
+	Root->SetArrayField(TEXT("Results"), JsonResults);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Root, Writer);
+
+	const FString OutputPath = FPaths::ProjectSavedDir() /
+		FString::Printf(TEXT("SSVoiceCulture/Benchmarks/Runtime_%d.json"), NumCultures);
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		AddWarning(FString::Printf(TEXT("Failed to write benchmark results to %s"), *OutputPath));
+	}
+
+	return true;
+}
+
+////////////////////////////////////////////////////////////////////
+// Soak
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSSVoiceCultureSoundSoakTest, "SSVoiceCulture.Runtime.Soak",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                 EAutomationTestFlags::StressFilter)
+
+bool FSSVoiceCultureSoundSoakTest::RunTest(const FString& Parameters)
+{
+	using namespace SSVoiceCultureRuntimeTests;
+
+	int32 NumCycles = 5000;
+	FParse::Value(FCommandLine::Get(), TEXT("VoiceCultureSoakCycles="), NumCycles);
+	NumCycles = FMath::Max(NumCycles, 1);
+
+	double HitchMs = 5.0;
+	FParse::Value(FCommandLine::Get(), TEXT("VoiceCultureSoakHitchMs="), HitchMs);
+
+	constexpr int32 NumAssets = 32;
+	constexpr int32 NumCultures = 16;
+
+	FScopedCultureSwitcher Switcher;
+	if (!TestTrue(TEXT("Voice culture subsystem available"), Switcher.IsValid()))
+		return false;
+
+	UPackage* Outer = MakeTestOuter();
+	TArray<FTestVoiceAsset> Assets;
+	Assets.Reserve(NumAssets);
+	for (int32 Index = 0; Index < NumAssets; ++Index)
+	{
+		Assets.Emplace(Outer, NumCultures);
+	}
+
+	// One warm-up cycle so lazily created objects and strings are not counted as growth.
+	// Resolved sounds are compared by soft path: GC may run between cycles, object identity is not asserted.
+	auto RunCycle = [&](int32 Cycle) -> int32
+	{
+		const int32 CultureIndex = Cycle % NumCultures;
+		const FString Culture = MakeCulture(CultureIndex);
+		Switcher.Switch(Culture);
+
+		int32 NumMismatches = 0;
+		for (const FTestVoiceAsset& Asset : Assets)
+		{
+			const USSVoiceCultureSound* VoiceSound = Asset.VoiceSound.Get();
+			const FSoftObjectPath Expected = VoiceSound->VoiceCultures[CultureIndex].Sound.ToSoftObjectPath();
+
+			NumMismatches += FSoftObjectPath(VoiceSound->GetSoundForCulture(Culture)) != Expected ? 1 : 0;
+			NumMismatches += FSoftObjectPath(VoiceSound->GetCurrentCultureSound()) != Expected ? 1 : 0;
+			VoiceSound->IsPlayable();
+			VoiceSound->GetDuration();
+		}
+		return NumMismatches;
+	};
+	RunCycle(0);
+
+	const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	const int64 CacheHitsBefore = FSSVoiceCultureStats::GetNumCacheHits();
+	const int64 SyncLoadsBefore = FSSVoiceCultureStats::GetNumSyncLoads();
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	const bool bLLM = FLowLevelMemTracker::IsEnabled();
+	const int64 TrackedMemoryBefore = bLLM ? FLowLevelMemTracker::Get().GetTotalTrackedMemory(ELLMTracker::Default) : 0;
+#endif
+
+	TArray<double> CycleTimes;
+	CycleTimes.Reserve(NumCycles);
+	int32 NumMismatches = 0;
+	for (int32 Cycle = 0; Cycle < NumCycles; ++Cycle)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		NumMismatches += RunCycle(Cycle);
+		CycleTimes.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	const int32 ObjectsAfter = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	const int64 NumCacheHits = FSSVoiceCultureStats::GetNumCacheHits() - CacheHitsBefore;
+	const int64 NumSyncLoads = FSSVoiceCultureStats::GetNumSyncLoads() - SyncLoadsBefore;
+
+	CycleTimes.Sort();
+	const double MedianMs = CycleTimes[CycleTimes.Num() / 2];
+	const double P99Ms = CycleTimes[FMath::Min(CycleTimes.Num() - 1, CycleTimes.Num() * 99 / 100)];
+	const double MaxMs = CycleTimes.Last();
+
+	AddInfo(FString::Printf(TEXT("%d cycles x %d assets: median %.3f ms, p99 %.3f ms, max %.3f ms"),
+	                        NumCycles, NumAssets, MedianMs, P99Ms, MaxMs));
+	AddInfo(FString::Printf(TEXT("%lld cache hits, %lld sync loads, %+d UObjects (other systems and GC included)"),
+	                        NumCacheHits, NumSyncLoads, ObjectsAfter - ObjectsBefore));
+
+	// Every resolution returns the sound of its entry
+	TestEqual(TEXT("Resolved sounds match their entries"), NumMismatches, 0);
+
+	// Counters are global, other resolutions may add to them but ours must all be hits
+	const int64 NumResolutions = static_cast<int64>(NumCycles) * NumAssets;
+	TestTrue(TEXT("Resident sounds resolve from the cache"), NumCacheHits >= NumResolutions);
+	if (NumSyncLoads > 0)
+	{
+		AddWarning(FString::Printf(TEXT("%lld sync loads during the soak run"), NumSyncLoads));
+	}
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	// LLM tracks every thread, only growth that scales with the cycle count is reported
+	if (bLLM)
+	{
+		const int64 TrackedMemoryDelta = FLowLevelMemTracker::Get().GetTotalTrackedMemory(ELLMTracker::Default) -
+			TrackedMemoryBefore;
+		AddInfo(FString::Printf(TEXT("%+lld KB tracked by LLM"), TrackedMemoryDelta / 1024));
+		if (TrackedMemoryDelta > static_cast<int64>(NumCycles) * 64)
+		{
+			AddWarning(FString::Printf(TEXT("LLM tracked memory grew by %lld KB over %d cycles (leak?)"),
+			                           TrackedMemoryDelta / 1024, NumCycles));
+		}
+	}
+#endif
+
+	// Agents are noisy, hitches are reported but do not fail the run
+	if (MaxMs > HitchMs)
+	{
+		AddWarning(FString::Printf(TEXT("Hitch: slowest cycle took %.3f ms (threshold %.1f ms)"), MaxMs, HitchMs));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Sound/SoundBase.h"
+#include "SSVoiceCultureBank.generated.h"
+
+class USSVoiceCultureSound;
+
+/**
+ * Every line of a voice bank for one culture. The sounds are sub-objects of the chunk's own package,
+ * so loading a culture of a bank opens a single package and reads its audio sequentially.
+ */
+UCLASS()
+class SSVOICECULTURE_API USSVoiceCultureBankChunk : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Same order as USSVoiceCultureBank::LineIds, nullptr where the line has no sound for this culture */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<TObjectPtr<USoundBase>> Sounds;
+};
+
+/** Chunk of one culture */
+USTRUCT()
+struct FSSVoiceCultureBankCulture
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	FName Culture;
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TSoftObjectPtr<USSVoiceCultureBankChunk> Chunk;
+};
+
+/**
+ * Groups the lines of a scene or voice actor, with one chunk package per culture.
+ *
+ * Voice culture assets redirect to a bank line (USSVoiceCultureSound::Bank), their call sites do not change:
+ * resolving a line loads its culture chunk, then every other line of the bank resolves without any load.
+ * Prefetch a whole culture with USSVoiceCultureSubsystem::PrefetchVoiceBank.
+ *
+ * Built in the editor: -run=SSVoiceCulture -Mode=BuildBank
+ */
+UCLASS(BlueprintType)
+class SSVOICECULTURE_API USSVoiceCultureBank : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Line ids (voice asset package paths, '/' as '_'), the index of a line is its index in each chunk */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<FName> LineIds;
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<FSSVoiceCultureBankCulture> Cultures;
+
+#if WITH_EDITORONLY_DATA
+	/** Voice assets the bank was built from, used to rebuild it */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	TArray<TSoftObjectPtr<USSVoiceCultureSound>> SourceLines;
+#endif
+
+	/** Index of a line in LineIds (HintIndex is tried first), INDEX_NONE if the bank does not have it. */
+	int32 FindLineIndex(FName LineId, int32 HintIndex = INDEX_NONE) const;
+
+	/** Chunk entry of a culture (case-insensitive), nullptr if the bank has no audio for it. */
+	const FSSVoiceCultureBankCulture* FindCulture(const FString& CultureCode) const;
+
+	/** Sound of a line in a loaded chunk, nullptr if the chunk is not loaded or has no sound for the line. */
+	USoundBase* GetLoadedSound(int32 LineIndex, const FString& CultureCode) const;
+
+#if WITH_EDITOR
+	/** Object path of the chunk the bank builder creates for a culture: <BankName>_<culture>, next to the bank. */
+	static FSoftObjectPath GetChunkPath(const FSoftObjectPath& BankPath, const FString& CultureCode);
+#endif
+};
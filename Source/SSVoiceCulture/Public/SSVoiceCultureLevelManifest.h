@@ -0,0 +1,77 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "SSVoiceCultureLevelManifest.generated.h"
+
+/** Culture sounds of one level for one culture */
+USTRUCT()
+struct FSSVoiceCultureManifestCulture
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	FString Culture;
+
+	/** Indices into USSVoiceCultureLevelManifest::Sounds */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<int32> SoundIndices;
+};
+
+/** Voice culture sounds referenced by one map or streaming sublevel */
+USTRUCT()
+struct FSSVoiceCultureManifestLevel
+{
+	GENERATED_BODY()
+
+	/** Long package name of the level (e.g. /Game/Maps/Town_Audio) */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	FName PackageName;
+
+	/** Number of voice culture assets the level references */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	int32 NumVoiceSounds = 0;
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<FSSVoiceCultureManifestCulture> Cultures;
+};
+
+/**
+ * Per level list of the culture sounds its voice culture assets point to, so the subsystem can prefetch
+ * the current culture's lines while a level is streaming in (see USSVoiceCultureSettings::LevelManifest).
+ *
+ * Generated by the editor: -run=SSVoiceCulture -Mode=LevelManifest
+ * Culture sound paths are stored once and shared between levels.
+ */
+UCLASS()
+class SSVOICECULTURE_API USSVoiceCultureLevelManifest : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Every culture sound referenced by the levels below, without duplicates */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<FSoftObjectPath> Sounds;
+
+	/** Levels sorted by package name (lexical) */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<FSSVoiceCultureManifestLevel> Levels;
+
+	/** Returns the level entry for a long package name (PIE prefixes removed), nullptr if the level has no voice. */
+	const FSSVoiceCultureManifestLevel* FindLevel(FName LevelPackageName) const;
+
+	/** Appends the culture sounds of a level for the given culture. Returns false if nothing is listed. */
+	bool GetLevelSounds(FName LevelPackageName, const FString& CultureCode, TArray<FSoftObjectPath>& OutSounds) const;
+
+#if WITH_EDITOR
+	/** Sorts the levels so FindLevel can binary search them (call after filling Levels). */
+	void SortLevels();
+#endif
+};
@@ -79,6 +79,14 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Voice Culture|Cultures")
 	TSet<FString> SupportedVoiceCultures;
 
+	/**
+	 * Per level voice manifest (generated with -run=SSVoiceCulture -Mode=LevelManifest).
+	 * When set, the current culture's lines of a level are prefetched while the level streams in
+	 * and released when it unloads. Its folder must be cooked (e.g. DirectoriesToAlwaysCook).
+	 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category="Voice Culture|Streaming", meta=(AllowedClasses="/Script/SSVoiceCulture.SSVoiceCultureLevelManifest"))
+	FSoftObjectPath LevelManifest;
+
 	static FOnPreviewLanguageChanged OnPreviewLanguageChanged;
 	
 	// Call this whenever the PreviewLanguage changes
@@ -12,6 +12,9 @@
 #include "Runtime/Launch/Resources/Version.h"
 #include "SSVoiceCultureSound.generated.h"
 
+class USSVoiceCultureBank;
+class USSVoiceCultureTable;
+
 USTRUCT(BlueprintType)
 struct FSSCultureAudioEntry
 {
@@ -24,6 +27,47 @@ struct FSSCultureAudioEntry
 	TSoftObjectPtr<USoundBase> Sound;
 };
 
+/** Cooked form of a culture entry: interned culture and plain path, no heap string per entry */
+USTRUCT()
+struct FSSCookedCultureSound
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName Culture;
+
+	UPROPERTY()
+	FSoftObjectPath Sound;
+};
+
+/** Loudness and silence of one culture sound, measured in the editor (see the voice dashboard) */
+USTRUCT()
+struct FSSCultureSoundAnalysis
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	FString Culture;
+
+	/** Integrated loudness (ITU-R BS.1770, gated) in LUFS */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	float IntegratedLoudness = 0.f;
+
+	/** Sample peak in dBFS */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	float PeakDb = 0.f;
+
+	/** Seconds below the silence threshold before the first / after the last audible sample */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	float LeadingSilence = 0.f;
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	float TrailingSilence = 0.f;
+
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	float Duration = 0.f;
+};
+
 /**
  * Voice Culture Sound asset that manages multiple culture versions of a voice line.
  *
@@ -42,13 +86,50 @@ public:
 
 	USSVoiceCultureSound();
 
-	/** Voice entries per supported culture. Used to select the appropriate voice asset at runtime. */
+	/**
+	 * Voice entries per supported culture. Used to select the appropriate voice asset at runtime.
+	 * Empty in cooked builds (packed into CookedCultureSounds), use the accessors below to read cultures at runtime.
+	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voice Culture", meta = (
 		DisplayName = "Voice Cultures",
 		ToolTip = "A list of voice assets, one per culture. The system selects the appropriate one based on the current culture at runtime."
 	))
 	TArray<FSSCultureAudioEntry> VoiceCultures;
 
+	/**
+	 * Voice bank this line was packed into (set by the bank builder). Cooked builds then resolve each culture
+	 * from the bank's culture chunk instead of the separate culture sound; the editor keeps using VoiceCultures.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice Culture")
+	TSoftObjectPtr<USSVoiceCultureBank> Bank;
+
+#if WITH_EDITORONLY_DATA
+	/** Row of this line in Bank, also the name of its sound copies in the chunks */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	FName BankLineId;
+
+	/** Cultures the bank builder packed for this line, the cook points them at their chunk without loading the bank */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<FName> BankCultures;
+#endif
+
+	/**
+	 * Voice table this line was migrated to (set by the migration tool, VoiceCultures is then empty).
+	 * Cultures resolve from the table row TableLineId, so existing references to this asset keep working.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice Culture")
+	TSoftObjectPtr<USSVoiceCultureTable> Table;
+
+	/** Row of this line in Table */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voice Culture")
+	FName TableLineId;
+
+#if WITH_EDITORONLY_DATA
+	/** Last loudness analysis of each culture sound, exposed to the dashboard through the "VoiceLoudness" registry tag */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture|Analysis")
+	TArray<FSSCultureSoundAnalysis> CultureAnalysis;
+#endif
+
 	/**
 	 * Retrieves the culture sound for a specific culture code (e.g., "en", "fr").
 	 * @param CultureCode The language or culture code to match.
@@ -62,6 +143,7 @@ public:
 	 *
 	 * Iterates through the VoiceCultures array and returns true if an entry matches
 	 * the provided culture code (case-insensitive) and its associated sound is valid.
+	 * Lines migrated to a table read the pinned or loaded column, else the table's registry entry; nothing is loaded.
 	 *
 	 * @param CultureCode The culture/language code to check (e.g., "fr", "en").
 	 * @return True if a matching culture entry exists and has a valid sound; otherwise, false.
@@ -88,12 +170,66 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
 	USoundBase* GetCurrentCultureSound() const;
 
+	/** Culture codes this asset has an entry for, in editor and cooked builds. */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
+	TArray<FString> GetAvailableCultures() const;
+
+	/**
+	 * Sound path of a culture entry (case-insensitive), unset if the culture has no entry.
+	 * Reads the cooked table in cooked builds, VoiceCultures otherwise. Never loads the sound; a line migrated
+	 * to a voice table loads the table and its culture column if needed (game thread only, see FindTableSoundPath).
+	 */
+	TOptional<FSoftObjectPath> FindCultureSoundPath(const FString& CultureCode) const;
+
+	/** Calls Func(FName Culture, const FSoftObjectPath& Sound) for every culture entry, in editor and cooked builds. */
+	template <typename FunctorType>
+	void ForEachCultureSound(FunctorType&& Func) const
+	{
+		if (CookedCultureSounds.Num() > 0)
+		{
+			for (const FSSCookedCultureSound& Entry : CookedCultureSounds)
+			{
+				Func(Entry.Culture, Entry.Sound);
+			}
+			return;
+		}
+
+		for (const FSSCultureAudioEntry& Entry : VoiceCultures)
+		{
+			Func(FName(*Entry.Culture), Entry.Sound.ToSoftObjectPath());
+		}
+	}
+
+	// UObject overrides
+	/** Cooking saves VoiceCultures as the packed CookedCultureSounds table instead. */
+	virtual void Serialize(FArchive& Ar) override;
+#if WITH_EDITOR
+	/**
+	 * Builds CookedCultureSounds when cooking. Cultures packed into a bank (BankCultures) are redirected to their
+	 * chunk copy; the chunk path is derived from the bank path and checked in the asset registry, nothing is loaded.
+	 */
+	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+	virtual void PostSaveRoot(FObjectPostSaveRootContext ObjectSaveContext) override;
+#endif
+
 	// USoundBase overrides
 #if ENGINE_MAJOR_VERSION >= 5
 	virtual float GetDuration() const override;
 #endif
 	virtual bool IsPlayable() const override;
 	virtual void Parse(class FAudioDevice* AudioDevice, const UPTRINT NodeWaveInstanceHash, FActiveSound& ActiveSound, const FSoundParseParameters& ParseParams, TArray<FWaveInstance*>& WaveInstances) override;
+
+	/**
+	 * Attributes the culture sounds currently loaded through this wrapper to it (EstimatedTotal mode only),
+	 * so memreport and "obj list" show the real voice memory of each line. Nothing is loaded for this.
+	 */
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
+
+	/** Culture used to resolve sounds right now: the editor preview language in editor/preview context, else the current voice culture. */
+	static FString GetEffectiveVoiceCulture();
+
+	/** Voice actor part of the asset name following the naming convention (e.g. "NPC01" for LVA_NPC01_Hello), empty if none. */
+	FString GetVoiceActorName() const;
 	
 #if WITH_EDITOR
 	/** Returns the sound that would currently be used in the editor preview (based on editor-selected culture). */
@@ -101,6 +237,18 @@ public:
 
 	/** Returns a comma-separated string of all valid culture codes in lowercase (e.g., "en,fr,ja") */
 	FString GetVoiceCultureCSV() const;
+
+	/** CultureAnalysis as "culture=loudness/peak/leading/trailing/duration" entries separated by ';', empty if never analyzed */
+	FString GetCultureAnalysisTag() const;
+
+	/**
+	 * Duration of each culture sound as "culture=seconds" entries separated by ',', read without loading the sounds:
+	 * the culture's loudness analysis, else the loaded sound, else the sound's "Duration" registry tag.
+	 */
+	FString GetCultureDurationTag() const;
+
+	/** Sound of each culture as "culture=object path" entries separated by ',' (e.g. "en=/Game/VO/A_EN_Hello.A_EN_Hello") */
+	FString GetCultureSoundsTag() const;
 	
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
 	/** Adds custom tags to be displayed in the Content Browser (e.g., list of supported cultures). */
@@ -122,9 +270,32 @@ public:
 	 */
 	USoundBase* ResolveSoftSound(const TSoftObjectPtr<USoundBase>& SoftSound, const FString& CultureCode) const;
 
+	/** Same as ResolveSoftSound from a plain path (cooked table entries). */
+	USoundBase* ResolveSoundPath(const FSoftObjectPath& SoundPath, const FString& CultureCode) const;
+
 protected:
 	
 	/** Resolves the sound to be used, either for runtime or preview (based on context). */
 	USoundBase* ResolveEffectiveSound() const;
+
+	/**
+	 * Sound path of this line's row in Table for a culture, unset if the table or row has none.
+	 * On the game thread the table and its culture column are loaded and pinned if needed; other threads
+	 * (audio thread Parse) only read the columns pinned by USSVoiceCultureSubsystem.
+	 */
+	TOptional<FSoftObjectPath> FindTableSoundPath(const FString& CultureCode) const;
+
+	/** Row of this line in Table */
+	FName GetTableLineId() const { return TableLineId.IsNone() ? GetFName() : TableLineId; }
+
+	/** Cultures of Table from its "VoiceCultures" registry tag, without loading it */
+	TArray<FString> GetTableCulturesFromRegistry() const;
+
+	/**
+	 * Cooked builds only: VoiceCultures packed at cook, sorted by culture. Loads as is (no per-entry
+	 * string construction or post-load work) and lookups compare interned names.
+	 */
+	UPROPERTY()
+	TArray<FSSCookedCultureSound> CookedCultureSounds;
 	
 };
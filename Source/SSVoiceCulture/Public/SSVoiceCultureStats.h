@@ -0,0 +1,88 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+class USoundBase;
+
+/**
+ * Profiling for voice culture, shared by the runtime and editor modules.
+ *
+ * - "stat VoiceCulture" shows the cycle stats and counters below.
+ * - Unreal Insights: enable the channel with -trace=cpu,counters,VoiceCulture (or "Trace.Enable VoiceCulture").
+ *   Resolve, parse, sync load, async load and culture switch scopes then appear on the timeline,
+ *   sync loads and switches are named after their culture and asset.
+ */
+
+DECLARE_STATS_GROUP(TEXT("VoiceCulture"), STATGROUP_VoiceCulture, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Resolve Sound"), STAT_VoiceCulture_Resolve, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Parse"), STAT_VoiceCulture_Parse, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sync Load"), STAT_VoiceCulture_SyncLoad, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Load Request"), STAT_VoiceCulture_AsyncLoadRequest, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Load Complete"), STAT_VoiceCulture_AsyncLoadComplete, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Culture Switch"), STAT_VoiceCulture_CultureSwitch, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cache Hits"), STAT_VoiceCulture_CacheHits, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Cache Misses"), STAT_VoiceCulture_CacheMisses, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Sync Loads"), STAT_VoiceCulture_SyncLoads, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Loads"), STAT_VoiceCulture_PendingLoads, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Resident Culture Sounds"), STAT_VoiceCulture_ResidentBytes, STATGROUP_VoiceCulture, SSVOICECULTURE_API);
+
+UE_TRACE_CHANNEL_EXTERN(VoiceCultureChannel, SSVOICECULTURE_API);
+
+/** Cycle stat and Insights CPU scope on the VoiceCulture channel */
+#define SS_VOICECULTURE_SCOPE(Stat, ScopeName) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(ScopeName, VoiceCultureChannel)
+
+/** Same with a dynamic scope name (culture, asset), for rare events only since the name is always built */
+#define SS_VOICECULTURE_SCOPE_TEXT(Stat, ScopeText) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(ScopeText, VoiceCultureChannel)
+
+/**
+ * Counters behind the VoiceCulture stats and Insights counters.
+ * Thread-safe: sounds are resolved from the game and audio threads.
+ */
+class SSVOICECULTURE_API FSSVoiceCultureStats
+{
+public:
+	static void NotifyCacheHit();
+	static void NotifyCacheMiss();
+	static void NotifySyncLoad();
+	static void NotifyAsyncLoadRequested(int32 NumSounds);
+	static void NotifyAsyncLoadCompleted(int32 NumSounds);
+
+	/**
+	 * Tracks a loaded culture sound, its size is counted in its culture's resident bytes while it stays loaded.
+	 * Called on every resolve (cache hits included) so sounds streamed in by other systems are counted too;
+	 * an already tracked sound costs one read lock.
+	 */
+	static void TrackResidentSound(const FString& CultureCode, USoundBase* Sound);
+
+	/** Recomputes resident bytes per culture from the tracked sounds (game thread, called periodically). */
+	static void UpdateResidentBytes();
+
+	static int32 GetNumPendingLoads();
+
+	/** Totals since startup, the same values as the trace counters */
+	static int64 GetNumCacheHits();
+	static int64 GetNumCacheMisses();
+	static int64 GetNumSyncLoads();
+
+	/**
+	 * Prints resident voice memory of the loaded culture sounds by culture and by voice actor, and how much of it
+	 * belongs to cultures other than the effective one (waste). Game thread. Console: VoiceCulture.MemReport [MaxRows]
+	 * (add it to [MemReportCommands] in DefaultEngine.ini to have it in memreport files).
+	 */
+	static void DumpMemReport(FOutputDevice& Ar, int32 MaxRows = 20);
+};
@@ -7,10 +7,20 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
 #include "Subsystems/EngineSubsystem.h"
 #include "SSVoiceCultureSubsystem.generated.h"
 
+class USSVoiceCultureBank;
+class USSVoiceCultureLevelManifest;
+class USSVoiceCultureSound;
+class USSVoiceCultureTable;
+class USSVoiceCultureTableColumn;
+class UAudioComponent;
+class USoundBase;
+
 /**
  * Global engine subsystem that manages voice culture settings.
  *
@@ -58,6 +68,71 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
 	TArray<FString> GetSupportedVoiceCultures() const;
 	
+	/**
+	 * Starts loading the culture sounds of the given voice assets in the background,
+	 * so they resolve without a synchronous load when played.
+	 * Prefetched sounds stay loaded until ReleasePrefetchedSounds or the next voice culture switch.
+	 *
+	 * @param VoiceSounds  Voice assets about to be played (e.g. the lines of a dialogue).
+	 * @param CultureCode  Culture to prefetch, the current voice culture when empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
+	void PrefetchVoiceSounds(const TArray<USSVoiceCultureSound*>& VoiceSounds, const FString& CultureCode = TEXT(""));
+
+	/**
+	 * Starts loading the culture chunk of a voice bank (a single package with every line of the bank for that culture).
+	 * Released like PrefetchVoiceSounds.
+	 *
+	 * @param Bank         Bank of the scene or voice actor about to play.
+	 * @param CultureCode  Culture to prefetch, the current voice culture when empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
+	void PrefetchVoiceBank(USSVoiceCultureBank* Bank, const FString& CultureCode = TEXT(""));
+
+	/**
+	 * Starts loading the column of a voice table for a culture, so its lines resolve without loading the column.
+	 * Line sounds are still loaded on first use. Released like PrefetchVoiceSounds.
+	 *
+	 * @param Table        Voice table about to be used.
+	 * @param CultureCode  Culture to prefetch, the current voice culture when empty.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
+	void PrefetchVoiceTable(USSVoiceCultureTable* Table, const FString& CultureCode = TEXT(""));
+
+	/**
+	 * Returns the sound of a table line for the current voice culture (the preview language in editor).
+	 * The line lookup is hashed; the culture column and the sound are loaded synchronously if not loaded yet.
+	 *
+	 * @return The sound, nullptr if the table has no such line or the line is not recorded in this culture.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
+	USoundBase* ResolveVoiceLine(const USSVoiceCultureTable* Table, FName LineId);
+
+	/** Plays a table line as a 2D sound for the current voice culture. Returns the spawned component, if any. */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture", meta = (WorldContext = "WorldContextObject"))
+	UAudioComponent* PlayVoiceLine(const UObject* WorldContextObject, const USSVoiceCultureTable* Table, FName LineId);
+
+	/**
+	 * Column of a table for a culture, loaded synchronously if needed and pinned until the next voice culture switch
+	 * (the switch pins the new culture's column of every table used so far). Game thread only.
+	 * nullptr if the table has no column for the culture.
+	 */
+	USSVoiceCultureTableColumn* GetTableColumn(const USSVoiceCultureTable& Table, const FString& Culture);
+
+	/**
+	 * Sound path of a table line in the column pinned by GetTableColumn, never loads anything.
+	 * Safe off the game thread (audio thread Parse): the path is copied under the lock, as the column may be
+	 * unpinned right after. Unset if no column of the table is pinned for the culture.
+	 */
+	TOptional<FSoftObjectPath> FindActiveTableSound(const FSoftObjectPath& TablePath, FName LineId, const FString& Culture) const;
+
+	/** Lets prefetched sounds unload (pending requests are cancelled). Level prefetches are not affected. */
+	UFUNCTION(BlueprintCallable, Category = "Voice Culture")
+	void ReleasePrefetchedSounds();
+
+	/** Level manifest from the settings, loaded on first use. nullptr if none is set. */
+	const USSVoiceCultureLevelManifest* GetLevelManifest();
+
 #if WITH_EDITOR
 	/**
 	 * In editor only: returns the preview voice culture defined in the developer settings.
@@ -78,4 +153,76 @@ private:
 
 	/** Handle for the delegate binding to GameInstance start events. */
 	FDelegateHandle OnStartGameInstanceHandle;
+
+	FStreamableManager StreamableManager;
+
+	struct FPrefetchRequest
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+
+		/** Sounds still counted as pending loads, shared with the completion callback */
+		TSharedRef<int32> NumPending = MakeShared<int32>(0);
+	};
+	TArray<FPrefetchRequest> PrefetchRequests;
+
+	/** Starts loading the given culture sounds into Request. Returns false if there is nothing to load. */
+	bool RequestSoundsAsync(const TArray<FSoftObjectPath>& SoundPaths, const FString& Culture, FPrefetchRequest& Request);
+	static void ReleaseRequest(FPrefetchRequest& Request);
+
+	// ------------------------
+	// Voice tables
+	// ------------------------
+
+	/** Columns loaded by ResolveVoiceLine, kept until the next voice culture switch */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USSVoiceCultureTableColumn>> ActiveTableColumns;
+
+	/** Tables resolved through GetTableColumn, their column is pinned again for the new culture on a switch */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<USSVoiceCultureTable>> ActiveTables;
+
+	struct FActiveTableColumn
+	{
+		const USSVoiceCultureTable* Table = nullptr;
+		const USSVoiceCultureTableColumn* Column = nullptr;
+	};
+
+	/** (Table path, culture) -> pinned column. Written on the game thread, read by the audio thread under the lock */
+	TMap<TPair<FSoftObjectPath, FName>, FActiveTableColumn> ActiveTableColumnsByKey;
+	mutable FRWLock ActiveTableColumnsLock;
+
+	/** Unpins every table column (voice culture switch, shutdown) */
+	void ResetActiveTableColumns();
+
+	// ------------------------
+	// Level streaming prefetch (from the level manifest)
+	// ------------------------
+
+	UPROPERTY(Transient)
+	TObjectPtr<USSVoiceCultureLevelManifest> LevelManifest;
+	bool bLevelManifestLoaded = false;
+
+	/** One request per wanted level package (empty when the level has no voice), released when the level unloads */
+	TMap<FName, FPrefetchRequest> LevelPrefetchRequests;
+
+	/** Culture the level requests were made for */
+	FString LevelPrefetchCulture;
+
+	/** Map being loaded by LoadMap, kept wanted until its world exists */
+	FName LoadingMapPackage;
+
+	void HandlePreLoadMap(const FString& MapName);
+	void HandlePostLoadMap(UWorld* LoadedWorld);
+	void PrefetchLevel(FName LevelPackage);
+	void ReleaseLevelPrefetches();
+
+	/** Follows streaming levels: prefetch when a level is requested, release when it is not wanted anymore */
+	bool TickLevelStreaming(float DeltaTime);
+	FTSTicker::FDelegateHandle LevelStreamingTickerHandle;
+	FDelegateHandle PreLoadMapHandle;
+	FDelegateHandle PostLoadMapHandle;
+
+	/** Periodic update of the resident bytes stats */
+	bool TickStats(float DeltaTime);
+	FTSTicker::FDelegateHandle StatsTickerHandle;
 };
@@ -0,0 +1,94 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class USSVoiceCultureSound;
+
+/** The tracker is compiled out of shipping builds, Record and the console commands then do nothing */
+#ifndef SS_VOICECULTURE_TRACK_SYNC_LOADS
+#define SS_VOICECULTURE_TRACK_SYNC_LOADS !UE_BUILD_SHIPPING
+#endif
+
+/** Where a culture sound was resolved from when it had to be loaded synchronously */
+enum class ESSVoiceSyncLoadSite : uint8
+{
+	/** Native call outside of the sites below (GetSoundForCulture, GetCurrentCultureSound...) */
+	Code,
+	/** Call from a Blueprint graph */
+	Blueprint,
+	/** USoundBase::Parse, i.e. the audio thread starting playback */
+	Parse,
+	GetDuration,
+	IsPlayable,
+};
+
+SSVOICECULTURE_API const TCHAR* LexToString(ESSVoiceSyncLoadSite Site);
+
+/**
+ * Records every synchronous culture sound load done by ResolveSoftSound and aggregates them per
+ * voice asset, culture and call site, ranked by total stall time.
+ *
+ * The ranked list is what needs prefetching (see USSVoiceCultureSubsystem::PrefetchVoiceSounds).
+ * Console: VoiceCulture.SyncLoads.Dump [MaxRows], VoiceCulture.SyncLoads.Reset, VoiceCulture.SyncLoads.WriteCsv.
+ * The report is also written to Saved/SSVoiceCulture/SyncLoads_<date>.csv at session end when not empty.
+ * Not available in shipping builds (see SS_VOICECULTURE_TRACK_SYNC_LOADS).
+ */
+class SSVOICECULTURE_API FSSVoiceCultureSyncLoadTracker
+{
+public:
+	/** One aggregated offender */
+	struct FEntry
+	{
+		FString VoiceAsset;
+		FString Culture;
+		FString SoundPath;
+		ESSVoiceSyncLoadSite Site = ESSVoiceSyncLoadSite::Code;
+
+		/** Threads the loads happened on (e.g. "GameThread, AudioThread") */
+		TArray<FString> Threads;
+
+		int32 Count = 0;
+		double TotalMs = 0.0;
+		double MaxMs = 0.0;
+	};
+
+	/** Sets the call site of the sync loads done on this thread during its lifetime (nestable, innermost wins) */
+	struct SSVOICECULTURE_API FSiteScope
+	{
+		explicit FSiteScope(ESSVoiceSyncLoadSite InSite);
+		~FSiteScope();
+
+	private:
+		uint8 PreviousSite;
+	};
+
+	/** Records one synchronous load (any thread). */
+	static void Record(const USSVoiceCultureSound* Owner, const FString& CultureCode, const FSoftObjectPath& SoundPath,
+	                   double DurationSeconds);
+
+	/** Same for a line that is not its own asset (e.g. "VT_Scene01:Line_012" for a voice table row). */
+	static void Record(const FString& VoiceAsset, const FString& CultureCode, const FSoftObjectPath& SoundPath,
+	                   double DurationSeconds);
+
+	/** Aggregated entries, highest total stall first */
+	static TArray<FEntry> GetRankedEntries();
+
+	/** Prints the ranked report (MaxRows <= 0 for everything). */
+	static void DumpReport(FOutputDevice& Ar, int32 MaxRows = 50);
+
+	/** Writes the ranked report as CSV, returns false if the file could not be written. */
+	static bool WriteCsv(const FString& FilePath);
+
+	/** Writes Saved/SSVoiceCulture/SyncLoads_<date>.csv if anything was recorded. */
+	static void WriteSessionCsv();
+
+	static void Reset();
+
+	static bool IsEnabled();
+};
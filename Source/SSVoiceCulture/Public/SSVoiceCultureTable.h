@@ -0,0 +1,106 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Sound/SoundBase.h"
+#include "SSVoiceCultureTable.generated.h"
+
+class USSVoiceCultureSound;
+
+/**
+ * Every line of a voice table for one culture, in its own package: only the active culture's column is loaded.
+ * Sounds stay soft references, they are loaded line by line (or prefetched).
+ */
+UCLASS()
+class SSVOICECULTURE_API USSVoiceCultureTableColumn : public UObject
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Same order as USSVoiceCultureTable::LineIds, null where the line is not recorded in this culture */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	TArray<TSoftObjectPtr<USoundBase>> Sounds;
+};
+
+/** Column of one culture */
+USTRUCT()
+struct FSSVoiceCultureTableCulture
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	FName Culture;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	TSoftObjectPtr<USSVoiceCultureTableColumn> Column;
+};
+
+/**
+ * Registry of voice lines keyed by line ID, for projects where one USSVoiceCultureSound asset per line is too many
+ * objects and packages. Rows are stored column-major: one column package per culture (<Table>_<culture>),
+ * so the runtime footprint is the line IDs plus the rows of the active culture.
+ *
+ * Resolve or play a line with USSVoiceCultureSubsystem::ResolveVoiceLine / PlayVoiceLine.
+ */
+UCLASS(BlueprintType)
+class SSVOICECULTURE_API USSVoiceCultureTable : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Line IDs, the index of a line is its index in each column */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	TArray<FName> LineIds;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	TArray<FSSVoiceCultureTableCulture> Cultures;
+
+#if WITH_EDITORONLY_DATA
+	/** Voice asset each row was migrated from (same order as LineIds, null for rows added by hand), a later migration never takes over a row */
+	UPROPERTY(VisibleAnywhere, Category = "Voice Culture")
+	TArray<TSoftObjectPtr<USSVoiceCultureSound>> SourceLines;
+#endif
+
+	/** Index of a line in LineIds (hashed lookup), INDEX_NONE if the table does not have it. */
+	int32 FindLineIndex(FName LineId) const;
+
+	/** Column entry of a culture (case-insensitive), nullptr if the table has no column for it. */
+	const FSSVoiceCultureTableCulture* FindCulture(const FString& CultureCode) const;
+
+	/** Rebuilds the line ID lookup, needed after LineIds is modified from code. */
+	void RebuildLineIndices();
+
+#if WITH_EDITOR
+	/** Index of a line, appended (and indexed) if the table does not have it yet. Columns are not resized. */
+	int32 AddLine(FName LineId);
+#endif
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+
+	/** Comma-separated lowercase culture codes of the columns (e.g. "en,fr"), the "VoiceCultures" registry tag */
+	FString GetCultureCSV() const;
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	/** Adds the table cultures, so migrated voice assets list them without loading the table. */
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#else
+	/** Adds the table cultures, so migrated voice assets list them without loading the table. */
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#endif
+#endif
+
+private:
+
+	TMap<FName, int32> LineIndices;
+};
@@ -0,0 +1,116 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/MemoryBase.h"
+#include <atomic>
+
+/** Helpers shared by the runtime and editor automation tests / benchmarks. */
+namespace SSVoiceCultureTests
+{
+	/**
+	 * Forwards to the engine allocator and counts allocations and frees (every thread, workers included).
+	 * Installed only around a measured body, never freed since another thread may still be inside a call.
+	 */
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		FMalloc* Inner = nullptr;
+		std::atomic<uint64> NumAllocs{0};
+		std::atomic<uint64> NumFrees{0};
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			NumAllocs.fetch_add(1, std::memory_order_relaxed);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (!Original && Count > 0)
+			{
+				NumAllocs.fetch_add(1, std::memory_order_relaxed);
+			}
+			else if (Original && Count == 0)
+			{
+				NumFrees.fetch_add(1, std::memory_order_relaxed);
+			}
+			else if (Count > 0)
+			{
+				// A grow counts as an allocation, the block count does not change
+				NumAllocs.fetch_add(1, std::memory_order_relaxed);
+				NumFrees.fetch_add(1, std::memory_order_relaxed);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override
+		{
+			if (Original)
+			{
+				NumFrees.fetch_add(1, std::memory_order_relaxed);
+			}
+			Inner->Free(Original);
+		}
+
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+		virtual void UpdateStats() override { Inner->UpdateStats(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	};
+
+	/** Swaps GMalloc for the counting proxy during its lifetime (not nestable) */
+	struct FScopedAllocationCounter
+	{
+		explicit FScopedAllocationCounter(bool bEnabled = true)
+		{
+			if (!bEnabled)
+				return;
+
+			static FCountingMalloc* Proxy = new FCountingMalloc();
+			Counter = Proxy;
+			Counter->Inner = GMalloc;
+			Counter->NumAllocs = 0;
+			Counter->NumFrees = 0;
+			GMalloc = Counter;
+		}
+
+		~FScopedAllocationCounter()
+		{
+			if (Counter)
+			{
+				GMalloc = Counter->Inner;
+			}
+		}
+
+		/** Allocations so far, -1 when counting is disabled */
+		int64 GetNumAllocs() const { return Counter ? static_cast<int64>(Counter->NumAllocs.load()) : -1; }
+
+		/** Allocations not freed yet, 0 when counting is disabled */
+		int64 GetNumLiveAllocs() const
+		{
+			return Counter ? static_cast<int64>(Counter->NumAllocs.load()) - static_cast<int64>(Counter->NumFrees.load()) : 0;
+		}
+
+	private:
+		FCountingMalloc* Counter = nullptr;
+	};
+}
+
+#endif
@@ -36,6 +36,7 @@ public class SSVoiceCulture : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"InputCore",
+				"Json",
 			}
 			);
 		
@@ -0,0 +1,648 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Commandlets/SSVoiceCultureCommandlet.h"
+
+#include "Editor.h"
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureLevelManifest.h"
+#include "SSVoiceCultureSettings.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+#include "Utils/SSVoiceCultureUtils.h"
+
+USSVoiceCultureCommandlet::USSVoiceCultureCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 USSVoiceCultureCommandlet::Main(const FString& Params)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FString Mode;
+	if (!FParse::Value(*Params, TEXT("Mode="), Mode))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Missing -Mode=AutoPopulate|Coverage|ActorList|LevelManifest|BuildBank|Migrate|Dedup|Loudness|AudioProfiles|Orphans|RenameCultures|ExportMappings|ImportMappings|CreateWrappers"));
+		return 1;
+	}
+
+	// Optional profile override, kept out of the user config
+	FString ProfileName;
+	if (FParse::Value(*Params, TEXT("Profile="), ProfileName))
+	{
+		GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>()->ChangeActiveProfileFromName(ProfileName, false);
+	}
+
+	// Every query below relies on a complete registry
+	double PhaseStart = FPlatformTime::Seconds();
+	USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get().SearchAllAssets(true);
+	const double RegistrySeconds = FPlatformTime::Seconds() - PhaseStart;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Asset registry ready in %.2fs"), RegistrySeconds);
+
+	TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("Mode"), Mode);
+	Result->SetStringField(TEXT("Profile"), USSVoiceCultureEditorSettings::GetSetting()->ActiveVoiceProfileName);
+	Result->SetNumberField(TEXT("RegistrySeconds"), RegistrySeconds);
+
+	int32 ReturnCode;
+	if (Mode.Equals(TEXT("AutoPopulate"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunAutoPopulate(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("Coverage"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunCoverage(Result);
+	}
+	else if (Mode.Equals(TEXT("ActorList"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunActorList(Result);
+	}
+	else if (Mode.Equals(TEXT("LevelManifest"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunLevelManifest(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("BuildBank"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunBuildBank(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("Migrate"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunMigrate(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("Dedup"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunDedup(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("Loudness"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunLoudness(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("AudioProfiles"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunAudioProfiles(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("Orphans"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunOrphans(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("RenameCultures"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunRenameCultures(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("ExportMappings"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunExportMappings(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("ImportMappings"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunImportMappings(Params, Result);
+	}
+	else if (Mode.Equals(TEXT("CreateWrappers"), ESearchCase::IgnoreCase))
+	{
+		ReturnCode = RunCreateWrappers(Params, Result);
+	}
+	else
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Unknown mode '%s'"), *Mode);
+		return 1;
+	}
+
+	Result->SetNumberField(TEXT("ReturnCode"), ReturnCode);
+	Result->SetNumberField(TEXT("TotalSeconds"), FPlatformTime::Seconds() - StartTime);
+
+	// Write the machine-readable summary
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/CommandletResult.json");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Result, Writer);
+
+	if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Result written to %s"), *OutputPath);
+	return ReturnCode;
+}
+
+int32 USSVoiceCultureCommandlet::RunAutoPopulate(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bNoSave = FParse::Param(*Params, TEXT("NoSave"));
+	Options.bForceSave = !Options.bNoSave;
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("Workers="), Options.NumWorkers);
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	const bool bOverride = FParse::Param(*Params, TEXT("Override"));
+
+	FSSVoiceCultureOperationStats Stats;
+
+	FString Culture;
+	FString Actor;
+	if (FParse::Value(*Params, TEXT("Culture="), Culture))
+	{
+		FSSVoiceCultureUtils::AutoPopulateCulture(Culture, bOverride, Options, &Stats);
+	}
+	else if (FParse::Value(*Params, TEXT("Actor="), Actor))
+	{
+		// -Cultures=fr+de, else the supported voice cultures of the settings
+		FString CulturesParam;
+		TArray<FString> Cultures;
+		if (FParse::Value(*Params, TEXT("Cultures="), CulturesParam))
+		{
+			CulturesParam.ParseIntoArray(Cultures, TEXT("+"));
+		}
+		FSSVoiceCultureUtils::AutoPopulateFromVoiceActor(Actor, !bOverride, Options, &Stats, Cultures);
+	}
+	else if (FParse::Param(*Params, TEXT("All")))
+	{
+		FSSVoiceCultureUtils::AutoPopulateAllCultures(bOverride, Options, &Stats);
+	}
+	else
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] AutoPopulate needs -Culture=, -Actor= or -All"));
+		return 1;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display,
+	       TEXT("[SSVoiceCulture] %s: scanned %d, matched %d, modified %d, saved %d "
+		       "(scan %.2fs, match %.2fs, apply %.2fs, save %.2fs, total %.2fs)"),
+	       *Stats.Operation, Stats.AssetsScanned, Stats.AssetsMatched, Stats.AssetsModified, Stats.PackagesSaved,
+	       Stats.ScanSeconds, Stats.MatchSeconds, Stats.ApplySeconds, Stats.SaveSeconds, Stats.TotalSeconds);
+
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunCoverage(TSharedRef<FJsonObject> Result)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	FSSVoiceCultureReport Report;
+	FSSVoiceCultureUtils::GenerateCultureCoverageReport(Report);
+
+	for (const FSSVoiceCultureReportEntry& Entry : Report.Entries)
+	{
+		UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %s: %d/%d"), *Entry.Culture,
+		       Entry.AssetsWithCulture, Entry.TotalAssets);
+	}
+
+	Result->SetObjectField(TEXT("Coverage"), FJsonObjectConverter::UStructToJsonObject(Report));
+	Result->SetNumberField(TEXT("CoverageSeconds"), FPlatformTime::Seconds() - StartTime);
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunActorList(TSharedRef<FJsonObject> Result)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FString> Actors;
+	FSSVoiceCultureUtils::GenerateActorListJson(Actors);
+
+	TArray<TSharedPtr<FJsonValue>> JsonArray;
+	for (const FString& Actor : Actors)
+	{
+		JsonArray.Add(MakeShared<FJsonValueString>(Actor));
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d voice actors found"), Actors.Num());
+
+	Result->SetArrayField(TEXT("Actors"), JsonArray);
+	Result->SetNumberField(TEXT("ActorListSeconds"), FPlatformTime::Seconds() - StartTime);
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunLevelManifest(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FString ManifestPath = USSVoiceCultureSettings::GetSetting()->LevelManifest.ToString();
+	if (ManifestPath.IsEmpty())
+	{
+		ManifestPath = FSSVoiceCultureUtils::DefaultLevelManifestPath;
+	}
+	FParse::Value(*Params, TEXT("Manifest="), ManifestPath);
+
+	TArray<FString> Maps;
+	FString MapsParam;
+	if (FParse::Value(*Params, TEXT("Maps="), MapsParam))
+	{
+		MapsParam.ParseIntoArray(Maps, TEXT("+"));
+	}
+
+	FSSVoiceCultureOperationStats Stats;
+	const USSVoiceCultureLevelManifest* Manifest = FSSVoiceCultureUtils::GenerateLevelManifest(
+		ManifestPath, Maps, !FParse::Param(*Params, TEXT("NoSave")), Stats);
+	if (!Manifest)
+		return 1;
+
+	if (USSVoiceCultureSettings::GetSetting()->LevelManifest.IsNull())
+	{
+		UE_LOG(LogVoiceCultureEditor, Warning,
+		       TEXT("[SSVoiceCulture] Set Project Settings > Voice Culture > Level Manifest to %s to enable level prefetch"),
+		       *ManifestPath);
+	}
+
+	Result->SetStringField(TEXT("Manifest"), ManifestPath);
+	Result->SetNumberField(TEXT("Levels"), Manifest->Levels.Num());
+	Result->SetNumberField(TEXT("CultureSounds"), Manifest->Sounds.Num());
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunBuildBank(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FString BankPath;
+	if (!FParse::Value(*Params, TEXT("Bank="), BankPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] BuildBank needs -Bank=<Package path>"));
+		return 1;
+	}
+
+	// "/Game/Dialogue/VB_Scene01" is accepted for "/Game/Dialogue/VB_Scene01.VB_Scene01"
+	if (!BankPath.Contains(TEXT(".")))
+	{
+		BankPath = FString::Printf(TEXT("%s.%s"), *BankPath, *FPackageName::GetShortName(BankPath));
+	}
+
+	// Lines: from a voice actor, a folder, or the bank's previous sources when neither is given
+	TArray<FAssetData> VoiceAssets;
+	FString Actor;
+	FString Path;
+	if (FParse::Value(*Params, TEXT("Actor="), Actor))
+	{
+		USSVoiceCultureEditorSubsystem::GetAssetsFromVoiceActor(VoiceAssets, Actor);
+	}
+	else if (FParse::Value(*Params, TEXT("Path="), Path))
+	{
+		const FString SubFolderPrefix = Path + TEXT("/");
+		for (const FAssetData& VoiceAsset : USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets())
+		{
+			const FString PackagePath = VoiceAsset.PackagePath.ToString();
+			if (PackagePath.Equals(Path) || PackagePath.StartsWith(SubFolderPrefix))
+			{
+				VoiceAssets.Add(VoiceAsset);
+			}
+		}
+	}
+
+	FSSVoiceCultureOperationStats Stats;
+	const USSVoiceCultureBank* Bank = FSSVoiceCultureUtils::BuildVoiceBank(BankPath, VoiceAssets,
+	                                                                      !FParse::Param(*Params, TEXT("NoSave")), Stats);
+	if (!Bank)
+		return 1;
+
+	Result->SetStringField(TEXT("Bank"), BankPath);
+	Result->SetNumberField(TEXT("Lines"), Bank->LineIds.Num());
+	Result->SetNumberField(TEXT("Cultures"), Bank->Cultures.Num());
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunMigrate(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FString PathParam;
+	if (!FParse::Value(*Params, TEXT("Path="), PathParam))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Migrate needs -Path=<Folder>[+<Folder>...]"));
+		return 1;
+	}
+
+	TArray<FString> Folders;
+	PathParam.ParseIntoArray(Folders, TEXT("+"));
+
+	ESSVoiceCultureMigrationFormat Format = ESSVoiceCultureMigrationFormat::Table;
+	FString FormatParam;
+	if (FParse::Value(*Params, TEXT("Format="), FormatParam))
+	{
+		const int64 FormatValue = StaticEnum<ESSVoiceCultureMigrationFormat>()->GetValueByNameString(FormatParam);
+		if (FormatValue == INDEX_NONE)
+		{
+			UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Unknown -Format=%s (Table|Bank)"), *FormatParam);
+			return 1;
+		}
+		Format = static_cast<ESSVoiceCultureMigrationFormat>(FormatValue);
+	}
+
+	// "/Game/Dialogue/VT_Dialogue" is accepted for "/Game/Dialogue/VT_Dialogue.VT_Dialogue"
+	FString TargetPath;
+	if (FParse::Value(*Params, TEXT("Target="), TargetPath) && !TargetPath.Contains(TEXT(".")))
+	{
+		TargetPath = FString::Printf(TEXT("%s.%s"), *TargetPath, *FPackageName::GetShortName(TargetPath));
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureMigrationReport Report;
+	const bool bSuccess = FSSVoiceCultureUtils::MigrateVoiceFolders(Folders, Format, TargetPath, Options, Report);
+	FSSVoiceCultureUtils::SaveMigrationReport(Report);
+
+	UE_LOG(LogVoiceCultureEditor, Display,
+	       TEXT("[SSVoiceCulture] Migrate (%s): %d migrated, %d skipped, %d conflict(s), %d saved (apply %.2fs, save %.2fs, total %.2fs)"),
+	       *Report.Format, Report.Migrated.Num(), Report.Skipped.Num(), Report.Conflicts.Num(), Report.Stats.PackagesSaved,
+	       Report.Stats.ApplySeconds, Report.Stats.SaveSeconds, Report.Stats.TotalSeconds);
+
+	TArray<TSharedPtr<FJsonValue>> Targets;
+	for (const FString& Target : Report.Targets)
+	{
+		Targets.Add(MakeShared<FJsonValueString>(Target));
+	}
+
+	Result->SetArrayField(TEXT("Targets"), Targets);
+	Result->SetNumberField(TEXT("Migrated"), Report.Migrated.Num());
+	Result->SetNumberField(TEXT("Skipped"), Report.Skipped.Num());
+	Result->SetNumberField(TEXT("Conflicts"), Report.Conflicts.Num());
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return bSuccess ? 0 : 1;
+}
+
+int32 USSVoiceCultureCommandlet::RunDedup(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureDedupReport Report;
+	FSSVoiceCultureUtils::FindDuplicateCultureSounds(Options, Report);
+
+	// Rewrite the references only on request, the report is worth a review first
+	if (FParse::Param(*Params, TEXT("Apply")))
+	{
+		FSSVoiceCultureUtils::ApplyDuplicateClusters(Report.Clusters, Options, Report.Stats);
+	}
+	FSSVoiceCultureUtils::SaveDedupReport(Report);
+
+	Result->SetNumberField(TEXT("Clusters"), Report.Clusters.Num());
+	Result->SetNumberField(TEXT("DuplicateBytes"), Report.DuplicateBytes);
+	Result->SetNumberField(TEXT("SoundsHashed"), Report.SoundsHashed);
+	Result->SetNumberField(TEXT("CacheHits"), Report.CacheHits);
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunLoudness(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+
+	FSSVoiceCultureLoudnessReport Report;
+	FSSVoiceCultureUtils::AnalyzeCultureLoudness(VoiceAssets, Options, Report.Stats);
+
+	// Trimming rewrites the culture sounds, only on request. Voice assets with nothing to trim are only loaded.
+	int32 TrimmedSounds = 0;
+	if (FParse::Param(*Params, TEXT("Trim")))
+	{
+		TrimmedSounds = FSSVoiceCultureUtils::TrimCultureSilence(VoiceAssets, Options, Report.Stats);
+	}
+
+	// Fresh registry data, the tags of the saved voice assets changed
+	Report.Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	FSSVoiceCultureUtils::BuildLoudnessReport(USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets(), Report);
+	FSSVoiceCultureUtils::SaveLoudnessReport(Report);
+
+	Result->SetStringField(TEXT("ReferenceCulture"), Report.ReferenceCulture);
+	Result->SetNumberField(TEXT("Flagged"), Report.Flagged.Num());
+	Result->SetNumberField(TEXT("Trimmable"), Report.Trimmable.Num());
+	Result->SetNumberField(TEXT("TrimmedSounds"), TrimmedSounds);
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunAudioProfiles(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	if (USSVoiceCultureEditorSettings::GetSetting()->CultureAudioProfiles.Num() == 0)
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] AudioProfiles: no CultureAudioProfiles in the editor settings"));
+		return 1;
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureAudioProfileReport Report;
+	FSSVoiceCultureUtils::ApplyCultureAudioProfiles(!FParse::Param(*Params, TEXT("DryRun")), Options, Report);
+	FSSVoiceCultureUtils::SaveAudioProfileReport(Report);
+
+	int64 BytesBefore = 0;
+	int64 BytesAfter = 0;
+	int32 UnknownSizes = 0;
+	for (const FSSVoiceCultureAudioProfileCulture& Culture : Report.Cultures)
+	{
+		BytesBefore += Culture.BytesBefore;
+		BytesAfter += Culture.BytesAfter;
+		UnknownSizes += Culture.UnknownSizes;
+	}
+
+	Result->SetBoolField(TEXT("Applied"), Report.bApplied);
+	Result->SetNumberField(TEXT("BytesBefore"), BytesBefore);
+	Result->SetNumberField(TEXT("BytesAfterEstimate"), BytesAfter);
+	Result->SetNumberField(TEXT("UnknownSizes"), UnknownSizes);
+	Result->SetNumberField(TEXT("SharedSounds"), Report.SharedSounds.Num());
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunOrphans(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	const USSVoiceCultureStrategy* Strategy = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>()->GetActiveStrategy();
+	if (!IsValid(Strategy) || !Strategy->GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Orphans needs a native voice strategy"));
+		return 1;
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("Workers="), Options.NumWorkers);
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureOrphanReport Report;
+	FSSVoiceCultureUtils::FindOrphanCultureSounds(*Strategy, Options, Report);
+	FSSVoiceCultureUtils::SaveOrphanReport(Report);
+
+	// Deletion and relocation only on request, the report is worth a review first
+	int32 Deleted = 0;
+	int32 Moved = 0;
+	FString MoveTo;
+	if (FParse::Param(*Params, TEXT("Delete")))
+	{
+		Deleted = FSSVoiceCultureUtils::DeleteOrphanCultureSounds(Report.Orphans, Options);
+	}
+	else if (FParse::Value(*Params, TEXT("MoveTo="), MoveTo))
+	{
+		Moved = FSSVoiceCultureUtils::MoveOrphanCultureSounds(Report.Orphans, MoveTo, Options);
+	}
+
+	Result->SetNumberField(TEXT("Orphans"), Report.Orphans.Num());
+	Result->SetNumberField(TEXT("TotalDiskSize"), Report.TotalDiskSize);
+	Result->SetNumberField(TEXT("Deleted"), Deleted);
+	Result->SetNumberField(TEXT("Moved"), Moved);
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return 0;
+}
+
+int32 USSVoiceCultureCommandlet::RunRenameCultures(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	// -Rename=jp:ja+br:pt-BR
+	FString RenameParam;
+	if (!FParse::Value(*Params, TEXT("Rename="), RenameParam))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] RenameCultures needs -Rename=old:new[+old:new]"));
+		return 1;
+	}
+
+	TArray<FString> Pairs;
+	RenameParam.ParseIntoArray(Pairs, TEXT("+"));
+
+	TMap<FString, FString> Renames;
+	for (const FString& Pair : Pairs)
+	{
+		FString OldCulture;
+		FString NewCulture;
+		if (!Pair.Split(TEXT(":"), &OldCulture, &NewCulture))
+		{
+			UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Invalid rename '%s', expected old:new"), *Pair);
+			return 1;
+		}
+		Renames.Add(OldCulture, NewCulture);
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureRenameReport Report;
+	const bool bSuccess = FSSVoiceCultureUtils::RenameCultureCodes(Renames, Options, Report);
+	FSSVoiceCultureUtils::SaveCultureRenameReport(Report);
+
+	Result->SetNumberField(TEXT("Changes"), Report.Changes.Num());
+	Result->SetNumberField(TEXT("Conflicts"), Report.Conflicts);
+	Result->SetBoolField(TEXT("SettingsUpdated"), Report.bSettingsUpdated);
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return bSuccess ? 0 : 1;
+}
+
+int32 USSVoiceCultureCommandlet::RunExportMappings(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FString File;
+	if (!FParse::Value(*Params, TEXT("File="), File))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] ExportMappings needs -File=<Path.csv|Path.jsonl>"));
+		return 1;
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	FParse::Value(*Params, TEXT("Workers="), Options.NumWorkers);
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureOperationStats Stats;
+	const bool bSuccess = FSSVoiceCultureUtils::ExportVoiceCultureMappings(File, Options, Stats);
+
+	Result->SetStringField(TEXT("File"), File);
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Stats));
+	return bSuccess ? 0 : 1;
+}
+
+int32 USSVoiceCultureCommandlet::RunImportMappings(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	FString File;
+	if (!FParse::Value(*Params, TEXT("File="), File))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] ImportMappings needs -File=<Path.csv|Path.jsonl>"));
+		return 1;
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("Workers="), Options.NumWorkers);
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureMappingImportReport Report;
+	const bool bSuccess = FSSVoiceCultureUtils::ImportVoiceCultureMappings(File, !FParse::Param(*Params, TEXT("DryRun")), Options, Report);
+	FSSVoiceCultureUtils::SaveMappingImportReport(Report);
+
+	Result->SetNumberField(TEXT("RowsRead"), Report.RowsRead);
+	Result->SetNumberField(TEXT("RowsInvalid"), Report.RowsInvalid);
+	Result->SetNumberField(TEXT("EntriesChanged"), Report.EntriesChanged);
+	Result->SetNumberField(TEXT("Errors"), Report.NumErrors);
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return bSuccess ? 0 : 1;
+}
+
+int32 USSVoiceCultureCommandlet::RunCreateWrappers(const FString& Params, TSharedRef<FJsonObject> Result)
+{
+	const USSVoiceCultureStrategy* Strategy = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>()->GetActiveStrategy();
+	if (!IsValid(Strategy) || !Strategy->GetClass()->HasAnyClassFlags(CLASS_Native))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] CreateWrappers needs a native voice strategy"));
+		return 1;
+	}
+
+	FString Path;
+	if (!FParse::Value(*Params, TEXT("Path="), Path))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] CreateWrappers needs -Path=/Game/..."));
+		return 1;
+	}
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+	Options.bForceSave = !FParse::Param(*Params, TEXT("NoSave"));
+	Options.bCollectGarbageBetweenBatches = true;
+	FParse::Value(*Params, TEXT("Workers="), Options.NumWorkers);
+	FParse::Value(*Params, TEXT("BatchSize="), Options.BatchSize);
+
+	FSSVoiceCultureWrapperReport Report;
+	const bool bSuccess = FSSVoiceCultureUtils::CreateMissingVoiceCultureWrappers(
+		*Strategy, Path, !FParse::Param(*Params, TEXT("DryRun")), Options, Report);
+	FSSVoiceCultureUtils::SaveWrapperReport(Report);
+
+	Result->SetBoolField(TEXT("Applied"), Report.bApplied);
+	Result->SetNumberField(TEXT("Created"), Report.Created.Num());
+	Result->SetNumberField(TEXT("Entries"), Report.NumEntries);
+	Result->SetNumberField(TEXT("Conflicts"), Report.Conflicts.Num());
+	Result->SetObjectField(TEXT("Stats"), FJsonObjectConverter::UStructToJsonObject(Report.Stats));
+	return bSuccess ? 0 : 1;
+}
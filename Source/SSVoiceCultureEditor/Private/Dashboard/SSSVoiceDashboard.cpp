@@ -14,11 +14,13 @@
 #include "SSVoiceCultureSettings.h"
 #include "WorkspaceMenuStructure.h"
 #include "WorkspaceMenuStructureModule.h"
+#include "Async/Async.h"
 #include "Dom/JsonValue.h"
 #include "Misc/FileHelper.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Serialization/JsonSerializer.h"
 #include "Slate/SSVoiceCultureSlateComponents.h"
+#include "Utils/SSVoiceCultureJob.h"
 #include "Utils/SSVoiceCultureUI.h"
 #include "Utils/SSVoiceCultureUtils.h"
 #include "Widgets/Layout/SExpandableArea.h"
@@ -36,9 +38,13 @@ void SSSVoiceDashboard::Construct(const FArguments& InArgs, const TSharedPtr<SWi
 {
 	// Load report
 	FSSVoiceCultureUtils::LoadSavedCultureReport(CultureReport);
+	FSSVoiceCultureUtils::LoadSavedLoudnessReport(LoudnessReport);
 
-	// Load actors
-	LoadActorListFromJson();
+	// Search index is built in the background, ready by the time the user types
+	if (auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>())
+	{
+		VLEditorSubsystem->BuildVoiceAssetIndexAsync();
+	}
 
 	// Instantiated TabManager layout in memory (non attaché à un level editor)
 	TSharedRef<FTabManager::FLayout> Layout = FTabManager::NewLayout("SSSVoiceDashboardLayout_v1")
@@ -79,6 +85,11 @@ void SSSVoiceDashboard::Construct(const FArguments& InArgs, const TSharedPtr<SWi
 		[
 			BuildToolbar()
 		]
+		// --- Running job
+		+ SVerticalBox::Slot().AutoHeight().Padding(4, 0)
+		[
+			BuildJobProgressStrip()
+		]
 		// --- Tabs
 		+ SVerticalBox::Slot().FillHeight(1.f)
 		[
@@ -87,6 +98,10 @@ void SSSVoiceDashboard::Construct(const FArguments& InArgs, const TSharedPtr<SWi
 	];
 
 	RefreshCoverageSection();
+	RefreshLoudnessSection();
+
+	// Actors are loaded after the first paint
+	RequestActorListUpdate();
 }
 
 TSharedRef<SWidget> SSSVoiceDashboard::BuildToolbar()
@@ -102,6 +117,87 @@ TSharedRef<SWidget> SSSVoiceDashboard::BuildToolbar()
 	return ToolbarBuilder.MakeWidget();
 }
 
+TSharedRef<SWidget> SSSVoiceDashboard::BuildJobProgressStrip()
+{
+	return SNew(SHorizontalBox)
+		.Visibility(this, &SSSVoiceDashboard::GetJobProgressVisibility)
+
+		// Progress bar with overlayed status text
+		+ SHorizontalBox::Slot().FillWidth(1.0f).VAlign(VAlign_Center).Padding(4)
+		[
+			SNew(SOverlay)
+			+ SOverlay::Slot()
+			[
+				SNew(SProgressBar)
+				.Percent(this, &SSSVoiceDashboard::GetJobProgress)
+			]
+			+ SOverlay::Slot()
+			.HAlign(HAlign_Center)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SSSVoiceDashboard::GetJobStatusText)
+				.ColorAndOpacity(FSlateColor::UseForeground())
+			]
+		]
+
+		// Cancel button
+		+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+		[
+			SNew(SButton)
+			.Text(NSLOCTEXT("SSVoiceCultureEditor", "CancelJobBtn", "Cancel"))
+			.OnClicked(this, &SSSVoiceDashboard::OnClick_CancelJob)
+		];
+}
+
+bool SSSVoiceDashboard::StartJob(const TSharedRef<FSSVoiceCultureJob>& Job)
+{
+	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	if (!VLEditorSubsystem->StartJob(Job))
+	{
+		FSSVoiceCultureUI::NotifyFailure(NSLOCTEXT("SSVoiceCultureEditor", "JobAlreadyRunning",
+		                                           "Another voice culture operation is still running."));
+		return false;
+	}
+	return true;
+}
+
+bool SSSVoiceDashboard::CanStartJob() const
+{
+	const auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	return !VLEditorSubsystem->IsJobRunning();
+}
+
+EVisibility SSSVoiceDashboard::GetJobProgressVisibility() const
+{
+	return CanStartJob() ? EVisibility::Collapsed : EVisibility::Visible;
+}
+
+TOptional<float> SSSVoiceDashboard::GetJobProgress() const
+{
+	const auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	const TSharedPtr<FSSVoiceCultureJob> Job = VLEditorSubsystem->GetActiveJob();
+	return Job.IsValid() ? Job->GetProgress() : 0.f;
+}
+
+FText SSSVoiceDashboard::GetJobStatusText() const
+{
+	const auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	const TSharedPtr<FSSVoiceCultureJob> Job = VLEditorSubsystem->GetActiveJob();
+	if (!Job.IsValid())
+		return FText::GetEmpty();
+
+	return FText::Format(NSLOCTEXT("SSVoiceCultureEditor", "JobStatus", "{0}  {1}  ({2}%)"),
+	                     Job->GetTitle(), Job->GetStatusText(), FText::AsNumber(FMath::RoundToInt(Job->GetProgress() * 100.f)));
+}
+
+FReply SSSVoiceDashboard::OnClick_CancelJob()
+{
+	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	VLEditorSubsystem->CancelActiveJob();
+	return FReply::Handled();
+}
+
 USSVoiceCultureStrategy* SSSVoiceDashboard::GetStrategy() const
 {
 	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
@@ -141,83 +237,161 @@ void SSSVoiceDashboard::OpenAutoPopulateConfirmationDialog(const FString& Cultur
 	{
 		UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Auto-populate confirmed for culture: %s"), *Culture);
 
-		AsyncTask(ENamedThreads::GameThread, [this, Culture]()
+		const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+
+		// Runs in the background, regenerate the report once done to refresh voice culture coverage
+		TWeakPtr<SSSVoiceDashboard> WeakThis = SharedThis(this);
+		StartJob(FSSVoiceCultureUtils::MakeAutoPopulateCultureJob(
+			Culture, EditorSettings->bAutoPopulateOverwriteExisting, [WeakThis](bool bCancelled)
+			{
+				if (TSharedPtr<SSSVoiceDashboard> Dashboard = WeakThis.Pin())
+				{
+					Dashboard->OnGenerateReportClicked();
+				}
+			}));
+	}
+}
+
+namespace
+{
+	/** Reads Saved/SSVoiceCulture/VoiceActors.json, an array of strings */
+	bool ReadActorNamesFromJson(TArray<FString>& OutNames)
+	{
+		// Build the full path to the actor list JSON file
+		const FString JsonPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/VoiceActors.json");
+		FString JsonRaw;
+
+		// Attempt to load the file contents into a string
+		if (!FFileHelper::LoadFileToString(JsonRaw, *JsonPath))
 		{
-			const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
-			
-			int32 ModifiedCount = FSSVoiceCultureUtils::AutoPopulateCulture(Culture, EditorSettings->bAutoPopulateOverwriteExisting);
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Failed to read actor list JSON at %s"), *JsonPath);
+			return false;
+		}
 
-			UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Modified voice: %d"), ModifiedCount);
+		// Parse the raw JSON string into a JSON value
+		TSharedPtr<FJsonValue> RootValue;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonRaw);
 
-			// Force regenerate report end refresh voice culture coverage
-			OnGenerateReportClicked();
-		});
+		if (!FJsonSerializer::Deserialize(Reader, RootValue) || !RootValue.IsValid())
+		{
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Failed to parse actor list JSON"));
+			return false;
+		}
+
+		// Ensure the root of the JSON is an array
+		if (RootValue->Type != EJson::Array)
+		{
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Expected root JSON to be an array"));
+			return false;
+		}
+
+		// Extract actor names from the JSON array
+		const TArray<TSharedPtr<FJsonValue>>& JsonArray = RootValue->AsArray();
+		OutNames.Reserve(JsonArray.Num());
+		for (const TSharedPtr<FJsonValue>& Value : JsonArray)
+		{
+			if (Value.IsValid() && Value->Type == EJson::String)
+			{
+				OutNames.Add(Value->AsString());
+			}
+		}
+		return true;
 	}
 }
 
 void SSSVoiceDashboard::LoadActorListFromJson()
 {
-	// Clear the previous list of actors
-	AllActorItems.Empty();
+	bActorListLoaded = true;
 
-	// Build the full path to the actor list JSON file
-	const FString JsonPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/VoiceActors.json");
-	FString JsonRaw;
+	TArray<FString> ActorNames;
+	const bool bLoaded = ReadActorNamesFromJson(ActorNames);
 
-	// Attempt to load the file contents into a string
-	if (!FFileHelper::LoadFileToString(JsonRaw, *JsonPath))
-	{
-		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Failed to read actor list JSON at %s"), *JsonPath);
-		return;
-	}
-	
-	// Parse the raw JSON string into a JSON value
-	TSharedPtr<FJsonValue> RootValue;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonRaw);
+	// Replace rows, the current search is applied again
+	ActorList.SetNames(MoveTemp(ActorNames));
 
-	if (!FJsonSerializer::Deserialize(Reader, RootValue) || !RootValue.IsValid())
+	// Row pointers changed, drop the generated widgets
+	if (ActorListView.IsValid())
 	{
-		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Failed to parse actor list JSON"));
-		return;
+		ActorListView->RebuildList();
 	}
 
-	// Ensure the root of the JSON is an array
-	if (RootValue->Type != EJson::Array)
-	{
-		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Expected root JSON to be an array"));
+	if (!bLoaded)
 		return;
-	}
 
-	// Extract actor names from the JSON array and populate the list
-	const TArray<TSharedPtr<FJsonValue>>& JsonArray = RootValue->AsArray();
-	for (const TSharedPtr<FJsonValue>& Value : JsonArray)
+	// Per-actor details are filled progressively from the registry, queried off the game thread where only
+	// on-disk assets may be read (GetAllLocalizeVoiceSoundAssets sets the filter), unsaved lines show on the next load
+	const int32 QueryId = ++ActorAssetsQueryId;
+	TWeakPtr<SSSVoiceDashboard> WeakThis = SharedThis(this);
+	Async(EAsyncExecution::ThreadPool, [WeakThis, QueryId]()
 	{
-		if (Value.IsValid() && Value->Type == EJson::String)
+		TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, QueryId, VoiceAssets = MoveTemp(VoiceAssets)]() mutable
 		{
-			AllActorItems.Add(MakeShared<FString>(Value->AsString()));
-		}
-	}
+			TSharedPtr<SSSVoiceDashboard> Dashboard = WeakThis.Pin();
+			if (!Dashboard.IsValid() || Dashboard->ActorAssetsQueryId != QueryId)
+				return;
+
+			const USSVoiceCultureSettings* VoiceCultureSettings = USSVoiceCultureSettings::GetSetting();
+			Dashboard->ActorList.BeginFillDetails(Dashboard->GetStrategy(), MoveTemp(VoiceAssets),
+			                                      VoiceCultureSettings->SupportedVoiceCultures.Num());
+			Dashboard->RequestActorListUpdate();
+		});
+	});
+}
 
-	// Apply current search filter to the loaded list
-	RefreshActorFilter();
-	
-	// Refresh the UI list view to reflect changes
-	if (ActorListView.IsValid())
+void SSSVoiceDashboard::RequestActorListUpdate()
+{
+	if (bActorListTimerActive)
+		return;
+
+	bActorListTimerActive = true;
+	RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SSSVoiceDashboard::UpdateActorListProgressive));
+}
+
+EActiveTimerReturnType SSSVoiceDashboard::UpdateActorListProgressive(double InCurrentTime, float InDeltaTime)
+{
+	if (!bActorListLoaded)
 	{
-		ActorListView->RequestListRefresh();
+		// SetNames applies the current search
+		LoadActorListFromJson();
 	}
+
+	// A few milliseconds per frame keep the tab responsive
+	const bool bDone = ActorList.FillDetails(0.004);
+
+	if (!bDone)
+		return EActiveTimerReturnType::Continue;
+
+	bActorListTimerActive = false;
+	return EActiveTimerReturnType::Stop;
 }
 
 void SSSVoiceDashboard::RefreshActorFilter()
 {
-	FilteredActorItems.Empty();
+	// Ranked fuzzy results from the voice asset index, plain substring match until it is built
+	TArray<FSSVoiceSearchResult> Results;
+	if (!ActorSearchFilter.IsEmpty())
+	{
+		if (auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>())
+		{
+			VLEditorSubsystem->SearchVoiceAssets(ActorSearchFilter, ESSVoiceSearchKind::Actor, 500, Results);
+		}
+	}
 
-	for (const TSharedPtr<FString>& Item : AllActorItems)
+	if (Results.Num() > 0)
 	{
-		if (ActorSearchFilter.IsEmpty() || Item->Contains(ActorSearchFilter, ESearchCase::IgnoreCase))
+		TArray<FString> RankedNames;
+		RankedNames.Reserve(Results.Num());
+		for (const FSSVoiceSearchResult& Result : Results)
 		{
-			FilteredActorItems.Add(Item);
+			RankedNames.Add(Result.Text);
 		}
+		ActorList.SetRankedFilter(RankedNames);
+	}
+	else
+	{
+		ActorList.SetSearch(ActorSearchFilter);
 	}
 
 	if (ActorListView.IsValid())
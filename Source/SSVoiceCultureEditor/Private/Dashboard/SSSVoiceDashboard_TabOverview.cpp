@@ -10,6 +10,9 @@
 #include "SSVoiceCultureEditorLog.h"
 #include "SSVoiceCultureEditorSubsystem.h"
 #include "SSVoiceStyleCompat.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/MessageDialog.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
 #include "Slate/SSVoiceCultureSlateComponents.h"
 #include "Utils/SSVoiceCultureUI.h"
 #include "Widgets/Notifications/SProgressBar.h"
@@ -184,6 +187,16 @@ TSharedRef<SWidget> SSSVoiceDashboard::BuildRightPanel()
 			+ SVerticalBox::Slot().AutoHeight().Padding(6)
 			[
 				BuildCoverageSection()
+			]
+			// --- Loudness
+			+ SVerticalBox::Slot().AutoHeight().Padding(6)
+			[
+				BuildLoudnessSection()
+			]
+			// --- Duration mismatches
+			+ SVerticalBox::Slot().AutoHeight().Padding(6)
+			[
+				BuildDurationSection()
 			];
 }
 
@@ -244,6 +257,7 @@ TSharedRef<ITableRow> SSSVoiceDashboard::OnGenerateCultureRow(TSharedPtr<FSSVoic
 			[
 				SNew(SButton)
 				.Text(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateCultureBtn", "Auto populate"))
+				.IsEnabled(this, &SSSVoiceDashboard::CanStartJob)
 				.OnClicked_Lambda([this, Culture = Entry->Culture]()
 				{
 					UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Requested AutoPopulate for culture: %s"), *Culture);
@@ -283,6 +297,7 @@ TSharedRef<SWidget> SSSVoiceDashboard::BuildCoverageSection()
 				.Text(NSLOCTEXT("SSVoiceCultureEditor", "RegenerateReportBtn", "Generate Report"))
 				.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "RegenerateReportTooltip",
 				                       "Scan all voice assets and generate the latest culture coverage report."))
+				.IsEnabled(this, &SSSVoiceDashboard::CanStartJob)
 				.OnClicked(this, &SSSVoiceDashboard::OnGenerateReportClicked)
 			]
 		]
@@ -324,45 +339,399 @@ void SSSVoiceDashboard::RefreshCoverageSection()
 
 FReply SSSVoiceDashboard::OnGenerateReportClicked()
 {
-	// Create a slow task to inform the user (runs on Game Thread)
-	TSharedPtr<FScopedSlowTask> SlowTask = MakeShared<FScopedSlowTask>(
-		1.f,
-		NSLOCTEXT("SSVoiceCultureEditor", "ScanningCultures", "Scanning voice cultures...")
-	);
+	// Shared report object filled by the background job
+	TSharedRef<FSSVoiceCultureReport> Report = MakeShared<FSSVoiceCultureReport>();
+
+	TWeakPtr<SSSVoiceDashboard> WeakThis = SharedThis(this);
+	StartJob(FSSVoiceCultureUtils::MakeCoverageReportJob(Report, [WeakThis, Report](bool bCancelled)
+	{
+		TSharedPtr<SSSVoiceDashboard> Dashboard = WeakThis.Pin();
+		if (!Dashboard.IsValid() || bCancelled)
+			return;
+
+		// Update internal state with the generated report, then refresh UI
+		Dashboard->CultureReport = *Report;
+		Dashboard->RefreshCoverageSection();
+	}));
+
+	return FReply::Handled();
+}
+
+////////////////////////////////////////////////////////////////////
+// Loudness section
+
+TSharedRef<ITableRow> SSSVoiceDashboard::OnGenerateLoudnessRow(TSharedPtr<FSSVoiceCultureLoudnessCulture> Entry,
+                                                               const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const bool bReference = Entry->Culture == LoudnessReport.ReferenceCulture;
+
+	// Cultures with lines off the reference stand out
+	const FSlateColor DeviationColor = Entry->Deviating > 0
+		                                   ? FSlateColor(FLinearColor(1.f, 0.6f, 0.1f))
+		                                   : FSlateColor::UseForeground();
+
+	return SNew(STableRow<TSharedPtr<FSSVoiceCultureLoudnessCulture>>, OwnerTable)
+		[
+			SNew(SHorizontalBox)
+
+			// Culture name
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(SBox)
+				.WidthOverride(150.f)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(FSSVoiceCultureUI::CultureAsDisplay(Entry->Culture)))
+					.OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+				]
+			]
+
+			// Deviation from the reference culture
+			+ SHorizontalBox::Slot().FillWidth(1.0f).VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(STextBlock)
+				.Text(bReference
+					      ? FText::Format(
+						      NSLOCTEXT("SSVoiceCultureEditor", "LoudnessReferenceRow", "Reference  ({0} sounds)"),
+						      FText::AsNumber(Entry->Analyzed))
+					      : FText::Format(
+						      NSLOCTEXT("SSVoiceCultureEditor", "LoudnessDeviationRow",
+						                "{0} / {1} lines off the reference  (mean {2} LU)"),
+						      FText::AsNumber(Entry->Deviating), FText::AsNumber(Entry->Analyzed),
+						      FText::FromString(FString::Printf(TEXT("%+.1f"), Entry->MeanDeviation))))
+				.ColorAndOpacity(DeviationColor)
+			]
+
+			// Silence that trimming would remove
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(STextBlock)
+				.Text(FText::Format(NSLOCTEXT("SSVoiceCultureEditor", "LoudnessTrimmableRow", "{0} s of silence"),
+				                    FText::FromString(FString::Printf(TEXT("%.1f"), Entry->TrimmableSeconds))))
+				.TextStyle(SSVoiceStyleCompat::Get(), "HintText")
+			]
+		];
+}
+
+TSharedRef<SWidget> SSSVoiceDashboard::BuildLoudnessSection()
+{
+	return SNew(SVerticalBox)
 
-	SlowTask->MakeDialog(true);
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(STextBlock)
+				.Text(NSLOCTEXT("SSVoiceCultureEditor", "LoudnessTitle", "Loudness & Silence"))
+				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4, 0)
+			[
+				SNew(SButton)
+				.Text(NSLOCTEXT("SSVoiceCultureEditor", "AnalyzeLoudnessBtn", "Analyze"))
+				.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "AnalyzeLoudnessTooltip",
+				                       "Measure the loudness, peak and silence of every culture sound and compare each culture to the reference culture."))
+				.IsEnabled(this, &SSSVoiceDashboard::CanStartJob)
+				.OnClicked(this, &SSSVoiceDashboard::OnClick_AnalyzeLoudness)
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4, 0)
+			[
+				SNew(SButton)
+				.Text(NSLOCTEXT("SSVoiceCultureEditor", "TrimSilenceBtn", "Trim Silence"))
+				.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "TrimSilenceTooltip",
+				                       "Cut the leading and trailing silence of the analyzed culture sounds, keeping the padding of the editor settings."))
+				.IsEnabled_Lambda([this]()
+				{
+					return CanStartJob() && LoudnessReport.Trimmable.Num() > 0;
+				})
+				.OnClicked(this, &SSSVoiceDashboard::OnClick_TrimSilence)
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4, 0)
+			[
+				SNew(SButton)
+				.Text(NSLOCTEXT("SSVoiceCultureEditor", "ApplyAudioProfilesBtn", "Apply Audio Profiles"))
+				.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "ApplyAudioProfilesTooltip",
+				                       "Apply the culture audio profiles of the editor settings (compression, loading behavior, sample rate) to every culture sound."))
+				.IsEnabled_Lambda([this]()
+				{
+					return CanStartJob() && USSVoiceCultureEditorSettings::GetSetting()->CultureAudioProfiles.Num() > 0;
+				})
+				.OnClicked(this, &SSSVoiceDashboard::OnClick_ApplyAudioProfiles)
+			]
+			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center).Padding(8, 0)
+			[
+				SNew(STextBlock)
+				.Text(this, &SSSVoiceDashboard::GetLoudnessSummaryText)
+				.TextStyle(SSVoiceStyleCompat::Get(), "HintText")
+			]
+		]
 
-	// Create a shared report object to pass between threads
-	TSharedRef<FSSVoiceCultureReport, ESPMode::ThreadSafe> Report = MakeShared<
-		FSSVoiceCultureReport, ESPMode::ThreadSafe>();
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SSeparator)
+		]
 
-	// Launch the heavy operation asynchronously
-	AsyncTask(ENamedThreads::GameThread, [this, Report, SlowTask]()
+		+ SVerticalBox::Slot().AutoHeight().Padding(2)
+		[
+			SAssignNew(LoudnessListView, SListView<TSharedPtr<FSSVoiceCultureLoudnessCulture>>)
+			.ItemHeight(30)
+			.ListItemsSource(&LoudnessListData)
+			.SelectionMode(ESelectionMode::None)
+			.OnGenerateRow(this, &SSSVoiceDashboard::OnGenerateLoudnessRow)
+		];
+}
+
+FText SSSVoiceDashboard::GetLoudnessSummaryText() const
+{
+	if (LoudnessReport.Cultures.Num() == 0)
+		return NSLOCTEXT("SSVoiceCultureEditor", "LoudnessNotAnalyzed", "Not analyzed yet.");
+
+	return FText::Format(
+		NSLOCTEXT("SSVoiceCultureEditor", "LoudnessSummary",
+		          "Reference: {0}, tolerance {1} LU. {2} voice assets with silence to trim."),
+		FText::FromString(LoudnessReport.ReferenceCulture.ToUpper()), FText::AsNumber(LoudnessReport.ToleranceLU),
+		FText::AsNumber(LoudnessReport.Trimmable.Num()));
+}
+
+void SSSVoiceDashboard::RefreshLoudnessSection()
+{
+	LoudnessListData.Reset();
+
+	for (const FSSVoiceCultureLoudnessCulture& Entry : LoudnessReport.Cultures)
 	{
-		// Run the time-consuming report generation
-		FSSVoiceCultureUtils::GenerateCultureCoverageReport(*Report);
+		LoudnessListData.Add(MakeShared<FSSVoiceCultureLoudnessCulture>(Entry));
+	}
 
-		// Once complete, schedule the UI update on the Game Thread
-		FFunctionGraphTask::CreateAndDispatchWhenReady([this, Report, SlowTask]()
+	if (LoudnessListView.IsValid())
+	{
+		LoudnessListView->RequestListRefresh();
+	}
+}
+
+FReply SSSVoiceDashboard::OnClick_AnalyzeLoudness()
+{
+	TSharedRef<FSSVoiceCultureLoudnessReport> Report = MakeShared<FSSVoiceCultureLoudnessReport>();
+
+	TWeakPtr<SSSVoiceDashboard> WeakThis = SharedThis(this);
+	StartJob(FSSVoiceCultureUtils::MakeLoudnessAnalysisJob(Report, [WeakThis, Report](bool bCancelled)
+	{
+		TSharedPtr<SSSVoiceDashboard> Dashboard = WeakThis.Pin();
+		if (!Dashboard.IsValid() || bCancelled)
+			return;
+
+		Dashboard->LoudnessReport = *Report;
+		Dashboard->RefreshLoudnessSection();
+	}));
+
+	return FReply::Handled();
+}
+
+FReply SSSVoiceDashboard::OnClick_TrimSilence()
+{
+	const EAppReturnType::Type Result = FMessageDialog::Open(
+		EAppMsgType::YesNo,
+		FText::Format(NSLOCTEXT("SSVoiceCultureEditor", "ConfirmTrimSilenceText",
+		                        "Trim the leading and trailing silence of the culture sounds of {0} voice assets?\n"
+		                        "The source audio of these sounds is replaced. This operation cannot be undone."),
+		              FText::AsNumber(LoudnessReport.Trimmable.Num())));
+	if (Result != EAppReturnType::Yes)
+		return FReply::Handled();
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	TArray<FAssetData> VoiceAssets;
+	for (const FString& AssetPath : LoudnessReport.Trimmable)
+	{
+		const FAssetData VoiceAsset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+		if (VoiceAsset.IsValid())
 		{
-			// Update internal state with the generated report
-			CultureReport = *Report;
+			VoiceAssets.Add(VoiceAsset);
+		}
+	}
 
-			// Mark progress complete if needed
-			if (SlowTask.IsValid())
-			{
-				SlowTask->EnterProgressFrame(1.f);
-			}
+	FSSVoiceCultureBatchOptions Options;
+	Options.bForceSave = USSVoiceCultureEditorSettings::GetSetting()->bAutoSaveAfterAutoPopulate;
+
+	FSSVoiceCultureOperationStats Stats;
+	const int32 TrimmedSounds = FSSVoiceCultureUtils::TrimCultureSilence(VoiceAssets, Options, Stats);
+	FSSVoiceCultureUI::NotifySuccess(FText::Format(
+		NSLOCTEXT("SSVoiceCultureEditor", "TrimSilenceDone", "{0} culture sounds trimmed."),
+		FText::AsNumber(TrimmedSounds)));
+
+	// Trimmed voice assets hold their new analysis
+	FSSVoiceCultureLoudnessReport Report;
+	FSSVoiceCultureUtils::BuildLoudnessReport(USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets(), Report);
+	FSSVoiceCultureUtils::SaveLoudnessReport(Report);
+	LoudnessReport = MoveTemp(Report);
+	RefreshLoudnessSection();
+	return FReply::Handled();
+}
+
+FReply SSSVoiceDashboard::OnClick_ApplyAudioProfiles()
+{
+	const EAppReturnType::Type Result = FMessageDialog::Open(
+		EAppMsgType::YesNo,
+		FText::Format(NSLOCTEXT("SSVoiceCultureEditor", "ConfirmApplyAudioProfilesText",
+		                        "Apply {0} culture audio profiles to every culture sound?\n"
+		                        "Modified sounds are recompressed, this can take a while."),
+		              FText::AsNumber(USSVoiceCultureEditorSettings::GetSetting()->CultureAudioProfiles.Num())));
+	if (Result != EAppReturnType::Yes)
+		return FReply::Handled();
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bForceSave = USSVoiceCultureEditorSettings::GetSetting()->bAutoSaveAfterAutoPopulate;
+
+	FSSVoiceCultureAudioProfileReport Report;
+	FSSVoiceCultureUtils::ApplyCultureAudioProfiles(true, Options, Report);
+	FSSVoiceCultureUtils::SaveAudioProfileReport(Report);
+
+	int32 Modified = 0;
+	int64 BytesBefore = 0;
+	int64 BytesAfter = 0;
+	for (const FSSVoiceCultureAudioProfileCulture& Culture : Report.Cultures)
+	{
+		Modified += Culture.Modified;
+		BytesBefore += Culture.BytesBefore;
+		BytesAfter += Culture.BytesAfter;
+	}
+
+	FSSVoiceCultureUI::NotifySuccess(FText::Format(
+		NSLOCTEXT("SSVoiceCultureEditor", "ApplyAudioProfilesDone", "{0} culture sounds updated ({1} -> ~{2} estimated)."),
+		FText::AsNumber(Modified), FText::AsMemory(BytesBefore), FText::AsMemory(BytesAfter)));
+	return FReply::Handled();
+}
+
+////////////////////////////////////////////////////////////////////
+// Duration section
 
-			// Notify the user of success
-			FSSVoiceCultureUI::NotifySuccess(
-				NSLOCTEXT("SSVoiceCultureEditor", "ScanningCulturesSuccess", "Successfully scanned voice cultures."));
+TSharedRef<ITableRow> SSSVoiceDashboard::OnGenerateDurationMismatchRow(TSharedPtr<FSSVoiceCultureDurationMismatch> Entry,
+                                                                       const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<TSharedPtr<FSSVoiceCultureDurationMismatch>>, OwnerTable)
+		[
+			SNew(SHorizontalBox)
 
-			// Refresh UI with new report data
-			RefreshCoverageSection();
-		}, TStatId(), nullptr, ENamedThreads::GameThread);
-	});
+			// Voice asset
+			+ SHorizontalBox::Slot().FillWidth(1.0f).VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromName(Entry->VoiceAsset.AssetName))
+				.ToolTipText(FText::FromString(Entry->VoiceAsset.GetObjectPathString()))
+				.OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+			]
 
+			// Culture
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(SBox)
+				.WidthOverride(150.f)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(FSSVoiceCultureUI::CultureAsDisplay(Entry->Culture)))
+					.OverflowPolicy(ETextOverflowPolicy::Ellipsis)
+				]
+			]
+
+			// Durations and ratio
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(FString::Printf(TEXT("%.2f s / %.2f s  (x%.2f)"), Entry->Duration,
+				                                        Entry->ReferenceDuration, Entry->GetRatio())))
+				.TextStyle(SSVoiceStyleCompat::Get(), "HintText")
+			]
+		];
+}
+
+TSharedRef<SWidget> SSSVoiceDashboard::BuildDurationSection()
+{
+	return SNew(SVerticalBox)
+
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SHorizontalBox)
+
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4)
+			[
+				SNew(STextBlock)
+				.Text(NSLOCTEXT("SSVoiceCultureEditor", "DurationTitle", "Duration Mismatches"))
+				.Font(FCoreStyle::GetDefaultFontStyle("Bold", 14))
+			]
+			+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(4, 0)
+			[
+				SNew(SButton)
+				.Text(NSLOCTEXT("SSVoiceCultureEditor", "FindDurationMismatchesBtn", "Find"))
+				.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "FindDurationMismatchesTooltip",
+				                       "List the culture sounds much longer or shorter than the reference culture (editor settings), from registry data only."))
+				.OnClicked(this, &SSSVoiceDashboard::OnClick_FindDurationMismatches)
+			]
+			+ SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center).Padding(8, 0)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this]()
+				{
+					return DurationSummaryText;
+				})
+				.TextStyle(SSVoiceStyleCompat::Get(), "HintText")
+			]
+		]
+
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SSeparator)
+		]
+
+		+ SVerticalBox::Slot().AutoHeight().Padding(2)
+		[
+			SNew(SBox)
+			.MaxDesiredHeight(300.f)
+			[
+				SAssignNew(DurationMismatchListView, SListView<TSharedPtr<FSSVoiceCultureDurationMismatch>>)
+				.ItemHeight(24)
+				.ListItemsSource(&DurationMismatchData)
+				.SelectionMode(ESelectionMode::Single)
+				.OnGenerateRow(this, &SSSVoiceDashboard::OnGenerateDurationMismatchRow)
+				.OnMouseButtonDoubleClick_Lambda([](TSharedPtr<FSSVoiceCultureDurationMismatch> Entry)
+				{
+					TArray<FAssetData> Assets;
+					Assets.Add(Entry->VoiceAsset);
+					GEditor->SyncBrowserToObjects(Assets);
+				})
+			]
+		];
+}
+
+FReply SSSVoiceDashboard::OnClick_FindDurationMismatches()
+{
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Registry tags only, fast enough to run on the game thread
+	const TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	TArray<FSSVoiceCultureDurationMismatch> Mismatches;
+	FSSVoiceCultureUtils::FindDurationMismatches(VoiceAssets, EditorSettings->ReferenceCulture,
+	                                             EditorSettings->DurationMismatchRatio, FSSVoiceCultureBatchOptions(),
+	                                             Mismatches);
+
+	DurationMismatchData.Reset(Mismatches.Num());
+	for (FSSVoiceCultureDurationMismatch& Mismatch : Mismatches)
+	{
+		DurationMismatchData.Add(MakeShared<FSSVoiceCultureDurationMismatch>(MoveTemp(Mismatch)));
+	}
+
+	DurationSummaryText = FText::Format(
+		NSLOCTEXT("SSVoiceCultureEditor", "DurationSummary",
+		          "{0} culture sounds off {1} by more than x{2} ({3} lines scanned in {4} ms)."),
+		FText::AsNumber(DurationMismatchData.Num()), FText::FromString(EditorSettings->ReferenceCulture.ToUpper()),
+		FText::AsNumber(EditorSettings->DurationMismatchRatio), FText::AsNumber(VoiceAssets.Num()),
+		FText::AsNumber(FMath::RoundToInt((FPlatformTime::Seconds() - StartTime) * 1000.0)));
+
+	if (DurationMismatchListView.IsValid())
+	{
+		DurationMismatchListView->RequestListRefresh();
+	}
 	return FReply::Handled();
 }
 
@@ -75,6 +75,7 @@ TSharedRef<SWidget> SSSVoiceDashboard::BuildActorList()
 			[
 				SNew(SButton)
 				.Text(FText::FromString("Rescan Actors"))
+				.IsEnabled(this, &SSSVoiceDashboard::CanStartJob)
 				.OnClicked(this, &SSSVoiceDashboard::OnClick_RescanActors)
 			]
 			// Barre de recherche
@@ -95,24 +96,37 @@ TSharedRef<SWidget> SSSVoiceDashboard::BuildActorList()
 			// Liste des acteurs
 			+ SVerticalBox::Slot().FillHeight(1.f).Padding(4)
 			[
-				SAssignNew(ActorListView, SListView<TSharedPtr<FString>>)
+				SAssignNew(ActorListView, SListView<FSSVoiceDashboardActorList::FRow*>)
 				.ItemHeight(24)
-				.ListItemsSource(&FilteredActorItems)
+				.ListItemsSource(&ActorList.GetFiltered())
 				.OnGenerateRow(this, &SSSVoiceDashboard::GenerateActorRow)
 				.SelectionMode(ESelectionMode::Single)
-				.OnSelectionChanged_Lambda([this](TSharedPtr<FString> Item, ESelectInfo::Type)
+				.OnSelectionChanged_Lambda([this](FSSVoiceDashboardActorList::FRow* Item, ESelectInfo::Type)
 				{
-					SelectedActor = Item;
+					if (!Item)
+						return;
+
+					SelectedActorName = Item->Name;
 					// Call refresh voice sound asset list from selected actor
 					RefreshAssetsForSelectedActor();
 				})
 			];
 }
 
-TSharedRef<ITableRow> SSSVoiceDashboard::GenerateActorRow(TSharedPtr<FString> InItem,
+TSharedRef<ITableRow> SSSVoiceDashboard::GenerateActorRow(FSSVoiceDashboardActorList::FRow* InItem,
                                                           const TSharedRef<STableViewBase>& OwnerTable)
 {
-	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
+	// Details arrive progressively, read them through an attribute
+	const TAttribute<FText> DetailsText = TAttribute<FText>::CreateLambda([InItem]()
+	{
+		if (!InItem->HasDetails())
+			return FText::GetEmpty();
+
+		return FText::Format(NSLOCTEXT("SSVoiceCultureEditor", "ActorRowDetails", "{0}/{1}"),
+		                     FText::AsNumber(InItem->NumComplete), FText::AsNumber(InItem->NumAssets));
+	});
+
+	return SNew(STableRow<FSSVoiceDashboardActorList::FRow*>, OwnerTable)
 		[
 			SNew(SBorder)
 			.Padding(2.f)
@@ -143,10 +157,23 @@ TSharedRef<ITableRow> SSSVoiceDashboard::GenerateActorRow(TSharedPtr<FString> In
 					.BorderImage(FCoreStyle::Get().GetBrush("WhiteBrush"))
 					.BorderBackgroundColor(FLinearColor(0.8f, 0.3f, 1.0f, 0.4f)) // Fond violet-rose plus contrasté
 					[
-						SNew(STextBlock)
-						.Text(FText::FromString(*InItem))
-						.Font(FCoreStyle::Get().GetFontStyle("NormalFont"))
-						.ColorAndOpacity(FLinearColor::White)
+						SNew(SHorizontalBox)
+						+ SHorizontalBox::Slot().FillWidth(1.0f).VAlign(VAlign_Center)
+						[
+							SNew(STextBlock)
+							.Text(FText::FromString(InItem->Name))
+							.Font(FCoreStyle::Get().GetFontStyle("NormalFont"))
+							.ColorAndOpacity(FLinearColor::White)
+						]
+						// Complete / total lines
+						+ SHorizontalBox::Slot().AutoWidth().VAlign(VAlign_Center).Padding(8, 0, 0, 0)
+						[
+							SNew(STextBlock)
+							.Text(DetailsText)
+							.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "ActorRowDetailsTooltip",
+							                       "Voice assets with every supported culture / total voice assets"))
+							.ColorAndOpacity(FLinearColor::White.CopyWithNewOpacity(0.7f))
+						]
 					]
 				]
 			]
@@ -156,10 +183,14 @@ TSharedRef<ITableRow> SSSVoiceDashboard::GenerateActorRow(TSharedPtr<FString> In
 ////////////////////////////////////////////////////////////////////
 // Asset List
 
-TSharedRef<ITableRow> SSSVoiceDashboard::GenerateVoiceSoundAssetRow(TSharedPtr<FVoiceCultureAssetDisplayData> InItem,
+TSharedRef<ITableRow> SSSVoiceDashboard::GenerateVoiceSoundAssetRow(const FVoiceCultureAssetDisplayData* InItem,
                                                                     const TSharedRef<STableViewBase>& OwnerTable)
 {
-	return SNew(STableRow<TSharedPtr<FVoiceCultureAssetDisplayData>>, OwnerTable)
+	// Only visible rows get here, cultures are read from the registry tag now rather than stored per row
+	TArray<FString> AvailableCultures = FSSVoiceCultureUtils::GetTaggedCultures(InItem->AssetData).Array();
+	AvailableCultures.Sort();
+
+	return SNew(STableRow<const FVoiceCultureAssetDisplayData*>, OwnerTable)
 		[
 			// Drop shadow border
 			SNew(SBorder)
@@ -192,7 +223,7 @@ TSharedRef<ITableRow> SSSVoiceDashboard::GenerateVoiceSoundAssetRow(TSharedPtr<F
 								+ SHorizontalBox::Slot().FillWidth(1).VAlign(VAlign_Center)
 								[
 									SNew(STextBlock)
-									.Text(FText::FromString(InItem->AssetName))
+									.Text(FText::FromName(InItem->AssetData.AssetName))
 									.Font(FCoreStyle::GetDefaultFontStyle("Bold", 12))
 								]
 
@@ -203,10 +234,10 @@ TSharedRef<ITableRow> SSSVoiceDashboard::GenerateVoiceSoundAssetRow(TSharedPtr<F
 									SNew(STextBlock)
 									.Text(FText::Format(
 										NSLOCTEXT("SSVoiceCultureEditor", "CultureInfo", "{0}/{1} ({2})"),
-										FText::AsNumber(InItem->AvailableCultures.Num()),
+										FText::AsNumber(AvailableCultures.Num()),
 										FText::AsNumber(InItem->TotalCultures),
 										FText::FromString(
-											FString::Join(InItem->AvailableCultures, TEXT(", ")))
+											FString::Join(AvailableCultures, TEXT(", ")))
 									))
 								]
 							]
@@ -236,6 +267,64 @@ void SSSVoiceDashboard::UpdateContentBrowser()
 	DelegateFilter.Execute(Filter);
 }
 
+void SSSVoiceDashboard::RefreshLineFilter()
+{
+	Filter.SoftObjectPaths.Reset();
+
+	if (!LineSearchFilter.IsEmpty())
+	{
+		auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+		if (VLEditorSubsystem && !VLEditorSubsystem->IsVoiceAssetIndexReady())
+		{
+			// Still building in the background: unfiltered for now, searched again once ready
+			VLEditorSubsystem->BuildVoiceAssetIndexAsync();
+			if (!bSearchRefreshPending)
+			{
+				bSearchRefreshPending = true;
+				RegisterActiveTimer(0.25f, FWidgetActiveTimerDelegate::CreateSP(
+					                    this, &SSSVoiceDashboard::RefreshSearchesWhenIndexReady));
+			}
+			UpdateContentBrowser();
+			return;
+		}
+
+		TArray<FSSVoiceSearchResult> Results;
+		if (VLEditorSubsystem)
+		{
+			VLEditorSubsystem->SearchVoiceAssets(LineSearchFilter, ESSVoiceSearchKind::Line, 5000, Results);
+		}
+
+		for (const FSSVoiceSearchResult& Result : Results)
+		{
+			Filter.SoftObjectPaths.Add(Result.AssetPath);
+		}
+
+		// Nothing matches: keep the view empty instead of showing everything
+		if (Filter.SoftObjectPaths.IsEmpty())
+		{
+			Filter.SoftObjectPaths.Add(FSoftObjectPath(TEXT("/None/None.None")));
+		}
+	}
+
+	UpdateContentBrowser();
+}
+
+EActiveTimerReturnType SSSVoiceDashboard::RefreshSearchesWhenIndexReady(double InCurrentTime, float InDeltaTime)
+{
+	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	if (VLEditorSubsystem && !VLEditorSubsystem->IsVoiceAssetIndexReady())
+	{
+		// Also starts the build if the registry scan was still running on the last attempt
+		VLEditorSubsystem->BuildVoiceAssetIndexAsync();
+		return EActiveTimerReturnType::Continue;
+	}
+
+	bSearchRefreshPending = false;
+	RefreshLineFilter();
+	RefreshActorFilter();
+	return EActiveTimerReturnType::Stop;
+}
+
 TSharedPtr<SWidget> SSSVoiceDashboard::OnGetAssetContextMenu(const TArray<FAssetData>& SelectedAssets)
 {
 	if (SelectedAssets.IsEmpty())
@@ -262,7 +351,16 @@ FReply SSSVoiceDashboard::OnClick_AutoPopulateMissingCulture()
 	);
 	if (Result == EAppReturnType::Yes)
 	{
-		FSSVoiceCultureUtils::AutoPopulateFromVoiceActor(FilterActorName->GetVoiceActorName());
+		// Refresh the asset filters once the background job is done
+		TWeakPtr<SSSVoiceDashboard> WeakThis = SharedThis(this);
+		StartJob(FSSVoiceCultureUtils::MakeAutoPopulateFromVoiceActorJob(
+			FilterActorName->GetVoiceActorName(), true, [WeakThis](bool bCancelled)
+			{
+				if (TSharedPtr<SSSVoiceDashboard> Dashboard = WeakThis.Pin())
+				{
+					Dashboard->RefreshAssetsForSelectedActor();
+				}
+			}));
 	}
 
 	return FReply::Handled();
@@ -278,30 +376,15 @@ FReply SSSVoiceDashboard::OnClick_RescanActors()
 
 	if (Result == EAppReturnType::Yes)
 	{
-		// Schedule the generation to run after the current UI event finishes
-		FFunctionGraphTask::CreateAndDispatchWhenReady([this]()
+		// Scan in the background, reload the list once the JSON is written
+		TWeakPtr<SSSVoiceDashboard> WeakThis = SharedThis(this);
+		StartJob(FSSVoiceCultureUtils::MakeRescanActorsJob([WeakThis](bool bCancelled)
 		{
-			// Show progress UI
-			FScopedSlowTask
-				SlowTask(3.f, NSLOCTEXT("SSVoiceCultureEditor", "RescanningActors", "Rescanning actors..."));
-			SlowTask.MakeDialog(true);
-
-			// 1. Generate the actor list
-			SlowTask.EnterProgressFrame(1.f, NSLOCTEXT("SSVoiceCultureEditor", "GeneratingJson", "Generating JSON..."));
-			FSSVoiceCultureUtils::GenerateActorListJson();
-
-			// 2. Load it back into UI or memory
-			SlowTask.EnterProgressFrame(1.f, NSLOCTEXT("SSVoiceCultureEditor", "LoadingJson", "Loading actor list..."));
-
-			// Assuming this is called in context where 'this' is valid (SWidget or similar)
-			this->LoadActorListFromJson();
-
-			// 3. Done
-			SlowTask.EnterProgressFrame(1.f, NSLOCTEXT("SSVoiceCultureEditor", "Complete", "Done."));
-
-			FSSVoiceCultureUI::NotifySuccess(NSLOCTEXT("SSVoiceCultureEditor", "ScanVoiceNameComplete",
-			                                           "Actor voice scan completed."));
-		}, TStatId(), nullptr, ENamedThreads::GameThread);
+			if (TSharedPtr<SSSVoiceDashboard> Dashboard = WeakThis.Pin())
+			{
+				Dashboard->LoadActorListFromJson();
+			}
+		}));
 	}
 	return FReply::Handled();
 }
@@ -394,12 +477,23 @@ TSharedRef<SWidget> SSSVoiceDashboard::BuildAssetList()
 			.Text(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateMissingCultures", "Auto Populate Missing Cultures"))
 			.ToolTipText(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateAssetsInBrowserTooltip",
 			                     "Auto populate all voice assets from content browser"))
+			.IsEnabled(this, &SSSVoiceDashboard::CanStartJob)
 			.OnClicked(this, &SSSVoiceDashboard::OnClick_AutoPopulateMissingCulture)
 		]
 		+ SVerticalBox::Slot().AutoHeight().Padding(3.0f)
 		[
 			SNew(SSeparator).Thickness(5.0f)
 		]
+		+ SVerticalBox::Slot().AutoHeight().Padding(4)
+		[
+			SNew(SSearchBox)
+			.HintText(NSLOCTEXT("SSVoiceCultureEditor", "LineSearchHint", "Search Voice Line (fuzzy)..."))
+			.OnTextChanged_Lambda([this](const FText& NewText)
+			{
+				LineSearchFilter = NewText.ToString().TrimStartAndEnd();
+				RefreshLineFilter();
+			})
+		]
 		+ SVerticalBox::Slot().FillHeight(1.0f).Padding(5.0f)
 		[
 			ContentBrowserView
@@ -436,10 +530,10 @@ void SSSVoiceDashboard::AutoPopulateSelectedAssets()
 
 void SSSVoiceDashboard::RefreshAssetsForSelectedActor()
 {
-	if (!SelectedActor.IsValid())
+	if (SelectedActorName.IsEmpty())
 		return;
 
-	const FString& TargetActor = *SelectedActor;
+	const FString& TargetActor = SelectedActorName;
 
 	// --
 	const double ScanStartTime = FPlatformTime::Seconds();
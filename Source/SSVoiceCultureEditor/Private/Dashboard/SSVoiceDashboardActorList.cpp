@@ -0,0 +1,150 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Dashboard/SSVoiceDashboardActorList.h"
+
+#include "Settings/SSVoiceCultureStrategy.h"
+#include "Utils/SSVoiceCultureUtils.h"
+
+void FSSVoiceDashboardActorList::SetNames(TArray<FString>&& Names)
+{
+	Rows.Reset(Names.Num());
+	RowIndexByName.Reset();
+	RowIndexByName.Reserve(Names.Num());
+
+	for (FString& Name : Names)
+	{
+		if (RowIndexByName.Contains(Name))
+			continue;
+
+		FRow& Row = Rows.AddDefaulted_GetRef();
+		Row.NameLower = Name.ToLower();
+		Row.Name = MoveTemp(Name);
+		RowIndexByName.Add(Row.Name, Rows.Num() - 1);
+	}
+
+	PendingAssets.Reset();
+	PendingCursor = 0;
+
+	RebuildFiltered();
+}
+
+void FSSVoiceDashboardActorList::SetSearch(const FString& InSearch)
+{
+	const FString NewSearchLower = InSearch.ToLower();
+	if (NewSearchLower == SearchLower && !bRankedFilter)
+		return;
+
+	// Typing more characters can only narrow the current results
+	const bool bRefine = !bRankedFilter && !SearchLower.IsEmpty() &&
+		NewSearchLower.StartsWith(SearchLower, ESearchCase::CaseSensitive);
+	SearchLower = NewSearchLower;
+	bRankedFilter = false;
+
+	if (!bRefine)
+	{
+		RebuildFiltered();
+		return;
+	}
+
+	Filtered.RemoveAll([this](const FRow* Row)
+	{
+		return !Row->NameLower.Contains(SearchLower, ESearchCase::CaseSensitive);
+	});
+}
+
+void FSSVoiceDashboardActorList::SetRankedFilter(const TArray<FString>& RankedNames)
+{
+	bRankedFilter = true;
+	Filtered.Reset(RankedNames.Num());
+
+	for (const FString& Name : RankedNames)
+	{
+		if (FRow* Row = FindRow(Name))
+		{
+			Filtered.Add(Row);
+		}
+	}
+}
+
+FSSVoiceDashboardActorList::FRow* FSSVoiceDashboardActorList::FindRow(const FString& Name)
+{
+	const int32* Index = RowIndexByName.Find(Name);
+	return Index ? &Rows[*Index] : nullptr;
+}
+
+void FSSVoiceDashboardActorList::RebuildFiltered()
+{
+	Filtered.Reset(Rows.Num());
+
+	for (FRow& Row : Rows)
+	{
+		if (SearchLower.IsEmpty() || Row.NameLower.Contains(SearchLower, ESearchCase::CaseSensitive))
+		{
+			Filtered.Add(&Row);
+		}
+	}
+}
+
+void FSSVoiceDashboardActorList::BeginFillDetails(USSVoiceCultureStrategy* InStrategy, TArray<FAssetData>&& VoiceAssets,
+                                                  int32 InNumCultures)
+{
+	for (FRow& Row : Rows)
+	{
+		Row.NumAssets = INDEX_NONE;
+		Row.NumComplete = 0;
+	}
+
+	Strategy = InStrategy;
+	PendingAssets = MoveTemp(VoiceAssets);
+	PendingCursor = 0;
+	NumCultures = InNumCultures;
+}
+
+bool FSSVoiceDashboardActorList::FillDetails(double TimeBudgetSeconds)
+{
+	USSVoiceCultureStrategy* StrategyPtr = Strategy.Get();
+	if (!StrategyPtr)
+	{
+		PendingAssets.Reset();
+		return true;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + TimeBudgetSeconds;
+
+	while (PendingCursor < PendingAssets.Num())
+	{
+		const FAssetData& AssetData = PendingAssets[PendingCursor++];
+
+		FString ActorName;
+		if (StrategyPtr->ExecuteExtractActorNameFromAsset(AssetData, ActorName))
+		{
+			if (FRow* Row = FindRow(ActorName))
+			{
+				Row->NumAssets = FMath::Max(Row->NumAssets, 0) + 1;
+				if (FSSVoiceCultureUtils::GetTaggedCultures(AssetData).Num() >= NumCultures)
+				{
+					Row->NumComplete++;
+				}
+			}
+		}
+
+		// Check the clock every few assets only
+		if ((PendingCursor & 63) == 0 && FPlatformTime::Seconds() >= EndTime)
+			return false;
+	}
+
+	// Actors without any asset left
+	for (FRow& Row : Rows)
+	{
+		Row.NumAssets = FMath::Max(Row.NumAssets, 0);
+	}
+
+	PendingAssets.Reset();
+	PendingCursor = 0;
+	return true;
+}
@@ -8,18 +8,25 @@
 
 #include "AssetToolsModule.h"
 #include "AssetTypeActions_SSVoiceCultureSound.h"
+#include "ContentBrowserModule.h"
 #include "EdGraphUtilities.h"
+#include "Editor.h"
 #include "IAssetTools.h"
 #include "IAssetTypeActions.h"
 #include "ISettingsModule.h"
 #include "LevelEditor.h"
 #include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureEditorLog.h"
 #include "SSVoiceCultureEditorStyle.h"
+#include "SSVoiceCultureEditorSubsystem.h"
 #include "SSVoiceCultureSoundEditorToolkit.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Dashboard/SSSVoiceDashboard.h"
 #include "Settings/SSVoiceCultureEditorSettings.h"
 #include "Slate/SSVoiceCultureSlateComponents.h"
+#include "Misc/MessageDialog.h"
+#include "Utils/SSVoiceCultureUI.h"
+#include "Utils/SSVoiceCultureUtils.h"
 
 #define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
 
@@ -87,6 +94,132 @@ void FSSVoiceCultureEditorModule::AddSomndusStudioMenu(FMenuBuilder& MenuBuilder
 	);
 }
 
+TSharedRef<FExtender> FSSVoiceCultureEditorModule::ExtendFolderContextMenu(const TArray<FString>& SelectedPaths)
+{
+	TSharedRef<FExtender> Extender = MakeShared<FExtender>();
+
+	Extender->AddMenuExtension("PathContextBulkOperations", EExtensionHook::After, nullptr,
+		FMenuExtensionDelegate::CreateLambda([this, SelectedPaths](FMenuBuilder& MenuBuilder)
+		{
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("MigrateToTable", "Migrate Voice Lines to Table"),
+				LOCTEXT("MigrateToTableTooltip", "Moves the voice lines of the selected folders into one voice table. Voice assets are kept as redirects to their row."),
+				FSlateIcon(),
+				FUIAction(FExecuteAction::CreateRaw(this, &FSSVoiceCultureEditorModule::MigrateFolders, SelectedPaths,
+				                                    ESSVoiceCultureMigrationFormat::Table)));
+
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("MigrateToBanks", "Migrate Voice Lines to Banks"),
+				LOCTEXT("MigrateToBanksTooltip", "Packs the voice lines of each selected folder into a voice bank (one package per culture)."),
+				FSlateIcon(),
+				FUIAction(FExecuteAction::CreateRaw(this, &FSSVoiceCultureEditorModule::MigrateFolders, SelectedPaths,
+				                                    ESSVoiceCultureMigrationFormat::Bank)));
+		}));
+
+	return Extender;
+}
+
+void FSSVoiceCultureEditorModule::MigrateFolders(TArray<FString> SelectedPaths, ESSVoiceCultureMigrationFormat Format)
+{
+	const FText Confirm = FText::Format(
+		LOCTEXT("MigrateConfirm", "Migrate the voice lines of {0} folder(s)? Modified assets are saved."),
+		FText::AsNumber(SelectedPaths.Num()));
+	if (FMessageDialog::Open(EAppMsgType::YesNo, Confirm) != EAppReturnType::Yes)
+		return;
+
+	FSSVoiceCultureBatchOptions Options;
+	Options.bForceSave = true;
+	Options.bCollectGarbageBetweenBatches = true;
+
+	FSSVoiceCultureMigrationReport Report;
+	const bool bSuccess = FSSVoiceCultureUtils::MigrateVoiceFolders(SelectedPaths, Format, FString(), Options, Report);
+	FSSVoiceCultureUtils::SaveMigrationReport(Report);
+
+	const FText Message = FText::Format(LOCTEXT("MigrateDone", "{0} voice line(s) migrated, {1} skipped, {2} line ID conflict(s) (see Saved/SSVoiceCulture/MigrationReport.json)"),
+	                                    FText::AsNumber(Report.Migrated.Num()), FText::AsNumber(Report.Skipped.Num()),
+	                                    FText::AsNumber(Report.Conflicts.Num()));
+	if (bSuccess)
+	{
+		FSSVoiceCultureUI::NotifySuccess(Message, 6.0f);
+	}
+	else
+	{
+		FSSVoiceCultureUI::NotifyFailure(Message, 6.0f);
+	}
+}
+
+TSharedRef<FExtender> FSSVoiceCultureEditorModule::ExtendAssetContextMenu(const TArray<FAssetData>& SelectedAssets)
+{
+	TSharedRef<FExtender> Extender = MakeShared<FExtender>();
+
+	// Culture sounds only, voice culture assets are sounds too
+	const bool bHasCultureSound = SelectedAssets.ContainsByPredicate([](const FAssetData& Asset)
+	{
+		return Asset.IsInstanceOf(USoundBase::StaticClass()) && !Asset.IsInstanceOf(USSVoiceCultureSound::StaticClass());
+	});
+	if (!bHasCultureSound)
+		return Extender;
+
+	Extender->AddMenuExtension("GetAssetActions", EExtensionHook::After, nullptr,
+		FMenuExtensionDelegate::CreateLambda([this, SelectedAssets](FMenuBuilder& MenuBuilder)
+		{
+			MenuBuilder.AddMenuEntry(
+				LOCTEXT("FindCultureSoundOwners", "Find Voice Culture Owners"),
+				LOCTEXT("FindCultureSoundOwnersTooltip", "Selects the voice culture assets using the selected sounds (from the asset registry, nothing is loaded)."),
+				FSlateIcon(),
+				FUIAction(FExecuteAction::CreateRaw(this, &FSSVoiceCultureEditorModule::FindCultureSoundOwners, SelectedAssets)));
+		}));
+
+	return Extender;
+}
+
+void FSSVoiceCultureEditorModule::FindCultureSoundOwners(TArray<FAssetData> SelectedAssets)
+{
+	USSVoiceCultureEditorSubsystem* Subsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	if (!Subsystem->IsCultureSoundOwnerIndexReady())
+	{
+		FSSVoiceCultureUI::NotifyFailure(LOCTEXT("OwnerIndexNotReady", "The asset registry is still scanning, try again in a moment."));
+		return;
+	}
+
+	TArray<FSoftObjectPath> SoundPaths;
+	SoundPaths.Reserve(SelectedAssets.Num());
+	for (const FAssetData& Asset : SelectedAssets)
+	{
+		SoundPaths.Add(Asset.GetSoftObjectPath());
+	}
+
+	TArray<FSSVoiceCultureSoundOwner> Owners;
+	Subsystem->GetCultureSoundOwnersBatch(SoundPaths, Owners);
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	TSet<FSoftObjectPath> OwnedSounds;
+	TSet<FSoftObjectPath> OwnerPaths;
+	TArray<FAssetData> OwnerAssets;
+	for (const FSSVoiceCultureSoundOwner& Owner : Owners)
+	{
+		UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %s -> %s (%s)"), *Owner.Sound.ToString(),
+		       *Owner.VoiceAsset.ToString(), Owner.Culture.IsEmpty() ? TEXT("?") : *Owner.Culture);
+
+		OwnedSounds.Add(Owner.Sound);
+		if (!OwnerPaths.Contains(Owner.VoiceAsset))
+		{
+			OwnerPaths.Add(Owner.VoiceAsset);
+			OwnerAssets.Add(AssetRegistry.GetAssetByObjectPath(Owner.VoiceAsset));
+		}
+	}
+
+	if (OwnerAssets.Num() > 0)
+	{
+		GEditor->SyncBrowserToObjects(OwnerAssets);
+	}
+
+	FSSVoiceCultureUI::NotifySuccess(FText::Format(
+		LOCTEXT("FindCultureSoundOwnersDone", "{0} voice culture asset(s) use {1} of the {2} selected sound(s)."),
+		FText::AsNumber(OwnerAssets.Num()), FText::AsNumber(OwnedSounds.Num()), FText::AsNumber(SelectedAssets.Num())));
+}
+
 void FSSVoiceCultureEditorModule::StartupModule()
 {
 	// Settings
@@ -131,6 +264,17 @@ void FSSVoiceCultureEditorModule::StartupModule()
 
 	LevelEditorModule.GetMenuExtensibilityManager()->AddExtender(MenuExtender);
 	
+	// Content Browser folder menu
+	FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	ContentBrowserModule.GetAllPathViewContextMenuExtenders().Add(
+		FContentBrowserMenuExtender_SelectedPaths::CreateRaw(this, &FSSVoiceCultureEditorModule::ExtendFolderContextMenu));
+	FolderContextMenuExtenderHandle = ContentBrowserModule.GetAllPathViewContextMenuExtenders().Last().GetHandle();
+
+	// Content Browser asset menu
+	ContentBrowserModule.GetAllAssetViewContextMenuExtenders().Add(
+		FContentBrowserMenuExtender_SelectedAssets::CreateRaw(this, &FSSVoiceCultureEditorModule::ExtendAssetContextMenu));
+	AssetContextMenuExtenderHandle = ContentBrowserModule.GetAllAssetViewContextMenuExtenders().Last().GetHandle();
+	
 	// Editor icons
 	FSSVoiceCultureStyle::Initialize();
 }
@@ -154,6 +298,20 @@ void FSSVoiceCultureEditorModule::ShutdownModule()
 
 	// Dashboard
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner("SSVoiceDashboard");
+
+	if (FContentBrowserModule* ContentBrowserModule = FModuleManager::GetModulePtr<FContentBrowserModule>("ContentBrowser"))
+	{
+		ContentBrowserModule->GetAllPathViewContextMenuExtenders().RemoveAll(
+			[this](const FContentBrowserMenuExtender_SelectedPaths& Extender)
+			{
+				return Extender.GetHandle() == FolderContextMenuExtenderHandle;
+			});
+		ContentBrowserModule->GetAllAssetViewContextMenuExtenders().RemoveAll(
+			[this](const FContentBrowserMenuExtender_SelectedAssets& Extender)
+			{
+				return Extender.GetHandle() == AssetContextMenuExtenderHandle;
+			});
+	}
 	
 	if (FModuleManager::Get().IsModuleLoaded("AssetTools") && VoiceCultureSoundActions.IsValid())
 	{
@@ -9,22 +9,72 @@
 
 #include "SSVoiceCultureEditorLog.h"
 #include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureStats.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/Async.h"
 #include "Misc/ScopedSlowTask.h"
 #include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Utils/SSVoiceCultureJob.h"
+#include "Utils/SSVoiceCultureUtils.h"
 
 #define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
 
+DECLARE_CYCLE_STAT(TEXT("Registry Query"), STAT_VoiceCulture_RegistryQuery, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Search Voice Assets"), STAT_VoiceCulture_Search, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Build Voice Asset Index"), STAT_VoiceCulture_BuildIndex, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Build Culture Sound Owner Index"), STAT_VoiceCulture_BuildOwnerIndex, STATGROUP_VoiceCulture);
+
 void USSVoiceCultureEditorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	// Try to load the active strategy on subsystem startup
 	RefreshStrategy();
+
+	// Keep the voice asset and culture sound owner indexes in sync once built
+	IAssetRegistry& AssetRegistry = GetAssetRegistryModule().Get();
+	AssetRegistry.OnAssetAdded().AddUObject(this, &USSVoiceCultureEditorSubsystem::HandleAssetAdded);
+	AssetRegistry.OnAssetRemoved().AddUObject(this, &USSVoiceCultureEditorSubsystem::HandleAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddUObject(this, &USSVoiceCultureEditorSubsystem::HandleAssetRenamed);
+	AssetRegistry.OnAssetUpdated().AddUObject(this, &USSVoiceCultureEditorSubsystem::HandleAssetUpdated);
+
+	// Vendor watch folders follow the editor settings
+	IngestService.Start();
+	USSVoiceCultureEditorSettings::GetMutableSetting()->OnSettingChanged().AddUObject(
+		this, &USSVoiceCultureEditorSubsystem::HandleEditorSettingsChanged);
 }
 
 void USSVoiceCultureEditorSubsystem::Deinitialize()
 {
+	// Workers reference the job, wait for them before releasing it
+	if (ActiveJob.IsValid())
+	{
+		ActiveJob->Cancel();
+		while (!ActiveJob->Tick(0.0))
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+		ActiveJob.Reset();
+	}
+
+	if (JobTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(JobTickerHandle);
+		JobTickerHandle.Reset();
+	}
+
+	IngestService.Stop();
+	USSVoiceCultureEditorSettings::GetMutableSetting()->OnSettingChanged().RemoveAll(this);
+
+	if (FModuleManager::Get().IsModuleLoaded("AssetRegistry"))
+	{
+		IAssetRegistry& AssetRegistry = GetAssetRegistryModule().Get();
+		AssetRegistry.OnAssetAdded().RemoveAll(this);
+		AssetRegistry.OnAssetRemoved().RemoveAll(this);
+		AssetRegistry.OnAssetRenamed().RemoveAll(this);
+		AssetRegistry.OnAssetUpdated().RemoveAll(this);
+	}
+
 	CachedStrategy = nullptr;
 
 	Super::Deinitialize();
@@ -36,20 +86,37 @@ FAssetRegistryModule& USSVoiceCultureEditorSubsystem::GetAssetRegistryModule()
 		"AssetRegistry");
 }
 
-void USSVoiceCultureEditorSubsystem::ChangeActiveProfileFromName(FString ProfileName)
+void USSVoiceCultureEditorSubsystem::ChangeActiveProfileFromName(FString ProfileName, bool bPersist)
 {
 	auto* Profile = GetProfileFromName(ProfileName);
 
 	auto* EditorSettings = USSVoiceCultureEditorSettings::GetMutableSetting();
 	EditorSettings->ActiveVoiceProfileName = Profile->ProfileName;
-	EditorSettings->SaveConfig();
+	if (bPersist)
+	{
+		EditorSettings->SaveConfig();
+	}
 	
 	OnVoiceProfileNameChange();
 }
 
+void USSVoiceCultureEditorSubsystem::HandleEditorSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(USSVoiceCultureEditorSettings, bEnableWatchFolders) ||
+		PropertyName == GET_MEMBER_NAME_CHECKED(USSVoiceCultureEditorSettings, WatchFolders))
+	{
+		IngestService.Start();
+	}
+}
+
 void USSVoiceCultureEditorSubsystem::OnVoiceProfileNameChange()
 {
 	RefreshStrategy();
+
+	// Actor names, line suffixes and sound cultures depend on the strategy
+	InvalidateVoiceAssetIndex();
+	InvalidateCultureSoundOwnerIndex();
 }
 
 USSVoiceCultureStrategy* USSVoiceCultureEditorSubsystem::GetActiveStrategy()
@@ -121,14 +188,23 @@ bool USSVoiceCultureEditorSubsystem::IsReady() const
 
 TArray<FAssetData> USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets(bool bRecursivePaths)
 {
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_RegistryQuery, "VoiceCulture::GetAllSoundBaseAssets");
+
 	FAssetRegistryModule& AssetRegistry = GetAssetRegistryModule();
-	AssetRegistry.Get().SearchAllAssets(true);
+
+	// Blocking scan is game thread only, background jobs use what the registry already knows
+	if (IsInGameThread())
+	{
+		AssetRegistry.Get().SearchAllAssets(true);
+	}
 
 	FARFilter Filter;
 	Filter.ClassPaths.Add(USoundBase::StaticClass()->GetClassPathName());
 	Filter.bRecursiveClasses = true;
 	Filter.bRecursivePaths = bRecursivePaths;
 	Filter.PackagePaths.Add(FName("/Game"));
+	// In-memory assets may only be queried from the game thread
+	Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
 
 	TArray<FAssetData> FoundAssets;
 	AssetRegistry.Get().GetAssets(Filter, FoundAssets);
@@ -138,6 +214,8 @@ TArray<FAssetData> USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets(bool bR
 
 TArray<FAssetData> USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets()
 {
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_RegistryQuery, "VoiceCulture::GetAllLocalizeVoiceSoundAssets");
+
 	// 1. Prepare registry
 	FAssetRegistryModule& AssetRegistry = GetAssetRegistryModule();
 
@@ -145,6 +223,8 @@ TArray<FAssetData> USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAsset
 	Filter.ClassPaths.Add(USSVoiceCultureSound::StaticClass()->GetClassPathName());
 	Filter.bRecursivePaths = true;
 	Filter.PackagePaths.Add(FName("/Game"));
+	// In-memory assets may only be queried from the game thread (background jobs, dashboard and index workers)
+	Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
 
 	TArray<FAssetData> FoundAssets;
 	AssetRegistry.Get().GetAssets(Filter, FoundAssets);
@@ -275,4 +355,428 @@ USSVoiceCultureStrategy* USSVoiceCultureEditorSubsystem::RefreshStrategy()
 	return CachedStrategy;
 }
 
+bool USSVoiceCultureEditorSubsystem::StartJob(const TSharedRef<FSSVoiceCultureJob>& Job)
+{
+	check(IsInGameThread());
+
+	if (ActiveJob.IsValid())
+	{
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Cannot start '%s': '%s' is still running."),
+		       *Job->GetTitle().ToString(), *ActiveJob->GetTitle().ToString());
+		return false;
+	}
+
+	ActiveJob = Job;
+
+	if (!JobTickerHandle.IsValid())
+	{
+		JobTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &USSVoiceCultureEditorSubsystem::TickActiveJob));
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Job started: %s"), *Job->GetTitle().ToString());
+	OnJobStateChanged.Broadcast();
+	return true;
+}
+
+void USSVoiceCultureEditorSubsystem::CancelActiveJob()
+{
+	if (ActiveJob.IsValid())
+	{
+		UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Job cancel requested: %s"), *ActiveJob->GetTitle().ToString());
+		ActiveJob->Cancel();
+	}
+}
+
+bool USSVoiceCultureEditorSubsystem::TickActiveJob(float DeltaTime)
+{
+	if (!ActiveJob.IsValid())
+	{
+		JobTickerHandle.Reset();
+		return false;
+	}
+
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	const double Budget = FMath::Max(1.f, EditorSettings->BackgroundJobFrameBudgetMs) / 1000.0;
+
+	if (!ActiveJob->Tick(Budget))
+		return true;
+
+	UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Job %s: %s"),
+	       ActiveJob->IsCancelRequested() ? TEXT("cancelled") : TEXT("finished"), *ActiveJob->GetTitle().ToString());
+
+	// Ticker removes itself
+	ActiveJob.Reset();
+	JobTickerHandle.Reset();
+	OnJobStateChanged.Broadcast();
+	return false;
+}
+
+void USSVoiceCultureEditorSubsystem::SearchVoiceAssets(const FString& Query, ESSVoiceSearchKind Kinds, int32 MaxResults,
+                                                       TArray<FSSVoiceSearchResult>& OutResults)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_Search, "VoiceCulture::SearchVoiceAssets");
+
+	OutResults.Reset();
+
+	// Never built on the keystroke, callers fall back to plain matching until it is ready
+	BuildVoiceAssetIndexAsync();
+	if (!bVoiceAssetIndexBuilt)
+		return;
+
+	VoiceAssetIndex.Search.Search(Query, Kinds, MaxResults, OutResults);
+}
+
+void USSVoiceCultureEditorSubsystem::InvalidateVoiceAssetIndex()
+{
+	bVoiceAssetIndexBuilt = false;
+	bVoiceAssetIndexBuilding = false;
+	VoiceAssetIndexGeneration++;
+	VoiceAssetIndex = FVoiceAssetIndex();
+	PendingVoiceAssetChanges.Reset();
+}
+
+namespace
+{
+	/** Line document text: suffix when the strategy knows it (e.g. "NPC01_Hello"), else the asset name */
+	FString GetIndexedLineText(const USSVoiceCultureStrategy* Strategy, const FAssetData& AssetData)
+	{
+		const FString AssetName = AssetData.AssetName.ToString();
+		const FString Suffix = Strategy ? Strategy->ExtractSuffixFromBaseName(AssetName) : FString();
+		return Suffix.IsEmpty() ? AssetName : Suffix;
+	}
+}
+
+void USSVoiceCultureEditorSubsystem::BuildVoiceAssetIndexAsync()
+{
+	if (bVoiceAssetIndexBuilt || bVoiceAssetIndexBuilding)
+		return;
+
+	// Wait for the initial scan, search returns nothing until then
+	if (GetAssetRegistryModule().Get().IsLoadingAssets())
+		return;
+
+	bVoiceAssetIndexBuilding = true;
+	PendingVoiceAssetChanges.Reset();
+
+	// Native rules are plain name parsing and run on the worker, Blueprint actor rules on the game thread
+	USSVoiceCultureStrategy* Strategy = GetActiveStrategy();
+	const bool bNativeStrategy = IsValid(Strategy) && Strategy->GetClass()->HasAnyClassFlags(CLASS_Native);
+
+	TSharedRef<FVoiceAssetIndex> Index = MakeShared<FVoiceAssetIndex>();
+
+	// Supported cultures are searchable even when no asset uses them yet
+	for (const FString& Culture : USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures)
+	{
+		Index->AddCulture(Culture);
+	}
+
+	// Released on the game thread by the completion below
+	TSharedRef<TStrongObjectPtr<USSVoiceCultureStrategy>> StrategyRef =
+		MakeShared<TStrongObjectPtr<USSVoiceCultureStrategy>>(Strategy);
+
+	TWeakObjectPtr<USSVoiceCultureEditorSubsystem> WeakThis(this);
+	const int32 Generation = VoiceAssetIndexGeneration;
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Queried here, in-memory registry data is game thread only and unsaved assets belong in the index too
+	TArray<FAssetData> VoiceAssets = GetAllLocalizeVoiceSoundAssets();
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, StrategyRef, bNativeStrategy, Index, Generation, StartTime,
+		       VoiceAssets = MoveTemp(VoiceAssets)]() mutable
+	{
+		SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_BuildIndex, "VoiceCulture::BuildVoiceAssetIndex");
+
+		USSVoiceCultureStrategy* WorkerStrategy = StrategyRef->Get();
+		Index->Assets.Reserve(VoiceAssets.Num());
+
+		for (const FAssetData& AssetData : VoiceAssets)
+		{
+			FString ActorName;
+			if (bNativeStrategy && !WorkerStrategy->ExecuteExtractActorNameFromAsset_Implementation(AssetData, ActorName))
+			{
+				ActorName.Reset();
+			}
+			Index->AddAsset(AssetData.GetSoftObjectPath(), GetIndexedLineText(WorkerStrategy, AssetData), ActorName);
+
+			for (const FString& Culture : FSSVoiceCultureUtils::GetTaggedCultures(AssetData))
+			{
+				Index->AddCulture(Culture);
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, StrategyRef, bNativeStrategy, Index, Generation, StartTime,
+			          VoiceAssets = MoveTemp(VoiceAssets)]()
+		          {
+			          StrategyRef->Reset();
+
+			          USSVoiceCultureEditorSubsystem* This = WeakThis.Get();
+			          if (!This || This->VoiceAssetIndexGeneration != Generation)
+				          return;
+
+			          This->FinishVoiceAssetIndexBuild(MoveTemp(*Index), VoiceAssets, !bNativeStrategy, StartTime);
+		          });
+	});
+}
+
+void USSVoiceCultureEditorSubsystem::FinishVoiceAssetIndexBuild(FVoiceAssetIndex&& Index,
+                                                                const TArray<FAssetData>& VoiceAssets,
+                                                                bool bResolveActors, double StartTime)
+{
+	USSVoiceCultureStrategy* Strategy = GetActiveStrategy();
+	if (bResolveActors && Strategy)
+	{
+		for (const FAssetData& AssetData : VoiceAssets)
+		{
+			FString ActorName;
+			if (Strategy->ExecuteExtractActorNameFromAsset(AssetData, ActorName))
+			{
+				Index.SetActor(AssetData.GetSoftObjectPath(), ActorName);
+			}
+		}
+	}
+
+	VoiceAssetIndex = MoveTemp(Index);
+	bVoiceAssetIndexBuilding = false;
+	bVoiceAssetIndexBuilt = true;
+
+	// Assets saved, added or removed while the worker ran
+	IAssetRegistry& AssetRegistry = GetAssetRegistryModule().Get();
+	for (const FSoftObjectPath& AssetPath : PendingVoiceAssetChanges)
+	{
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(AssetPath);
+		if (AssetData.IsValid())
+		{
+			IndexVoiceAsset(AssetData);
+		}
+		else
+		{
+			UnindexVoiceAsset(AssetPath);
+		}
+	}
+	PendingVoiceAssetChanges.Reset();
+
+	UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Voice asset index built: %d assets, %d actors, %d documents in %.2f ms"),
+	       VoiceAssetIndex.Assets.Num(), VoiceAssetIndex.Actors.Num(), VoiceAssetIndex.Search.Num(),
+	       (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void USSVoiceCultureEditorSubsystem::IndexVoiceAsset(const FAssetData& AssetData)
+{
+	USSVoiceCultureStrategy* Strategy = GetActiveStrategy();
+	const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+
+	const FString LineText = GetIndexedLineText(Strategy, AssetData);
+	FString ActorName;
+	if (Strategy && !Strategy->ExecuteExtractActorNameFromAsset(AssetData, ActorName))
+	{
+		ActorName.Reset();
+	}
+
+	// A plain save keeps its documents, only new cultures are added
+	const FIndexedVoiceAsset* Indexed = VoiceAssetIndex.Assets.Find(AssetPath);
+	if (!Indexed || Indexed->LineText != LineText || Indexed->ActorName != ActorName)
+	{
+		VoiceAssetIndex.RemoveAsset(AssetPath);
+		VoiceAssetIndex.AddAsset(AssetPath, LineText, ActorName);
+	}
+
+	for (const FString& Culture : FSSVoiceCultureUtils::GetTaggedCultures(AssetData))
+	{
+		VoiceAssetIndex.AddCulture(Culture);
+	}
+}
+
+void USSVoiceCultureEditorSubsystem::UnindexVoiceAsset(const FSoftObjectPath& AssetPath)
+{
+	VoiceAssetIndex.RemoveAsset(AssetPath);
+}
+
+void USSVoiceCultureEditorSubsystem::FVoiceAssetIndex::AddAsset(const FSoftObjectPath& AssetPath, const FString& LineText,
+                                                                const FString& ActorName)
+{
+	FIndexedVoiceAsset& Indexed = Assets.Add(AssetPath);
+	Indexed.LineText = LineText;
+	Indexed.LineDocument = Search.Add(ESSVoiceSearchKind::Line, LineText, AssetPath);
+
+	SetActor(AssetPath, ActorName);
+}
+
+void USSVoiceCultureEditorSubsystem::FVoiceAssetIndex::SetActor(const FSoftObjectPath& AssetPath, const FString& ActorName)
+{
+	FIndexedVoiceAsset* Indexed = Assets.Find(AssetPath);
+	if (!Indexed || ActorName.IsEmpty())
+		return;
+
+	Indexed->ActorName = ActorName;
+
+	// Actor: one document shared by all its assets
+	TPair<int32, int32>& Actor = Actors.FindOrAdd(ActorName, TPair<int32, int32>(INDEX_NONE, 0));
+	if (Actor.Value++ == 0)
+	{
+		Actor.Key = Search.Add(ESSVoiceSearchKind::Actor, ActorName);
+	}
+}
+
+void USSVoiceCultureEditorSubsystem::FVoiceAssetIndex::RemoveAsset(const FSoftObjectPath& AssetPath)
+{
+	FIndexedVoiceAsset Indexed;
+	if (!Assets.RemoveAndCopyValue(AssetPath, Indexed))
+		return;
+
+	Search.Remove(Indexed.LineDocument);
+
+	if (TPair<int32, int32>* Actor = Actors.Find(Indexed.ActorName))
+	{
+		if (--Actor->Value == 0)
+		{
+			Search.Remove(Actor->Key);
+			Actors.Remove(Indexed.ActorName);
+		}
+	}
+
+	// Compaction renumbers the documents, rewrite the ids kept here
+	TArray<int32> Remap;
+	if (!Search.Compact(Remap))
+		return;
+
+	for (TPair<FSoftObjectPath, FIndexedVoiceAsset>& Pair : Assets)
+	{
+		Pair.Value.LineDocument = Remap[Pair.Value.LineDocument];
+	}
+	for (TPair<FString, TPair<int32, int32>>& Pair : Actors)
+	{
+		Pair.Value.Key = Remap[Pair.Value.Key];
+	}
+}
+
+void USSVoiceCultureEditorSubsystem::FVoiceAssetIndex::AddCulture(const FString& Culture)
+{
+	if (Cultures.Contains(Culture))
+		return;
+
+	Cultures.Add(Culture);
+	Search.Add(ESSVoiceSearchKind::Culture, Culture);
+}
+
+TArray<FSSVoiceCultureSoundOwner> USSVoiceCultureEditorSubsystem::GetCultureSoundOwners(const FSoftObjectPath& SoundPath)
+{
+	EnsureCultureSoundOwnerIndex();
+
+	const TArray<FSSVoiceCultureSoundOwner>* Owners = CultureSoundOwnerIndex.Find(SoundPath.GetLongPackageFName());
+	return Owners ? *Owners : TArray<FSSVoiceCultureSoundOwner>();
+}
+
+void USSVoiceCultureEditorSubsystem::GetCultureSoundOwnersBatch(const TArray<FSoftObjectPath>& SoundPaths,
+                                                                TArray<FSSVoiceCultureSoundOwner>& OutOwners)
+{
+	EnsureCultureSoundOwnerIndex();
+
+	OutOwners.Reset();
+	for (const FSoftObjectPath& SoundPath : SoundPaths)
+	{
+		if (const TArray<FSSVoiceCultureSoundOwner>* Owners = CultureSoundOwnerIndex.Find(SoundPath.GetLongPackageFName()))
+		{
+			OutOwners.Append(*Owners);
+		}
+	}
+}
+
+bool USSVoiceCultureEditorSubsystem::IsCultureSoundOwnerIndexReady()
+{
+	EnsureCultureSoundOwnerIndex();
+	return bCultureSoundOwnerIndexBuilt;
+}
+
+void USSVoiceCultureEditorSubsystem::InvalidateCultureSoundOwnerIndex()
+{
+	bCultureSoundOwnerIndexBuilt = false;
+	CultureSoundOwnerIndex.Reset();
+}
+
+void USSVoiceCultureEditorSubsystem::EnsureCultureSoundOwnerIndex()
+{
+	if (bCultureSoundOwnerIndexBuilt)
+		return;
+
+	// Dependencies are incomplete until the initial scan finishes
+	IAssetRegistry& AssetRegistry = GetAssetRegistryModule().Get();
+	if (AssetRegistry.IsLoadingAssets())
+		return;
+
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_BuildOwnerIndex, "VoiceCulture::BuildCultureSoundOwnerIndex");
+
+	const double StartTime = FPlatformTime::Seconds();
+	bCultureSoundOwnerIndexBuilt = true;
+
+	const TArray<FAssetData> VoiceAssets = GetAllLocalizeVoiceSoundAssets();
+	FSSVoiceCultureBatchOptions Options;
+	CultureSoundOwnerIndex.Build(AssetRegistry, GetActiveStrategy(), VoiceAssets, GetAllSoundBaseAssets(),
+	                             Options.GetNumChunks(VoiceAssets.Num()));
+
+	UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Culture sound owner index built: %d sounds used by %d voice assets in %.2f ms"),
+	       CultureSoundOwnerIndex.Num(), VoiceAssets.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void USSVoiceCultureEditorSubsystem::HandleAssetAdded(const FAssetData& AssetData)
+{
+	if (AssetData.AssetClassPath != USSVoiceCultureSound::StaticClass()->GetClassPathName())
+		return;
+
+	if (bVoiceAssetIndexBuilt)
+	{
+		IndexVoiceAsset(AssetData);
+	}
+	else if (bVoiceAssetIndexBuilding)
+	{
+		PendingVoiceAssetChanges.Add(AssetData.GetSoftObjectPath());
+	}
+	if (bCultureSoundOwnerIndexBuilt)
+	{
+		CultureSoundOwnerIndex.AddVoiceAsset(GetAssetRegistryModule().Get(), GetActiveStrategy(), AssetData);
+	}
+}
+
+void USSVoiceCultureEditorSubsystem::HandleAssetRemoved(const FAssetData& AssetData)
+{
+	if (bVoiceAssetIndexBuilt)
+	{
+		UnindexVoiceAsset(AssetData.GetSoftObjectPath());
+	}
+	else if (bVoiceAssetIndexBuilding)
+	{
+		PendingVoiceAssetChanges.Add(AssetData.GetSoftObjectPath());
+	}
+	if (bCultureSoundOwnerIndexBuilt)
+	{
+		CultureSoundOwnerIndex.RemoveVoiceAsset(AssetData.PackageName);
+		CultureSoundOwnerIndex.RemoveSound(AssetData.PackageName);
+	}
+}
+
+void USSVoiceCultureEditorSubsystem::HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	if (bVoiceAssetIndexBuilt)
+	{
+		UnindexVoiceAsset(FSoftObjectPath(OldObjectPath));
+	}
+	else if (bVoiceAssetIndexBuilding)
+	{
+		PendingVoiceAssetChanges.Add(FSoftObjectPath(OldObjectPath));
+	}
+	if (bCultureSoundOwnerIndexBuilt)
+	{
+		const FName OldPackage = FSoftObjectPath(OldObjectPath).GetLongPackageFName();
+		CultureSoundOwnerIndex.RemoveVoiceAsset(OldPackage);
+		CultureSoundOwnerIndex.RenameSound(OldPackage, AssetData);
+	}
+	HandleAssetAdded(AssetData);
+}
+
+void USSVoiceCultureEditorSubsystem::HandleAssetUpdated(const FAssetData& AssetData)
+{
+	// Tags may have new cultures, dependencies new culture sounds
+	HandleAssetAdded(AssetData);
+}
+
 #undef LOCTEXT_NAMESPACE
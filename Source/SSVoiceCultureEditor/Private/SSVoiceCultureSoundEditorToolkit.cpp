@@ -7,6 +7,7 @@
 
 #include "SSVoiceCultureSoundEditorToolkit.h"
 
+#include "GraphEditor.h"
 #include "SSVoiceCultureEditorLog.h"
 #include "SSVoiceCultureSettings.h"
 #include "SSVoiceCultureSound.h"
@@ -18,6 +19,17 @@
 const FName FSSVoiceCultureSoundEditorToolkit::DetailsTabID(TEXT("SSVoiceCultureSoundEditor_Details"));
 const FName FSSVoiceCultureSoundEditorToolkit::GraphTabID(TEXT("SSVoiceCultureSoundEditor_Graph"));
 
+namespace SSVoiceCultureGraphLayout
+{
+	constexpr int32 StartX = 100;
+	constexpr int32 StartY = 100;
+	// Espace entre chaque node
+	constexpr int32 PaddingY = 150;
+
+	/** Slots created before the graph view has a size (first paint) */
+	constexpr int32 InitialSlots = 8;
+}
+
 void FSSVoiceCultureSoundEditorCommands::RegisterCommands()
 {
 	UI_COMMAND(Play, "Play", "Play the voice culture", EUserInterfaceActionType::Button, FInputChord());
@@ -26,6 +38,14 @@ void FSSVoiceCultureSoundEditorCommands::RegisterCommands()
 	           EUserInterfaceActionType::Button, FInputChord());
 }
 
+FSSVoiceCultureSoundEditorToolkit::~FSSVoiceCultureSoundEditorToolkit()
+{
+	if (DeferredNodesTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(DeferredNodesTickerHandle);
+	}
+}
+
 void FSSVoiceCultureSoundEditorToolkit::Init(USSVoiceCultureSound* InAsset, const EToolkitMode::Type Mode,
                                              const TSharedPtr<IToolkitHost>& InitToolkitHost)
 {
@@ -143,15 +163,15 @@ TSharedRef<SDockTab> FSSVoiceCultureSoundEditorToolkit::SpawnGraphTab(const FSpa
 	VoiceCultureGraph = NewObject<UEdGraph>(GetTransientPackage(), USSVoiceCultureGraph::StaticClass());
 	VoiceCultureGraph->Schema = UEdGraphSchema::StaticClass(); // You can define a custom schema later
 	
-	// Convert each VoiceCulture entry into a graph node
+	// One slot per supported culture, nodes are created once on screen (see CreateVisibleNodes)
+	CultureSlots.Reset();
 	if (Asset)
 	{
-		int32 Index = 0;
 		for (const FString& Culture : USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures)
 		{
-			USSVoiceCultureGraphNode* EdNode = CreateVisualNode(Culture, Index);
-			Index++;
+			CultureSlots.Add({Culture, nullptr});
 		}
+		SnapshotCultureEntries(DisplayedEntries);
 	}
 
 	// Create the GraphEditor
@@ -164,6 +184,11 @@ TSharedRef<SDockTab> FSSVoiceCultureSoundEditorToolkit::SpawnGraphTab(const FSpa
 		.GraphToEdit(VoiceCultureGraph)
 		.IsEditable(false); // You can make this editable later
 
+	if (!CreateVisibleNodes() && !DeferredNodesTickerHandle.IsValid())
+	{
+		DeferredNodesTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FSSVoiceCultureSoundEditorToolkit::TickDeferredNodes), 0.1f);
+	}
 
 	return SNew(SDockTab)
 		.Label(NSLOCTEXT("SSVoiceCultureEditor", "GraphTabLabel", "Graph"))
@@ -178,25 +203,96 @@ void FSSVoiceCultureSoundEditorToolkit::RefreshGraphEditor()
 	if (!GraphEditor.IsValid())
 		return;
 
-	// Retrieve the currently displayed graph in the editor
-	UEdGraph* Graph = GraphEditor->GetCurrentGraph();
-	if (!Graph)
-		return;
+	TMap<FString, FSoftObjectPath> NewEntries;
+	SnapshotCultureEntries(NewEntries);
 
-	for (UEdGraphNode* Node : Graph->Nodes)
+	int32 NumRefreshed = 0;
+	for (const FCultureSlot& Slot : CultureSlots)
 	{
-		if (!IsValid(Node))
+		const FString CultureKey = Slot.Culture.ToLower();
+		const FSoftObjectPath* OldSound = DisplayedEntries.Find(CultureKey);
+		const FSoftObjectPath* NewSound = NewEntries.Find(CultureKey);
+
+		const bool bChanged = (OldSound == nullptr) != (NewSound == nullptr) || (OldSound && *OldSound != *NewSound);
+		if (!bChanged)
 			continue;
 
-		// Mark the node as modified (ensures undo support and editor recognition)
-		Node->Modify();
+		// Not created yet: it will read the new entry when it gets on screen
+		USSVoiceCultureGraphNode* Node = Slot.Node.Get();
+		if (!Node)
+			continue;
 
-		// Optionally, reconstruct the node (force rebuild of pins and layout)
-		Node->ReconstructNode();
+		GraphEditor->RefreshNode(*Node);
+		NumRefreshed++;
 	}
 
-	// Notify the editor that the graph has changed (forces full redraw)
-	Graph->NotifyGraphChanged();
+	DisplayedEntries = MoveTemp(NewEntries);
+
+	UE_LOG(LogVoiceCultureEditor, Verbose, TEXT("[SSVoiceCulture] %d graph node(s) refreshed."), NumRefreshed);
+}
+
+void FSSVoiceCultureSoundEditorToolkit::SnapshotCultureEntries(TMap<FString, FSoftObjectPath>& OutEntries) const
+{
+	OutEntries.Reset();
+	if (!Asset)
+		return;
+
+	for (const FSSCultureAudioEntry& Entry : Asset->VoiceCultures)
+	{
+		// First entry wins, as in USSVoiceCultureGraphNode::GetSoundBase
+		const FString CultureKey = Entry.Culture.ToLower();
+		if (!OutEntries.Contains(CultureKey))
+		{
+			OutEntries.Add(CultureKey, Entry.Sound.ToSoftObjectPath());
+		}
+	}
+}
+
+bool FSSVoiceCultureSoundEditorToolkit::CreateVisibleNodes()
+{
+	if (!GraphEditor.IsValid())
+		return true;
+
+	// Visible graph range, with one slot of margin so scrolling does not show empty space
+	int32 FirstSlot = 0;
+	int32 LastSlot = SSVoiceCultureGraphLayout::InitialSlots - 1;
+
+	const FVector2D ViewSize = GraphEditor->GetTickSpaceGeometry().GetLocalSize();
+	if (ViewSize.Y > 0.f)
+	{
+		FVector2D ViewLocation;
+		float ZoomAmount = 1.f;
+		GraphEditor->GetViewLocation(ViewLocation, ZoomAmount);
+		ZoomAmount = FMath::Max(ZoomAmount, KINDA_SMALL_NUMBER);
+
+		const float ViewTop = ViewLocation.Y - SSVoiceCultureGraphLayout::StartY;
+		const float ViewBottom = ViewTop + ViewSize.Y / ZoomAmount;
+		FirstSlot = FMath::FloorToInt(ViewTop / SSVoiceCultureGraphLayout::PaddingY) - 1;
+		LastSlot = FMath::CeilToInt(ViewBottom / SSVoiceCultureGraphLayout::PaddingY) + 1;
+	}
+
+	FirstSlot = FMath::Max(FirstSlot, 0);
+	LastSlot = FMath::Min(LastSlot, CultureSlots.Num() - 1);
+
+	for (int32 Index = FirstSlot; Index <= LastSlot; ++Index)
+	{
+		FCultureSlot& Slot = CultureSlots[Index];
+		if (!Slot.Node.IsValid())
+		{
+			Slot.Node = CreateVisualNode(Slot.Culture, Index);
+		}
+	}
+
+	return !CultureSlots.ContainsByPredicate([](const FCultureSlot& Slot) { return !Slot.Node.IsValid(); });
+}
+
+bool FSSVoiceCultureSoundEditorToolkit::TickDeferredNodes(float DeltaTime)
+{
+	if (!CreateVisibleNodes())
+		return true;
+
+	DeferredNodesTickerHandle.Reset();
+	return false;
 }
 
 void FSSVoiceCultureSoundEditorToolkit::OnDetailsChanged(const FPropertyChangedEvent& InEvent)
@@ -330,20 +426,15 @@ USSVoiceCultureGraphNode* FSSVoiceCultureSoundEditorToolkit::CreateVisualNode(co
 		return nullptr;
 	}
 
-	const int32 PaddingY = 150; // Espace entre chaque node
-	const int32 StartX = 100;
-	const int32 StartY = 100;
-	
-	EdNode->SetFlags(RF_Transactional);
 	EdNode->SourceAsset = Asset;
 	EdNode->Culture = Culture;
-	EdNode->NodePosX = StartX;
-	EdNode->NodePosY = StartY + Index * PaddingY;
+	EdNode->NodePosX = SSVoiceCultureGraphLayout::StartX;
+	EdNode->NodePosY = SSVoiceCultureGraphLayout::StartY + Index * SSVoiceCultureGraphLayout::PaddingY;
 	EdNode->AllocateDefaultPins();
 
 	NodeCreator.Finalize();
 
-	UE_LOG(LogVoiceCultureEditor, Log,
+	UE_LOG(LogVoiceCultureEditor, Verbose,
 		   TEXT("[SSVoiceCulture] Visual node created for '%s' at (%d, %.d)."),
 		   *Culture, EdNode->NodePosX, EdNode->NodePosY);
 
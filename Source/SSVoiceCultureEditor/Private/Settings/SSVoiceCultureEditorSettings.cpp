@@ -41,3 +41,18 @@ USSVoiceCultureEditorSettings* USSVoiceCultureEditorSettings::GetMutableSetting(
 	return GetMutableDefault<USSVoiceCultureEditorSettings>();
 }
 
+const FSSVoiceCultureAudioProfile* USSVoiceCultureEditorSettings::FindCultureAudioProfile(const FString& Culture) const
+{
+	const FSSVoiceCultureAudioProfile* Fallback = nullptr;
+	for (const FSSVoiceCultureAudioProfile& Profile : CultureAudioProfiles)
+	{
+		if (Profile.Culture.Equals(Culture, ESearchCase::IgnoreCase))
+			return &Profile;
+
+		if (!Fallback && Profile.Culture == TEXT("*"))
+		{
+			Fallback = &Profile;
+		}
+	}
+	return Fallback;
+}
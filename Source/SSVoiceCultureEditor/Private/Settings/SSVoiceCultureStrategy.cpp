@@ -71,6 +71,31 @@ bool USSVoiceCultureStrategy::ParseAssetName(const FString& AssetName, FString&
 	return false;
 }
 
+FString USSVoiceCultureStrategy::ExtractSuffixFromBaseName(const FString& BaseName) const
+{
+	return FString();
+}
+
+FString USSVoiceCultureStrategy::BuildVoiceAssetName(const FString& Suffix) const
+{
+	return FString();
+}
+
+bool USSVoiceCultureStrategy::ParseCultureSoundAsset(const FAssetData& AssetData, FString& OutCulture,
+                                                     FString& OutSuffix) const
+{
+	// Voice culture assets are sounds too, but never a culture sound
+	if (AssetData.AssetClassPath == USSVoiceCultureSound::StaticClass()->GetClassPathName())
+		return false;
+
+	FString Prefix;
+	if (!ParseAssetName(AssetData.AssetName.ToString(), Prefix, OutCulture, OutSuffix))
+		return false;
+
+	OutCulture.ToLowerInline();
+	return !OutCulture.IsEmpty() && !OutSuffix.IsEmpty();
+}
+
 USoundBase* USSVoiceCultureStrategy::FindMatchingSoundAsset(const FString& CultureCode, const FString& Suffix) const
 {
 	// Build the expected asset name suffix using the strategy rule (e.g. "fr_MyLine" or "MyLine_fr")
@@ -43,6 +43,14 @@ FString USSVoiceCultureStrategy_Default::ExtractSuffixFromBaseName(const FString
 	return Suffix;
 }
 
+FString USSVoiceCultureStrategy_Default::BuildVoiceAssetName(const FString& Suffix) const
+{
+	if (Suffix.IsEmpty())
+		return FString();
+
+	return VoiceAssetPrefix + TEXT("_") + Suffix;
+}
+
 bool USSVoiceCultureStrategy_Default::ParseAssetName(const FString& AssetName, FString& OutPrefix, FString& OutCulture,
                                                      FString& OutSuffix) const
 {
@@ -68,6 +76,33 @@ bool USSVoiceCultureStrategy_Default::ParseAssetName(const FString& AssetName, F
 	return true;
 }
 
+bool USSVoiceCultureStrategy_Default::ParseCultureSoundAsset(const FAssetData& AssetData, FString& OutCulture,
+                                                             FString& OutSuffix) const
+{
+	if (!Super::ParseCultureSoundAsset(AssetData, OutCulture, OutSuffix))
+		return false;
+
+	if (AllowedPrefixes.Num() == 0)
+		return true;
+
+	// The prefix is always the first part of the name (e.g. "A" in "A_EN_NPC01_Hello")
+	FString Prefix;
+	AssetData.AssetName.ToString().Split(TEXT("_"), &Prefix, nullptr);
+	return IsAllowedPrefix(Prefix);
+}
+
+bool USSVoiceCultureStrategy_Default::IsAllowedPrefix(const FString& Prefix) const
+{
+	// No restriction configured
+	if (AllowedPrefixes.Num() == 0)
+		return true;
+
+	return AllowedPrefixes.ContainsByPredicate([&](const FString& Allowed)
+	{
+		return bCaseSensitivePrefixes ? (Allowed == Prefix) : Allowed.Equals(Prefix, ESearchCase::IgnoreCase);
+	});
+}
+
 FText USSVoiceCultureStrategy_Default::DisplayMatchVoiceCulturePattern_Implementation() const
 {
 	return FText::FromString("LVA_{ActorName}_{Suffix}");
@@ -141,16 +176,8 @@ const
 			continue;
 
 		// Optional prefix check: ensure the prefix matches allowed prefixes (if any)
-		if (AllowedPrefixes.Num() > 0)
-		{
-			const bool bMatch = AllowedPrefixes.ContainsByPredicate([&](const FString& Allowed)
-			{
-				return bCaseSensitivePrefixes ? (Allowed == Prefix) : Allowed.Equals(Prefix, ESearchCase::IgnoreCase);
-			});
-
-			if (!bMatch)
-				continue;
-		}
+		if (!IsAllowedPrefix(Prefix))
+			continue;
 
 		// Asset is considered valid — load the sound and map it to the culture code
 		if (USoundBase* Sound = Cast<USoundBase>(Asset.GetAsset()))
@@ -0,0 +1,396 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureSound.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonSerializer.h"
+#include "Settings/SSVoiceCultureStrategy_Default.h"
+#include "Settings/SSVoiceCultureStrategy_DefaultB.h"
+#include "Sound/SoundWave.h"
+#include "Tests/SSVoiceCultureTestUtils.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Utils/SSVoiceCultureUtils.h"
+
+/**
+ * Synthetic-registry benchmarks for the naming strategies, the auto-populate matcher and the dashboard filters.
+ *
+ * Registry entries are generated in memory (no package is created or loaded), so the suite scales to 1M names.
+ * Command line switches:
+ *   -VoiceCultureBenchCultures=N   number of cultures per line (default 8)
+ *   -VoiceCultureBenchMax=N        largest set to run (default 1000000)
+ *   -VoiceCultureBenchNoAllocs     do not count allocations
+ *
+ * Results are written to Saved/SSVoiceCulture/Benchmarks/<Scheme>_<Size>.json.
+ */
+namespace SSVoiceCultureBenchmark
+{
+	struct FResult
+	{
+		FString Name;
+		int32 NumItems = 0;
+		int32 NumIterations = 0;
+		double NsPerItem = 0.0;
+
+		/** -1 when allocations are not counted */
+		double AllocsPerItem = -1.0;
+	};
+
+	/**
+	 * Runs Body until at least MinSeconds are spent (small sets are repeated for stable numbers).
+	 * Body must process NumItems items per call.
+	 */
+	template <typename FuncType>
+	FResult Measure(const TCHAR* Name, int32 NumItems, bool bCountAllocs, FuncType&& Body)
+	{
+		constexpr double MinSeconds = 0.05;
+		constexpr int32 MaxIterations = 1000;
+
+		// Warm up caches and lazy statics outside the measure
+		Body();
+
+		FResult Result;
+		Result.Name = Name;
+		Result.NumItems = NumItems;
+
+		int64 NumAllocs = 0;
+		double Elapsed = 0.0;
+		{
+			SSVoiceCultureTests::FScopedAllocationCounter Allocations(bCountAllocs);
+			const double StartTime = FPlatformTime::Seconds();
+			do
+			{
+				Body();
+				Result.NumIterations++;
+				Elapsed = FPlatformTime::Seconds() - StartTime;
+			}
+			while (Elapsed < MinSeconds && Result.NumIterations < MaxIterations);
+			NumAllocs = Allocations.GetNumAllocs();
+		}
+
+		const double TotalItems = static_cast<double>(FMath::Max(NumItems, 1)) * Result.NumIterations;
+		Result.NsPerItem = Elapsed * 1.0e9 / TotalItems;
+		Result.AllocsPerItem = NumAllocs >= 0 ? NumAllocs / TotalItems : -1.0;
+		return Result;
+	}
+
+	/** In-memory registry: voice culture assets and their culture sounds */
+	struct FSyntheticRegistry
+	{
+		TArray<FString> Cultures;
+		TArray<FAssetData> VoiceAssets;
+		TArray<FAssetData> CultureSounds;
+		TArray<FString> CultureSoundNames;
+	};
+
+	/**
+	 * Generates NumNames culture sounds (NumNames / NumCultures lines, 50 lines per actor).
+	 * Default:  A_{culture}_NPC0001_L000001   DefaultB: A_NPC0001_L000001_{culture}
+	 * Voice assets are LVA_NPC0001_L000001, every other one misses its last culture in the tag.
+	 * Every tenth line has its last culture 50% longer in the "VoiceDurations" tag.
+	 */
+	void BuildSyntheticRegistry(int32 NumNames, int32 NumCultures, bool bCultureAtEnd, FSyntheticRegistry& Out)
+	{
+		static const TCHAR* CulturePool[] = {
+			TEXT("en"), TEXT("fr"), TEXT("de"), TEXT("es"), TEXT("it"), TEXT("ja"), TEXT("ko"), TEXT("zh"),
+			TEXT("pt"), TEXT("ru"), TEXT("pl"), TEXT("tr"), TEXT("ar"), TEXT("nl"), TEXT("sv"), TEXT("cs")
+		};
+
+		Out.Cultures.Reset(NumCultures);
+		for (int32 Index = 0; Index < NumCultures; ++Index)
+		{
+			// Past the pool, cultures are numbered (c16, c17...)
+			if (Index < static_cast<int32>(UE_ARRAY_COUNT(CulturePool)))
+			{
+				Out.Cultures.Add(CulturePool[Index]);
+			}
+			else
+			{
+				Out.Cultures.Add(FString::Printf(TEXT("c%d"), Index));
+			}
+		}
+
+		const int32 NumLines = FMath::Max(1, NumNames / NumCultures);
+		const FTopLevelAssetPath VoiceClassPath = USSVoiceCultureSound::StaticClass()->GetClassPathName();
+		const FTopLevelAssetPath SoundClassPath = USoundWave::StaticClass()->GetClassPathName();
+
+		const FString CompleteTag = FString::Join(Out.Cultures, TEXT(","));
+		const FString MissingTag = FString::Join(TArrayView<const FString>(Out.Cultures).LeftChop(1), TEXT(","));
+
+		FString DurationsTag;
+		FString LongDurationsTag;
+		for (int32 Index = 0; Index < Out.Cultures.Num(); ++Index)
+		{
+			const TCHAR* Separator = Index > 0 ? TEXT(",") : TEXT("");
+			const bool bLast = Index == Out.Cultures.Num() - 1;
+			DurationsTag += FString::Printf(TEXT("%s%s=2.000"), Separator, *Out.Cultures[Index]);
+			LongDurationsTag += FString::Printf(TEXT("%s%s=%s"), Separator, *Out.Cultures[Index],
+			                                    bLast && Index > 0 ? TEXT("3.000") : TEXT("2.000"));
+		}
+
+		Out.VoiceAssets.Reset(NumLines);
+		Out.CultureSounds.Reset(NumLines * NumCultures);
+		Out.CultureSoundNames.Reset(NumLines * NumCultures);
+
+		for (int32 Line = 0; Line < NumLines; ++Line)
+		{
+			const FString Suffix = FString::Printf(TEXT("NPC%04d_L%06d"), Line / 50, Line);
+
+			FAssetDataTagMap Tags;
+			Tags.Add(TEXT("VoiceCultures"), (Line & 1) ? MissingTag : CompleteTag);
+			Tags.Add(TEXT("VoiceDurations"), (Line % 10) == 0 ? LongDurationsTag : DurationsTag);
+
+			const FString VoiceName = TEXT("LVA_") + Suffix;
+			Out.VoiceAssets.Emplace(FName(TEXT("/Game/Bench/Voice/") + VoiceName), FName(TEXT("/Game/Bench/Voice")),
+			                        FName(VoiceName), VoiceClassPath, MoveTemp(Tags));
+
+			for (const FString& Culture : Out.Cultures)
+			{
+				FString SoundName = bCultureAtEnd
+					                    ? FString::Printf(TEXT("A_%s_%s"), *Suffix, *Culture)
+					                    : FString::Printf(TEXT("A_%s_%s"), *Culture, *Suffix);
+
+				Out.CultureSounds.Emplace(FName(TEXT("/Game/Bench/Audio/") + SoundName), FName(TEXT("/Game/Bench/Audio")),
+				                          FName(SoundName), SoundClassPath);
+				Out.CultureSoundNames.Add(MoveTemp(SoundName));
+			}
+		}
+	}
+
+	void WriteResults(const FString& Scheme, int32 NumNames, int32 NumCultures, const TArray<FResult>& Results)
+	{
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetStringField(TEXT("Scheme"), Scheme);
+		Root->SetNumberField(TEXT("Names"), NumNames);
+		Root->SetNumberField(TEXT("Cultures"), NumCultures);
+		Root->SetStringField(TEXT("Date"), FDateTime::UtcNow().ToIso8601());
+
+		TArray<TSharedPtr<FJsonValue>> JsonResults;
+		for (const FResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> JsonResult = MakeShared<FJsonObject>();
+			JsonResult->SetStringField(TEXT("Name"), Result.Name);
+			JsonResult->SetNumberField(TEXT("Items"), Result.NumItems);
+			JsonResult->SetNumberField(TEXT("Iterations"), Result.NumIterations);
+			JsonResult->SetNumberField(TEXT("NsPerItem"), Result.NsPerItem);
+			JsonResult->SetNumberField(TEXT("AllocsPerItem"), Result.AllocsPerItem);
+			JsonResults.Add(MakeShared<FJsonValueObject>(JsonResult));
+		}
+		Root->SetArrayField(TEXT("Results"), JsonResults);
+
+		FString Json;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+		FJsonSerializer::Serialize(Root, Writer);
+
+		const FString OutputPath = FPaths::ProjectSavedDir() /
+			FString::Printf(TEXT("SSVoiceCulture/Benchmarks/%s_%d.json"), *Scheme, NumNames);
+		if (!FFileHelper::SaveStringToFile(Json, *OutputPath))
+		{
+			UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write benchmark results to %s"), *OutputPath);
+		}
+	}
+
+	/** Temporarily replaces the supported cultures, GetAssetsWithCulture compares against them */
+	struct FScopedSupportedCultures
+	{
+		explicit FScopedSupportedCultures(const TArray<FString>& Cultures)
+		{
+			USSVoiceCultureSettings* Settings = GetMutableDefault<USSVoiceCultureSettings>();
+			Saved = Settings->SupportedVoiceCultures;
+			Settings->SupportedVoiceCultures = TSet<FString>(Cultures);
+		}
+
+		~FScopedSupportedCultures()
+		{
+			GetMutableDefault<USSVoiceCultureSettings>()->SupportedVoiceCultures = MoveTemp(Saved);
+		}
+
+	private:
+		TSet<FString> Saved;
+	};
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FSSVoiceCultureBenchmarkTest, "SSVoiceCulture.Benchmark.SyntheticRegistry",
+                                  EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FSSVoiceCultureBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	int32 MaxNames = 1000000;
+	FParse::Value(FCommandLine::Get(), TEXT("VoiceCultureBenchMax="), MaxNames);
+
+	for (const TCHAR* Scheme : {TEXT("Default"), TEXT("DefaultB")})
+	{
+		for (const int32 NumNames : {1000, 10000, 100000, 1000000})
+		{
+			if (NumNames > MaxNames)
+				continue;
+
+			OutBeautifiedNames.Add(FString::Printf(TEXT("%s.%d"), Scheme, NumNames));
+			OutTestCommands.Add(FString::Printf(TEXT("%s %d"), Scheme, NumNames));
+		}
+	}
+}
+
+bool FSSVoiceCultureBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace SSVoiceCultureBenchmark;
+
+	FString Scheme;
+	FString SizeString;
+	if (!Parameters.Split(TEXT(" "), &Scheme, &SizeString))
+	{
+		AddError(FString::Printf(TEXT("Invalid benchmark parameters '%s'"), *Parameters));
+		return false;
+	}
+
+	const int32 NumNames = FCString::Atoi(*SizeString);
+	const bool bCultureAtEnd = Scheme == TEXT("DefaultB");
+
+	int32 NumCultures = 8;
+	FParse::Value(FCommandLine::Get(), TEXT("VoiceCultureBenchCultures="), NumCultures);
+	NumCultures = FMath::Clamp(NumCultures, 1, 256);
+
+	const bool bCountAllocs = !FParse::Param(FCommandLine::Get(), TEXT("VoiceCultureBenchNoAllocs"));
+
+	FSyntheticRegistry Registry;
+	BuildSyntheticRegistry(NumNames, NumCultures, bCultureAtEnd, Registry);
+
+	USSVoiceCultureStrategy_Default* Strategy = bCultureAtEnd
+		                                            ? NewObject<USSVoiceCultureStrategy_DefaultB>()
+		                                            : NewObject<USSVoiceCultureStrategy_Default>();
+	TStrongObjectPtr<USSVoiceCultureStrategy> StrategyGuard(Strategy);
+
+	const int32 NumSounds = Registry.CultureSounds.Num();
+	const int32 NumVoices = Registry.VoiceAssets.Num();
+	TArray<FResult> Results;
+
+	// Strategy: name parsing
+	Results.Add(Measure(TEXT("ParseAssetName"), NumSounds, bCountAllocs, [&]()
+	{
+		FString Prefix, Culture, Suffix;
+		for (const FString& Name : Registry.CultureSoundNames)
+		{
+			Strategy->ParseAssetName(Name, Prefix, Culture, Suffix);
+		}
+	}));
+
+	Results.Add(Measure(TEXT("ParseCultureSoundAsset"), NumSounds, bCountAllocs, [&]()
+	{
+		FString Culture, Suffix;
+		for (const FAssetData& AssetData : Registry.CultureSounds)
+		{
+			Strategy->ParseCultureSoundAsset(AssetData, Culture, Suffix);
+		}
+	}));
+
+	Results.Add(Measure(TEXT("ExtractActorNameFromAsset"), NumVoices, bCountAllocs, [&]()
+	{
+		FString ActorName;
+		for (const FAssetData& AssetData : Registry.VoiceAssets)
+		{
+			Strategy->ExecuteExtractActorNameFromAsset(AssetData, ActorName);
+		}
+	}));
+
+	// Auto-populate: the batched matcher behind ExecuteAutoPopulate for whole cultures (per culture sound)
+	FSSVoiceCultureBatchOptions Options;
+	Options.bInteractive = false;
+
+	Results.Add(Measure(TEXT("BuildAutoPopulatePlan"), NumSounds, bCountAllocs, [&]()
+	{
+		TArray<FSSVoiceCultureAutoPopulateItem> Plan;
+		FSSVoiceCultureUtils::BuildAutoPopulatePlan(*Strategy, Registry.VoiceAssets, Registry.CultureSounds,
+		                                            Registry.Cultures, true, Options, Plan);
+	}));
+
+	// Auto-populate: legacy per-asset scan of the whole cache, worst case (no culture matches so nothing is loaded),
+	// reported per scanned cache entry
+	{
+		// Fresh outer so the voice asset names never collide with a previous run
+		UPackage* Outer = NewObject<UPackage>(GetTransientPackage(), NAME_None, RF_Transient);
+
+		const int32 NumTargets = FMath::Min(16, NumVoices);
+		TArray<USSVoiceCultureSound*> Targets;
+		for (int32 Index = 0; Index < NumTargets; ++Index)
+		{
+			Targets.Add(NewObject<USSVoiceCultureSound>(Outer, Registry.VoiceAssets[Index].AssetName, RF_Transient));
+		}
+
+		Results.Add(Measure(TEXT("OneCultureAutoPopulateScan"), NumTargets * NumSounds, bCountAllocs, [&]()
+		{
+			FSSCultureAudioEntry Entry;
+			for (USSVoiceCultureSound* Target : Targets)
+			{
+				Strategy->ExecuteOptimizedOneCultureAutoPopulateInAsset(Target, TEXT("zz"), true, Entry,
+				                                                        Registry.CultureSounds);
+			}
+		}));
+	}
+
+	// Filters: completeness split used by the missing / complete culture filters
+	if (USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get().IsLoadingAssets())
+	{
+		AddWarning(TEXT("Asset registry still scanning, culture filter benchmarks skipped."));
+	}
+	else
+	{
+		FScopedSupportedCultures SupportedCultures(Registry.Cultures);
+
+		Results.Add(Measure(TEXT("GetAssetsWithCulture"), NumVoices, bCountAllocs, [&]()
+		{
+			TArray<FAssetData> Assets = Registry.VoiceAssets;
+			USSVoiceCultureEditorSubsystem::GetAssetsWithCulture(Assets, false);
+		}));
+
+		Results.Add(Measure(TEXT("FindDurationMismatches"), NumVoices, bCountAllocs, [&]()
+		{
+			TArray<FSSVoiceCultureDurationMismatch> Mismatches;
+			FSSVoiceCultureUtils::FindDurationMismatches(Registry.VoiceAssets, Registry.Cultures[0], 1.3f, Options,
+			                                             Mismatches);
+		}));
+
+		Results.Add(Measure(TEXT("GetTaggedCultures"), NumVoices, bCountAllocs, [&]()
+		{
+			for (const FAssetData& AssetData : Registry.VoiceAssets)
+			{
+				FSSVoiceCultureUtils::GetTaggedCultures(AssetData);
+			}
+		}));
+
+		// Filter lookups go through TSet<FAssetData>, as in PassesFilter
+		const TSet<FAssetData> FilterSet(Registry.VoiceAssets);
+		int32 NumPassed = 0;
+		Results.Add(Measure(TEXT("FilterSetLookup"), NumVoices, bCountAllocs, [&]()
+		{
+			NumPassed = 0;
+			for (const FAssetData& AssetData : Registry.VoiceAssets)
+			{
+				NumPassed += FilterSet.Contains(AssetData) ? 1 : 0;
+			}
+		}));
+		TestEqual(TEXT("Every voice asset passes its own filter set"), NumPassed, NumVoices);
+	}
+
+	for (const FResult& Result : Results)
+	{
+		AddInfo(FString::Printf(TEXT("%-28s %9d items  %10.1f ns/item  %8.2f allocs/item"),
+		                        *Result.Name, Result.NumItems, Result.NsPerItem, Result.AllocsPerItem));
+	}
+
+	WriteResults(Scheme, NumNames, NumCultures, Results);
+	return true;
+}
+
+#endif
@@ -0,0 +1,377 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureIngestService.h"
+
+#include "AssetImportTask.h"
+#include "AssetToolsModule.h"
+#include "DirectoryWatcherModule.h"
+#include "Editor.h"
+#include "IDirectoryWatcher.h"
+#include "ObjectTools.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "Async/ParallelFor.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+#include "Sound/SoundBase.h"
+#include "Utils/SSVoiceCultureUI.h"
+#include "Utils/SSVoiceCultureUtils.h"
+
+#define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
+
+DECLARE_CYCLE_STAT(TEXT("Ingest Watch Folders"), STAT_VoiceCulture_Ingest, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** A file that fails to import this many times in a row is dropped until it changes again */
+	constexpr int32 MaxImportAttempts = 3;
+
+	bool IsAudioFile(const FString& Filename)
+	{
+		const FString Extension = FPaths::GetExtension(Filename);
+		return Extension.Equals(TEXT("wav"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("ogg"), ESearchCase::IgnoreCase) ||
+			Extension.Equals(TEXT("flac"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("aif"), ESearchCase::IgnoreCase) ||
+			Extension.Equals(TEXT("aiff"), ESearchCase::IgnoreCase);
+	}
+
+	/** One changed source file of a delivery */
+	struct FIngestFile
+	{
+		FString SourceFile;
+		int32 FolderIndex = INDEX_NONE;
+
+		/** Filled on a worker, an unset hash means the file is gone */
+		FMD5Hash Hash;
+		FString AssetName;
+	};
+}
+
+FSSVoiceCultureIngestService::~FSSVoiceCultureIngestService()
+{
+	Stop();
+}
+
+void FSSVoiceCultureIngestService::Start()
+{
+	Unwatch();
+
+	const USSVoiceCultureEditorSettings* Settings = USSVoiceCultureEditorSettings::GetSetting();
+	IDirectoryWatcher* DirectoryWatcher = Settings->bEnableWatchFolders && !IsRunningCommandlet()
+		                                      ? FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>("DirectoryWatcher").Get()
+		                                      : nullptr;
+	if (!DirectoryWatcher)
+	{
+		Stop();
+		return;
+	}
+
+	// WatchFolders was edited: pending files follow their folder to its new index, files of a removed folder are dropped
+	const TArray<FSSVoiceCultureWatchFolder> PreviousFolders = MoveTemp(Folders);
+	Folders = Settings->WatchFolders;
+	for (auto It = PendingFiles.CreateIterator(); It; ++It)
+	{
+		const FSSVoiceCultureWatchFolder& PreviousFolder = PreviousFolders[It->Value];
+		It->Value = Folders.IndexOfByPredicate([&PreviousFolder](const FSSVoiceCultureWatchFolder& Folder)
+		{
+			return Folder.SourceDirectory.Path == PreviousFolder.SourceDirectory.Path &&
+				Folder.Culture.Equals(PreviousFolder.Culture, ESearchCase::IgnoreCase);
+		});
+		if (It->Value == INDEX_NONE)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	for (int32 FolderIndex = 0; FolderIndex < Folders.Num(); ++FolderIndex)
+	{
+		const FSSVoiceCultureWatchFolder& Folder = Folders[FolderIndex];
+		const FString Directory = FPaths::ConvertRelativePathToFull(Folder.SourceDirectory.Path);
+		if (Folder.Culture.IsEmpty() || Folder.DestinationPath.Path.IsEmpty() || !FPaths::DirectoryExists(Directory))
+		{
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Watch folder '%s' (%s) skipped: culture, source or destination missing"),
+			       *Folder.SourceDirectory.Path, *Folder.Culture);
+			continue;
+		}
+
+		FWatch Watch;
+		Watch.Directory = Directory;
+		DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+			Directory, IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FSSVoiceCultureIngestService::HandleDirectoryChanged, FolderIndex),
+			Watch.Handle);
+		Watches.Add(MoveTemp(Watch));
+	}
+
+	if (Watches.Num() > 0)
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FSSVoiceCultureIngestService::Tick), 0.5f);
+
+		UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Watching %d vendor folder(s) for new voice lines"), Watches.Num());
+	}
+}
+
+void FSSVoiceCultureIngestService::Stop()
+{
+	Unwatch();
+	PendingFiles.Reset();
+	ImportAttempts.Reset();
+}
+
+void FSSVoiceCultureIngestService::Unwatch()
+{
+	if (FDirectoryWatcherModule* Module = FModuleManager::GetModulePtr<FDirectoryWatcherModule>("DirectoryWatcher"))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = Module->Get())
+		{
+			for (const FWatch& Watch : Watches)
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(Watch.Directory, Watch.Handle);
+			}
+		}
+	}
+	Watches.Reset();
+
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+void FSSVoiceCultureIngestService::HandleDirectoryChanged(const TArray<FFileChangeData>& Changes, int32 FolderIndex)
+{
+	for (const FFileChangeData& Change : Changes)
+	{
+		if (!IsAudioFile(Change.Filename))
+			continue;
+
+		const FString Filename = FPaths::ConvertRelativePathToFull(Change.Filename);
+		if (Change.Action == FFileChangeData::FCA_Removed)
+		{
+			// Imported sounds are kept, only a pending import is dropped
+			PendingFiles.Remove(Filename);
+			continue;
+		}
+		PendingFiles.Add(Filename, FolderIndex);
+		ImportAttempts.Remove(Filename);
+	}
+	LastChangeTime = FPlatformTime::Seconds();
+}
+
+bool FSSVoiceCultureIngestService::Tick(float DeltaTime)
+{
+	if (PendingFiles.Num() == 0)
+		return true;
+
+	// Wait for the copy to finish, and never import under PIE or a running dashboard job
+	const float SettleSeconds = USSVoiceCultureEditorSettings::GetSetting()->IngestSettleSeconds;
+	if (FPlatformTime::Seconds() - LastChangeTime < SettleSeconds || (GEditor && GEditor->PlayWorld))
+		return true;
+
+	USSVoiceCultureEditorSubsystem* Subsystem = GEditor ? GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>() : nullptr;
+	if (!Subsystem || Subsystem->IsJobRunning())
+		return true;
+
+	Flush();
+	return true;
+}
+
+void FSSVoiceCultureIngestService::Flush()
+{
+	if (PendingFiles.Num() == 0)
+		return;
+
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_Ingest, "VoiceCulture::IngestWatchFolders");
+
+	const double StartTime = FPlatformTime::Seconds();
+	const USSVoiceCultureEditorSettings* Settings = USSVoiceCultureEditorSettings::GetSetting();
+	USSVoiceCultureStrategy* Strategy = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>()->GetActiveStrategy();
+	if (!Strategy)
+	{
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Ingest skipped: no active voice strategy"));
+		return;
+	}
+
+	TArray<FIngestFile> Files;
+	Files.Reserve(PendingFiles.Num());
+	for (const TPair<FString, int32>& Pending : PendingFiles)
+	{
+		FIngestFile& File = Files.AddDefaulted_GetRef();
+		File.SourceFile = Pending.Key;
+		File.FolderIndex = Pending.Value;
+	}
+	PendingFiles.Reset();
+
+	// 1. Hash and name in parallel: file reads dominate, strategy naming is name-only and worker-safe
+	const FString Prefix = Settings->IngestAssetPrefix;
+	ParallelFor(Files.Num(), [&](int32 Index)
+	{
+		FIngestFile& File = Files[Index];
+		if (!FPaths::FileExists(File.SourceFile))
+			return;
+
+		File.Hash = FMD5Hash::HashFile(*File.SourceFile);
+
+		// Keep a file name that already follows the strategy for this culture, else build it (e.g. "A_fr_NPC01_Hello")
+		const FString& Culture = Folders[File.FolderIndex].Culture;
+		const FString BaseName = FPaths::GetBaseFilename(File.SourceFile);
+		FString NamePrefix;
+		FString NameCulture;
+		FString NameSuffix;
+		if (Strategy->ParseAssetName(BaseName, NamePrefix, NameCulture, NameSuffix) && NameCulture.Equals(Culture, ESearchCase::IgnoreCase))
+		{
+			File.AssetName = BaseName;
+		}
+		else
+		{
+			const FString Expected = Strategy->BuildExpectedAssetSuffix(Culture, BaseName);
+			File.AssetName = Expected.IsEmpty() ? BaseName : (Prefix.IsEmpty() ? Expected : Prefix + TEXT("_") + Expected);
+		}
+		File.AssetName = ObjectTools::SanitizeObjectName(File.AssetName);
+	}, Files.Num() <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// 2. Import the new or changed files in one batch
+	TArray<UAssetImportTask*> Tasks;
+	TArray<const FIngestFile*> TaskFiles;
+	for (const FIngestFile& File : Files)
+	{
+		if (!File.Hash.IsValid())
+			continue;
+
+		const FMD5Hash* Ingested = IngestedHashes.Find(File.SourceFile);
+		if (Ingested && *Ingested == File.Hash)
+			continue;
+
+		UAssetImportTask* Task = NewObject<UAssetImportTask>();
+		Task->Filename = File.SourceFile;
+		Task->DestinationPath = Folders[File.FolderIndex].DestinationPath.Path;
+		Task->DestinationName = File.AssetName;
+		Task->bReplaceExisting = true;
+		Task->bAutomated = true;
+		Task->bSave = Settings->bAutoSaveAfterAutoPopulate;
+		Tasks.Add(Task);
+		TaskFiles.Add(&File);
+	}
+	if (Tasks.Num() == 0)
+		return;
+
+	FAssetToolsModule::GetModule().Get().ImportAssetTasks(Tasks);
+
+	// 3. Link: only the voice assets of the imported lines, through the strategy's matching
+	TMap<FString, TArray<TPair<FString, FAssetData>>> SoundsBySuffix;
+	int32 NumImported = 0;
+	for (int32 TaskIndex = 0; TaskIndex < Tasks.Num(); ++TaskIndex)
+	{
+		const TArray<UObject*>& Objects = Tasks[TaskIndex]->GetObjects();
+		const FIngestFile& File = *TaskFiles[TaskIndex];
+		if (Objects.Num() > 0)
+		{
+			IngestedHashes.Add(File.SourceFile, File.Hash);
+			ImportAttempts.Remove(File.SourceFile);
+		}
+		else if (++ImportAttempts.FindOrAdd(File.SourceFile) < MaxImportAttempts)
+		{
+			// Retried once the folders settle again, e.g. a file the vendor tool was still writing
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Ingest: failed to import %s, queued again"), *File.SourceFile);
+			PendingFiles.Add(File.SourceFile, File.FolderIndex);
+			LastChangeTime = FPlatformTime::Seconds();
+		}
+		else
+		{
+			UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Ingest: failed to import %s after %d attempts, skipped until it changes"),
+			       *File.SourceFile, MaxImportAttempts);
+			ImportAttempts.Remove(File.SourceFile);
+		}
+
+		for (UObject* Object : Objects)
+		{
+			USoundBase* Sound = Cast<USoundBase>(Object);
+			if (!Sound)
+				continue;
+
+			NumImported++;
+			const FAssetData SoundData(Sound);
+			FString Culture;
+			FString Suffix;
+			if (Strategy->ParseCultureSoundAsset(SoundData, Culture, Suffix) && !Suffix.IsEmpty())
+			{
+				SoundsBySuffix.FindOrAdd(Suffix).Emplace(Culture, SoundData);
+			}
+		}
+	}
+
+	TArray<FAssetData> VoiceAssets;
+	for (const FAssetData& VoiceAsset : USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets())
+	{
+		if (SoundsBySuffix.Contains(Strategy->ExtractSuffixFromBaseName(VoiceAsset.AssetName.ToString())))
+		{
+			VoiceAssets.Add(VoiceAsset);
+		}
+	}
+	FSSVoiceCultureUtils::LoadAssetsParallel(VoiceAssets);
+
+	TSet<UPackage*> ModifiedPackages;
+	int32 NumLinked = 0;
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false));
+		if (!VoiceSound)
+			continue;
+
+		bool bModified = false;
+		for (const TPair<FString, FAssetData>& Sound : SoundsBySuffix.FindChecked(Strategy->ExtractSuffixFromBaseName(VoiceSound->GetName())))
+		{
+			// The new sound is the only candidate, a vendor delivery always replaces the previous take
+			FSSCultureAudioEntry NewEntry;
+			if (!Strategy->ExecuteOptimizedOneCultureAutoPopulateInAsset(VoiceSound, Sound.Key, true, NewEntry, {Sound.Value}))
+				continue;
+
+			FSSCultureAudioEntry* Existing = VoiceSound->VoiceCultures.FindByPredicate([&](const FSSCultureAudioEntry& Entry)
+			{
+				return Entry.Culture.Equals(NewEntry.Culture, ESearchCase::IgnoreCase);
+			});
+			if (Existing && Existing->Sound == NewEntry.Sound)
+				continue;
+
+			if (!bModified)
+			{
+				VoiceSound->Modify();
+				bModified = true;
+			}
+			if (Existing)
+			{
+				Existing->Sound = NewEntry.Sound;
+			}
+			else
+			{
+				VoiceSound->VoiceCultures.Add(NewEntry);
+			}
+			NumLinked++;
+		}
+
+		if (bModified)
+		{
+			VoiceSound->MarkPackageDirty();
+			ModifiedPackages.Add(VoiceSound->GetOutermost());
+		}
+	}
+
+	if (Settings->bAutoSaveAfterAutoPopulate)
+	{
+		FSSVoiceCultureUtils::SavePackages(ModifiedPackages);
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Ingest: %d file(s) imported, %d culture entry change(s) in %d voice asset(s) (%.2fs)"),
+	       NumImported, NumLinked, ModifiedPackages.Num(), FPlatformTime::Seconds() - StartTime);
+
+	FSSVoiceCultureUI::NotifySuccess(FText::Format(
+		LOCTEXT("IngestDone", "Voice delivery ingested: {0} sound(s) imported, {1} line(s) linked."),
+		FText::AsNumber(NumImported), FText::AsNumber(NumLinked)));
+}
+
+#undef LOCTEXT_NAMESPACE
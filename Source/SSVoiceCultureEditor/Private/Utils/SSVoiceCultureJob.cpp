@@ -0,0 +1,121 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureJob.h"
+
+#include "Async/Async.h"
+
+FSSVoiceCultureJob::FSSVoiceCultureJob(const FText& InTitle)
+	: Title(InTitle)
+{
+}
+
+FSSVoiceCultureJob& FSSVoiceCultureJob::AddWorkerPhase(const FText& Label, FWorkerPhase&& Work)
+{
+	FPhase& Phase = Phases.AddDefaulted_GetRef();
+	Phase.Label = Label;
+	Phase.Work = MoveTemp(Work);
+	return *this;
+}
+
+FSSVoiceCultureJob& FSSVoiceCultureJob::AddGameThreadPhase(const FText& Label, FGameThreadStep&& Step)
+{
+	FPhase& Phase = Phases.AddDefaulted_GetRef();
+	Phase.Label = Label;
+	Phase.Step = MoveTemp(Step);
+	return *this;
+}
+
+FSSVoiceCultureJob& FSSVoiceCultureJob::OnFinished(FOnFinished&& Callback)
+{
+	FinishedCallback = MoveTemp(Callback);
+	return *this;
+}
+
+float FSSVoiceCultureJob::GetProgress() const
+{
+	if (Phases.Num() == 0)
+		return 1.f;
+
+	return (FMath::Min(CurrentPhase, Phases.Num()) + PhaseProgress.load()) / Phases.Num();
+}
+
+FText FSSVoiceCultureJob::GetStatusText() const
+{
+	if (bCancelRequested)
+		return NSLOCTEXT("SSVoiceCultureEditor", "JobCancelling", "Cancelling...");
+
+	return Phases.IsValidIndex(CurrentPhase) ? Phases[CurrentPhase].Label : FText::GetEmpty();
+}
+
+bool FSSVoiceCultureJob::Tick(double TimeBudgetSeconds)
+{
+	check(IsInGameThread());
+
+	if (bFinished)
+		return true;
+
+	const double EndTime = FPlatformTime::Seconds() + TimeBudgetSeconds;
+
+	while (Phases.IsValidIndex(CurrentPhase))
+	{
+		FPhase& Phase = Phases[CurrentPhase];
+
+		if (Phase.Work)
+		{
+			// Launch once, then poll
+			if (!WorkerFuture.IsValid())
+			{
+				if (bCancelRequested)
+					break;
+
+				WorkerFuture = Async(EAsyncExecution::ThreadPool, [this, PhaseIndex = CurrentPhase]()
+				{
+					Phases[PhaseIndex].Work(*this);
+				});
+				return false;
+			}
+
+			if (!WorkerFuture.IsReady())
+				return false;
+
+			WorkerFuture.Reset();
+		}
+		else
+		{
+			if (bCancelRequested)
+				break;
+
+			// Time-sliced: at least one step per tick, then as many as the budget allows
+			bool bPhaseDone = false;
+			do
+			{
+				bPhaseDone = Phase.Step(*this);
+			}
+			while (!bPhaseDone && !bCancelRequested && FPlatformTime::Seconds() < EndTime);
+
+			if (!bPhaseDone)
+				return false;
+		}
+
+		CurrentPhase++;
+		PhaseProgress = 0.f;
+	}
+
+	Finish();
+	return true;
+}
+
+void FSSVoiceCultureJob::Finish()
+{
+	bFinished = true;
+
+	if (FinishedCallback)
+	{
+		FinishedCallback(bCancelRequested);
+	}
+}
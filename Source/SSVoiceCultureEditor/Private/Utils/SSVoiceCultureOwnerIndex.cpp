@@ -0,0 +1,188 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureOwnerIndex.h"
+
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/ParallelFor.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+#include "Sound/SoundBase.h"
+
+namespace
+{
+	/** Culture sounds of a voice asset: soft dependencies that FindSound resolves to a sound */
+	template <typename FindSoundType>
+	TArray<FSSVoiceCultureSoundOwner> GetVoiceAssetOwners(IAssetRegistry& AssetRegistry, const USSVoiceCultureStrategy* Strategy,
+	                                                      const FAssetData& VoiceAsset, FindSoundType&& FindSound)
+	{
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(VoiceAsset.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+		                              UE::AssetRegistry::EDependencyQuery::Soft);
+
+		TArray<FSSVoiceCultureSoundOwner> Owners;
+		FString Culture;
+		FString Suffix;
+		for (const FName& Dependency : Dependencies)
+		{
+			const FAssetData* Sound = FindSound(Dependency);
+			if (!Sound)
+				continue;
+
+			FSSVoiceCultureSoundOwner& Owner = Owners.AddDefaulted_GetRef();
+			Owner.Sound = Sound->GetSoftObjectPath();
+			Owner.VoiceAsset = VoiceAsset.GetSoftObjectPath();
+			if (Strategy && Strategy->ParseCultureSoundAsset(*Sound, Culture, Suffix))
+			{
+				Owner.Culture = Culture;
+			}
+		}
+		return Owners;
+	}
+}
+
+void FSSVoiceCultureOwnerIndex::Build(IAssetRegistry& AssetRegistry, const USSVoiceCultureStrategy* Strategy,
+                                      const TArray<FAssetData>& VoiceAssets, const TArray<FAssetData>& SoundAssets,
+                                      int32 NumChunks)
+{
+	Reset();
+
+	TMap<FName, const FAssetData*> SoundsByPackage;
+	SoundsByPackage.Reserve(SoundAssets.Num());
+	for (const FAssetData& Sound : SoundAssets)
+	{
+		SoundsByPackage.Add(Sound.PackageName, &Sound);
+	}
+
+	auto FindSound = [&SoundsByPackage](FName Package) -> const FAssetData*
+	{
+		const FAssetData* const* Sound = SoundsByPackage.Find(Package);
+		return Sound ? *Sound : nullptr;
+	};
+
+	// Registry reads are thread-safe, each chunk writes to its own slots
+	TArray<TArray<FSSVoiceCultureSoundOwner>> Owners;
+	Owners.SetNum(VoiceAssets.Num());
+
+	NumChunks = FMath::Clamp(NumChunks, 1, FMath::Max(1, VoiceAssets.Num()));
+	const int32 ChunkSize = FMath::DivideAndRoundUp(VoiceAssets.Num(), NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, VoiceAssets.Num());
+		for (int32 i = Start; i < End; ++i)
+		{
+			Owners[i] = GetVoiceAssetOwners(AssetRegistry, Strategy, VoiceAssets[i], FindSound);
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (int32 i = 0; i < VoiceAssets.Num(); ++i)
+	{
+		Add(VoiceAssets[i].PackageName, MoveTemp(Owners[i]));
+	}
+}
+
+void FSSVoiceCultureOwnerIndex::AddVoiceAsset(IAssetRegistry& AssetRegistry, const USSVoiceCultureStrategy* Strategy,
+                                              const FAssetData& VoiceAsset)
+{
+	RemoveVoiceAsset(VoiceAsset.PackageName);
+
+	TArray<FAssetData> PackageAssets;
+	FAssetData Sound;
+	TArray<FSSVoiceCultureSoundOwner> Owners = GetVoiceAssetOwners(AssetRegistry, Strategy, VoiceAsset,
+		[&](FName Package) -> const FAssetData*
+		{
+			PackageAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(Package, PackageAssets);
+
+			const FAssetData* Found = PackageAssets.FindByPredicate([](const FAssetData& Asset)
+			{
+				return Asset.IsInstanceOf(USoundBase::StaticClass());
+			});
+			if (!Found)
+				return nullptr;
+
+			Sound = *Found;
+			return &Sound;
+		});
+
+	Add(VoiceAsset.PackageName, MoveTemp(Owners));
+}
+
+void FSSVoiceCultureOwnerIndex::Add(FName VoicePackage, TArray<FSSVoiceCultureSoundOwner>&& Owners)
+{
+	if (Owners.Num() == 0)
+		return;
+
+	TArray<FName>& Sounds = SoundsByOwner.Add(VoicePackage);
+	for (FSSVoiceCultureSoundOwner& Owner : Owners)
+	{
+		const FName SoundPackage = Owner.Sound.GetLongPackageFName();
+		Sounds.AddUnique(SoundPackage);
+		OwnersBySound.FindOrAdd(SoundPackage).Add(MoveTemp(Owner));
+	}
+}
+
+void FSSVoiceCultureOwnerIndex::RemoveVoiceAsset(FName VoicePackage)
+{
+	TArray<FName> Sounds;
+	if (!SoundsByOwner.RemoveAndCopyValue(VoicePackage, Sounds))
+		return;
+
+	for (const FName& SoundPackage : Sounds)
+	{
+		TArray<FSSVoiceCultureSoundOwner>* Owners = OwnersBySound.Find(SoundPackage);
+		if (!Owners)
+			continue;
+
+		Owners->RemoveAll([VoicePackage](const FSSVoiceCultureSoundOwner& Owner)
+		{
+			return Owner.VoiceAsset.GetLongPackageFName() == VoicePackage;
+		});
+		if (Owners->Num() == 0)
+		{
+			OwnersBySound.Remove(SoundPackage);
+		}
+	}
+}
+
+void FSSVoiceCultureOwnerIndex::RenameSound(FName OldSoundPackage, const FAssetData& NewSound)
+{
+	const FName NewSoundPackage = NewSound.PackageName;
+
+	TArray<FSSVoiceCultureSoundOwner> Owners;
+	if (!OwnersBySound.RemoveAndCopyValue(OldSoundPackage, Owners))
+		return;
+
+	for (FSSVoiceCultureSoundOwner& Owner : Owners)
+	{
+		Owner.Sound = NewSound.GetSoftObjectPath();
+
+		if (TArray<FName>* Sounds = SoundsByOwner.Find(Owner.VoiceAsset.GetLongPackageFName()))
+		{
+			Sounds->Remove(OldSoundPackage);
+			Sounds->AddUnique(NewSoundPackage);
+		}
+	}
+	OwnersBySound.FindOrAdd(NewSoundPackage).Append(MoveTemp(Owners));
+}
+
+void FSSVoiceCultureOwnerIndex::RemoveSound(FName SoundPackage)
+{
+	OwnersBySound.Remove(SoundPackage);
+}
+
+const TArray<FSSVoiceCultureSoundOwner>* FSSVoiceCultureOwnerIndex::Find(FName SoundPackage) const
+{
+	return OwnersBySound.Find(SoundPackage);
+}
+
+void FSSVoiceCultureOwnerIndex::Reset()
+{
+	OwnersBySound.Reset();
+	SoundsByOwner.Reset();
+}
@@ -0,0 +1,221 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureSearchIndex.h"
+
+namespace
+{
+	/** Packs three characters (21 bits each covers every code point) */
+	FORCEINLINE uint64 MakeTrigram(TCHAR A, TCHAR B, TCHAR C)
+	{
+		return (static_cast<uint64>(A) << 42) | (static_cast<uint64>(B) << 21) | static_cast<uint64>(C);
+	}
+}
+
+void FSSVoiceCultureSearchIndex::ExtractTrigrams(const FString& TextLower, TArray<uint64>& OutTrigrams)
+{
+	OutTrigrams.Reset();
+
+	// "  abc " -> "  a", " ab", "abc", "bc "
+	const int32 Len = TextLower.Len();
+	auto CharAt = [&TextLower, Len](int32 Index) -> TCHAR
+	{
+		return Index >= 0 && Index < Len ? TextLower[Index] : TEXT(' ');
+	};
+
+	for (int32 i = -2; i < Len; ++i)
+	{
+		OutTrigrams.AddUnique(MakeTrigram(CharAt(i), CharAt(i + 1), CharAt(i + 2)));
+	}
+}
+
+int32 FSSVoiceCultureSearchIndex::Add(ESSVoiceSearchKind Kind, const FString& Text, const FSoftObjectPath& AssetPath)
+{
+	const int32 DocumentId = Documents.Num();
+
+	FDocument& Document = Documents.AddDefaulted_GetRef();
+	Document.Text = Text;
+	Document.TextLower = Text.ToLower();
+	Document.AssetPath = AssetPath;
+	Document.Kind = Kind;
+
+	IndexDocument(DocumentId);
+	NumAlive++;
+	return DocumentId;
+}
+
+void FSSVoiceCultureSearchIndex::IndexDocument(int32 DocumentId)
+{
+	FDocument& Document = Documents[DocumentId];
+
+	TArray<uint64> Trigrams;
+	ExtractTrigrams(Document.TextLower, Trigrams);
+
+	Document.NumTrigrams = static_cast<uint16>(FMath::Min(Trigrams.Num(), static_cast<int32>(MAX_uint16)));
+	for (const uint64 Trigram : Trigrams)
+	{
+		Postings.FindOrAdd(Trigram).Add(DocumentId);
+	}
+}
+
+void FSSVoiceCultureSearchIndex::Remove(int32 DocumentId)
+{
+	if (!Documents.IsValidIndex(DocumentId) || !Documents[DocumentId].bAlive)
+		return;
+
+	// Postings keep the id until Compact, Search skips dead documents
+	Documents[DocumentId].bAlive = false;
+	NumAlive--;
+}
+
+void FSSVoiceCultureSearchIndex::Reset()
+{
+	Documents.Reset();
+	Postings.Reset();
+	NumAlive = 0;
+}
+
+bool FSSVoiceCultureSearchIndex::Compact(TArray<int32>& OutRemap)
+{
+	OutRemap.Reset();
+
+	// Worth it once a quarter of the documents are dead
+	if (Documents.Num() - NumAlive < Documents.Num() / 4)
+		return false;
+
+	TArray<FDocument> OldDocuments = MoveTemp(Documents);
+	Reset();
+
+	OutRemap.Init(INDEX_NONE, OldDocuments.Num());
+	Documents.Reserve(OldDocuments.Num());
+	for (int32 OldId = 0; OldId < OldDocuments.Num(); ++OldId)
+	{
+		FDocument& Document = OldDocuments[OldId];
+		if (!Document.bAlive)
+			continue;
+
+		OutRemap[OldId] = Documents.Add(MoveTemp(Document));
+		IndexDocument(OutRemap[OldId]);
+		NumAlive++;
+	}
+	return true;
+}
+
+void FSSVoiceCultureSearchIndex::Search(const FString& Query, ESSVoiceSearchKind Kinds, int32 MaxResults,
+                                        TArray<FSSVoiceSearchResult>& OutResults, float MinScore) const
+{
+	OutResults.Reset();
+
+	FString QueryLower = Query.TrimStartAndEnd().ToLower();
+	if (QueryLower.IsEmpty() || MaxResults <= 0)
+		return;
+
+	TArray<uint64> QueryTrigrams;
+	ExtractTrigrams(QueryLower, QueryTrigrams);
+
+	// The trailing-padding trigram of the query only matches whole words, a typed prefix should not need it
+	QueryTrigrams.RemoveAt(QueryTrigrams.Num() - 1);
+	if (QueryTrigrams.Num() == 0)
+		return;
+
+	// Count shared trigrams per candidate document (dense counters, only touched ones are reset)
+	if (SharedCounts.Num() < Documents.Num())
+	{
+		SharedCounts.SetNumZeroed(Documents.Num());
+	}
+	TouchedDocuments.Reset();
+
+	for (const uint64 Trigram : QueryTrigrams)
+	{
+		const TArray<int32>* DocumentIds = Postings.Find(Trigram);
+		if (!DocumentIds)
+			continue;
+
+		for (const int32 DocumentId : *DocumentIds)
+		{
+			if (SharedCounts[DocumentId]++ == 0)
+			{
+				TouchedDocuments.Add(DocumentId);
+			}
+		}
+	}
+
+	struct FCandidate
+	{
+		int32 DocumentId;
+		float Score;
+	};
+
+	// Lowest kept score on top, so only MaxResults candidates are ever sorted
+	auto WorseFirst = [](const FCandidate& A, const FCandidate& B) { return A.Score < B.Score; };
+	TArray<FCandidate> Best;
+	Best.Reserve(MaxResults + 1);
+
+	for (const int32 DocumentId : TouchedDocuments)
+	{
+		const int32 NumShared = SharedCounts[DocumentId];
+		SharedCounts[DocumentId] = 0;
+
+		const FDocument& Document = Documents[DocumentId];
+		if (!Document.bAlive || !EnumHasAnyFlags(Kinds, Document.Kind))
+			continue;
+
+		// Similarity against the query, not the whole document, so long IDs are found by part
+		float Score = static_cast<float>(NumShared) / QueryTrigrams.Num();
+
+		if (Document.TextLower.Equals(QueryLower, ESearchCase::CaseSensitive))
+		{
+			Score = 1.f;
+		}
+		else if (Document.TextLower.StartsWith(QueryLower, ESearchCase::CaseSensitive))
+		{
+			Score = 0.9f + 0.09f * Score;
+		}
+		else if (Document.TextLower.Contains(QueryLower, ESearchCase::CaseSensitive))
+		{
+			Score = 0.8f + 0.09f * Score;
+		}
+		else
+		{
+			// Fuzzy: also penalize documents much longer than the query
+			const float Coverage = static_cast<float>(NumShared) / FMath::Max<int32>(1, Document.NumTrigrams);
+			Score = 0.7f * Score + 0.1f * Coverage;
+		}
+
+		if (Score < MinScore)
+			continue;
+
+		if (Best.Num() == MaxResults && Score <= Best.HeapTop().Score)
+			continue;
+
+		Best.HeapPush({DocumentId, Score}, WorseFirst);
+		if (Best.Num() > MaxResults)
+		{
+			Best.HeapPopDiscard(WorseFirst);
+		}
+	}
+
+	// Best first, shorter texts first on ties
+	Best.Sort([this](const FCandidate& A, const FCandidate& B)
+	{
+		if (A.Score != B.Score)
+			return A.Score > B.Score;
+		return Documents[A.DocumentId].Text.Len() < Documents[B.DocumentId].Text.Len();
+	});
+
+	OutResults.Reserve(Best.Num());
+	for (const FCandidate& Candidate : Best)
+	{
+		const FDocument& Document = Documents[Candidate.DocumentId];
+
+		FSSVoiceSearchResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Kind = Document.Kind;
+		Result.Text = Document.Text;
+		Result.AssetPath = Document.AssetPath;
+		Result.Score = Candidate.Score;
+	}
+}
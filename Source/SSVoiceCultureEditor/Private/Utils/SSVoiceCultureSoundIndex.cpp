@@ -0,0 +1,91 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureSoundIndex.h"
+
+#include "Async/ParallelFor.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+
+void FSSVoiceCultureSoundIndex::Build(const USSVoiceCultureStrategy& Strategy, const TArray<FAssetData>& SoundAssets,
+                                      int32 NumChunks)
+{
+	Reset();
+
+	struct FParsedSound
+	{
+		FString Culture;
+		FString Suffix;
+		bool bValid = false;
+	};
+
+	// Parse every name in parallel, each chunk writes to its own slots
+	TArray<FParsedSound> Parsed;
+	Parsed.SetNum(SoundAssets.Num());
+
+	NumChunks = FMath::Clamp(NumChunks, 1, FMath::Max(1, SoundAssets.Num()));
+	const int32 ChunkSize = FMath::DivideAndRoundUp(SoundAssets.Num(), NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, SoundAssets.Num());
+		for (int32 i = Start; i < End; ++i)
+		{
+			FParsedSound& Out = Parsed[i];
+			Out.bValid = Strategy.ParseCultureSoundAsset(SoundAssets[i], Out.Culture, Out.Suffix);
+			if (Out.bValid)
+			{
+				Out.Suffix.ToLowerInline();
+			}
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// Merge in registry order, first sound found for a culture wins (same as the linear scan)
+	for (int32 i = 0; i < Parsed.Num(); ++i)
+	{
+		FParsedSound& Sound = Parsed[i];
+		if (!Sound.bValid)
+			continue;
+
+		TArray<FEntry>& Line = SoundsBySuffix.FindOrAdd(MoveTemp(Sound.Suffix));
+		if (Line.ContainsByPredicate([&](const FEntry& Entry) { return Entry.Culture == Sound.Culture; }))
+			continue;
+
+		FEntry& Entry = Line.AddDefaulted_GetRef();
+		Entry.Culture = MoveTemp(Sound.Culture);
+		Entry.Asset = SoundAssets[i];
+		NumSounds++;
+	}
+}
+
+const FAssetData* FSSVoiceCultureSoundIndex::Find(const FString& Suffix, const FString& Culture) const
+{
+	const TArray<FEntry>* Line = FindLine(Suffix);
+	if (!Line)
+		return nullptr;
+
+	for (const FEntry& Entry : *Line)
+	{
+		if (Entry.Culture.Equals(Culture, ESearchCase::IgnoreCase))
+		{
+			return &Entry.Asset;
+		}
+	}
+	return nullptr;
+}
+
+const TArray<FSSVoiceCultureSoundIndex::FEntry>* FSSVoiceCultureSoundIndex::FindLine(const FString& Suffix) const
+{
+	// TMap<FString> hashing is case-insensitive, no need to lowercase the key
+	return SoundsBySuffix.Find(Suffix);
+}
+
+void FSSVoiceCultureSoundIndex::Reset()
+{
+	SoundsBySuffix.Reset();
+	NumSounds = 0;
+}
@@ -7,6 +7,8 @@
 #include "Utils/SSVoiceCultureUI.h"
 
 #include "EditorStyleSet.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "Framework/Application/SlateApplication.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "Internationalization/Culture.h"
 #include "Widgets/Notifications/SNotificationList.h"
@@ -15,6 +17,13 @@
 
 void FSSVoiceCultureUI::NotifySuccess(const FText& Message, float Duration)
 {
+	// Headless (commandlet): log instead
+	if (!FSlateApplication::IsInitialized())
+	{
+		UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %s"), *Message.ToString());
+		return;
+	}
+
 	FNotificationInfo Info(Message);
 	Info.ExpireDuration = Duration;
 	Info.bUseLargeFont = false;
@@ -24,6 +33,12 @@ void FSSVoiceCultureUI::NotifySuccess(const FText& Message, float Duration)
 
 void FSSVoiceCultureUI::NotifyFailure(const FText& Message, float Duration)
 {
+	if (!FSlateApplication::IsInitialized())
+	{
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] %s"), *Message.ToString());
+		return;
+	}
+
 	FNotificationInfo Info(Message);
 	Info.ExpireDuration = Duration;
 	Info.bUseLargeFont = false;
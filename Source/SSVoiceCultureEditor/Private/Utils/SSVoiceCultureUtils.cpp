@@ -22,7 +22,7 @@
 
 #define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
 
-bool FSSVoiceCultureUtils::SaveAsset(UPackage* Package, const FString& PackageFilename)
+bool FSSVoiceCultureUtils::SaveAsset(UPackage* Package, const FString& PackageFilename, bool bAsyncWrite)
 {
 	if (!Package)
 	{
@@ -35,7 +35,7 @@ bool FSSVoiceCultureUtils::SaveAsset(UPackage* Package, const FString& PackageFi
 	FSavePackageArgs SaveArgs;
 	SaveArgs.TopLevelFlags = EObjectFlags::RF_Standalone;
 	SaveArgs.Error = GError;
-	SaveArgs.SaveFlags = SAVE_NoError;
+	SaveArgs.SaveFlags = bAsyncWrite ? SAVE_NoError | SAVE_Async : SAVE_NoError;
 
 	return UPackage::SavePackage(Package, nullptr, *PackageFilename, SaveArgs);
 
@@ -50,11 +50,64 @@ bool FSSVoiceCultureUtils::SaveAsset(UPackage* Package, const FString& PackageFi
 		nullptr,
 		true, // bSaveToDisk
 		true, // bForceByteSwapping
-		SAVE_NoError
+		bAsyncWrite ? SAVE_NoError | SAVE_Async : SAVE_NoError
 	);
 #endif
 }
 
+int32 FSSVoiceCultureUtils::SavePackages(const TSet<UPackage*>& Packages)
+{
+	int32 SavedCount = 0;
+
+	// Serialize on the game thread, write files in the background
+	for (UPackage* Package : Packages)
+	{
+		FString PackageFilename;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(
+			Package->GetName(), PackageFilename, FPackageName::GetAssetPackageExtension()))
+			continue;
+
+		if (SaveAsset(Package, PackageFilename, true))
+		{
+			SavedCount++;
+		}
+	}
+
+	UPackage::WaitForAsyncFileWrites();
+	return SavedCount;
+}
+
+void FSSVoiceCultureUtils::LoadAssetsParallel(TConstArrayView<FAssetData> Assets)
+{
+	// Async loading reads and deserializes the packages concurrently, much faster than one LoadObject per asset
+	for (const FAssetData& Asset : Assets)
+	{
+		if (!Asset.IsAssetLoaded())
+		{
+			LoadPackageAsync(Asset.PackageName.ToString());
+		}
+	}
+	FlushAsyncLoading();
+}
+
+UObject* FSSVoiceCultureUtils::LoadOrCreateAsset(UClass* Class, const FString& PackageName, const FString& AssetName)
+{
+	const FSoftObjectPath ObjectPath(PackageName + TEXT(".") + AssetName);
+	if (UObject* Existing = ObjectPath.TryLoad())
+	{
+		if (Existing->IsA(Class))
+			return Existing;
+
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] %s is not a %s"), *ObjectPath.ToString(), *Class->GetName());
+		return nullptr;
+	}
+
+	UPackage* Package = CreatePackage(*PackageName);
+	UObject* Asset = NewObject<UObject>(Package, Class, *AssetName, RF_Public | RF_Standalone);
+	FAssetRegistryModule::AssetCreated(Asset);
+	return Asset;
+}
+
 bool FSSVoiceCultureUtils::AutoPopulateFromNaming(USSVoiceCultureSound* TargetAsset, const bool bShowSlowTask,
                                                   const bool bShowNotify)
 {
@@ -184,29 +237,65 @@ bool FSSVoiceCultureUtils::AutoPopulateFromNaming(USSVoiceCultureSound* TargetAs
 	return true;
 }
 
-bool FSSVoiceCultureUtils::AutoPopulateFromVoiceActor(const FString& VoiceActorName, bool bOnlyMissingCulture)
+namespace
 {
-	// Declare a progress bar for the full process
-	const FText TaskTitle = FText::FromString(TEXT("Populating voice culture assets..."));
-	FScopedSlowTask SlowTask(4.f, TaskTitle); // We'll add sub-steps as we go
-	SlowTask.MakeDialog(true); // Show UI with cancel button
+	/** Returns the active strategy if its naming rules can run on registry data (native C++ class). */
+	USSVoiceCultureStrategy* GetPlanStrategy(bool& bOutNative)
+	{
+		auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+		USSVoiceCultureStrategy* Strategy = VLEditorSubsystem->GetActiveStrategy();
 
-	// Step 1: Retrieve all voice culture sound assets
-	SlowTask.EnterProgressFrame(1.f, FText::FromString(TEXT("Gathering all voice culture assets...")));
+		// Blueprint strategies override the BlueprintNativeEvents only, which need loaded assets
+		bOutNative = IsValid(Strategy) && Strategy->GetClass()->HasAnyClassFlags(CLASS_Native);
+		return Strategy;
+	}
 
-	TArray<FAssetData> Assets;
+	/** Plan + apply on the given voice assets, filling the timings of Stats. */
+	int32 RunAutoPopulatePlan(const USSVoiceCultureStrategy& Strategy, const TArray<FAssetData>& VoiceAssets,
+	                          const TArray<FString>& Cultures, bool bOverrideExisting,
+	                          const FSSVoiceCultureBatchOptions& Options, FSSVoiceCultureOperationStats& Stats)
+	{
+		// Phase 1 - registry scan, every SoundBase once
+		double PhaseStart = FPlatformTime::Seconds();
+		const TArray<FAssetData> AllSoundAssets = USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets();
+		Stats.ScanSeconds += FPlatformTime::Seconds() - PhaseStart;
+
+		// Phase 2 - name matching on metadata only
+		PhaseStart = FPlatformTime::Seconds();
+		TArray<FSSVoiceCultureAutoPopulateItem> Plan;
+		FSSVoiceCultureUtils::BuildAutoPopulatePlan(Strategy, VoiceAssets, AllSoundAssets, Cultures, bOverrideExisting,
+		                                            Options, Plan);
+		Stats.MatchSeconds += FPlatformTime::Seconds() - PhaseStart;
+		Stats.AssetsMatched += Plan.Num();
+
+		// Phase 3 - load, modify and save matched assets only
+		return FSSVoiceCultureUtils::ApplyAutoPopulatePlan(Plan, bOverrideExisting, Options, Stats);
+	}
+}
 
-	// Check for user cancel
-	if (SlowTask.ShouldCancel())
+bool FSSVoiceCultureUtils::AutoPopulateFromVoiceActor(const FString& VoiceActorName, bool bOnlyMissingCulture,
+                                                      const FSSVoiceCultureBatchOptions& Options,
+                                                      FSSVoiceCultureOperationStats* OutStats,
+                                                      const TArray<FString>& Cultures)
+{
+	FSSVoiceCultureOperationStats Stats;
+	Stats.Operation = FString::Printf(TEXT("AutoPopulateFromVoiceActor:%s"), *VoiceActorName);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Declare a progress bar for the full process
+	const FText TaskTitle = FText::FromString(TEXT("Populating voice culture assets..."));
+	FScopedSlowTask SlowTask(3.f, TaskTitle, Options.bInteractive);
+	if (Options.bInteractive)
 	{
-		return false;
+		SlowTask.MakeDialog(true); // Show UI with cancel button
 	}
 
-	// Step 2: Filter by specific voice actor
+	// Step 1: Filter by specific voice actor
 	SlowTask.EnterProgressFrame(1.f, FText::Format(
 		                            NSLOCTEXT("SSVoiceCultureEditor", "FilterByVoiceActor", "Filtering assets by voice actor: {0}"),
 		                            FText::FromString(VoiceActorName)
 	                            ));
+	TArray<FAssetData> Assets;
 	USSVoiceCultureEditorSubsystem::GetAssetsFromVoiceActor(Assets, VoiceActorName);
 
 	if (SlowTask.ShouldCancel())
@@ -214,59 +303,77 @@ bool FSSVoiceCultureUtils::AutoPopulateFromVoiceActor(const FString& VoiceActorN
 		return false;
 	}
 
-	// Step 3: Optionally filter only the ones that are missing a culture (e.g., not yet localized)
+	// Step 2: Optionally filter only the ones that are missing a culture (e.g., not yet localized)
+	SlowTask.EnterProgressFrame(1.f, FText::FromString(TEXT("Filtering assets with missing culture...")));
 	if (bOnlyMissingCulture)
 	{
-		SlowTask.EnterProgressFrame(1.f, FText::FromString(TEXT("Filtering assets with missing culture...")));
 		USSVoiceCultureEditorSubsystem::GetAssetsWithCulture(Assets, false);
+	}
+	Stats.AssetsScanned = Assets.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
 
-		if (SlowTask.ShouldCancel())
-		{
-			return false;
-		}
+	if (SlowTask.ShouldCancel())
+	{
+		return false;
 	}
 
-	// Still consume the progress frame even if no filtering
+	// Step 3: Match and apply
 	SlowTask.EnterProgressFrame(1.f);
 
-	bool bOneSuccessAtLeast = false;
-
-	// Add sub-steps to track per asset
-	SlowTask.TotalAmountOfWork += Assets.Num(); // Add dynamic steps
+	bool bNativeStrategy = false;
+	USSVoiceCultureStrategy* Strategy = GetPlanStrategy(bNativeStrategy);
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
 
-	for (auto& Asset : Assets)
+	if (bNativeStrategy)
+	{
+		// An empty list would let the plan fill every culture the strategy finds
+		const TArray<FString> PlanCultures = Cultures.Num() > 0
+			                                     ? Cultures
+			                                     : USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures.Array();
+		RunAutoPopulatePlan(*Strategy, Assets, PlanCultures, EditorSettings->bAutoPopulateOverwriteExisting,
+		                    Options, Stats);
+	}
+	else
 	{
-		// Check for user cancellation
-		if (SlowTask.ShouldCancel())
+		// Blueprint strategy: per-asset fallback
+		const double ApplyStart = FPlatformTime::Seconds();
+		for (auto& Asset : Assets)
 		{
-			break;
-		}
+			if (SlowTask.ShouldCancel())
+				break;
 
-		// Advance the progress bar
-		SlowTask.EnterProgressFrame(1.f, FText::FromName(Asset.AssetName));
+			USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(Asset.GetAsset());
+			if (!VoiceSound)
+				continue;
 
-		// Load the asset and cast to the expected class
-		USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(Asset.GetAsset());
-		if (!VoiceSound)
-		{
-			continue;
-		}
-		// Attempt to auto-populate data from the asset's naming convention
-		if (AutoPopulateFromNaming(VoiceSound, false, false))
-		{
-			bOneSuccessAtLeast = true;
+			if (AutoPopulateFromNaming(VoiceSound, false, false))
+			{
+				Stats.AssetsModified++;
+			}
 		}
+		Stats.ApplySeconds = FPlatformTime::Seconds() - ApplyStart;
 	}
 
-	// Notify
-	if (bOneSuccessAtLeast)
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	if (OutStats)
 	{
-		FSSVoiceCultureUI::NotifySuccess(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateSuccess", "Auto-populate completed."));
+		*OutStats = Stats;
 	}
-	else
+
+	const bool bOneSuccessAtLeast = Stats.AssetsModified > 0;
+
+	// Notify
+	if (Options.bInteractive)
 	{
-		FSSVoiceCultureUI::NotifyFailure(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateNoMatch_Assets",
-		                                           "No asset contains at least one auto populate match."));
+		if (bOneSuccessAtLeast)
+		{
+			FSSVoiceCultureUI::NotifySuccess(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateSuccess", "Auto-populate completed."));
+		}
+		else
+		{
+			FSSVoiceCultureUI::NotifyFailure(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateNoMatch_Assets",
+			                                           "No asset contains at least one auto populate match."));
+		}
 	}
 	// Return whether at least one asset was successfully populated
 	return bOneSuccessAtLeast;
@@ -290,6 +397,8 @@ void FSSVoiceCultureUtils::GenerateCultureCoverageReport(FSSVoiceCultureReport&
 	Filter.bRecursiveClasses = true;
 	Filter.bRecursivePaths = true;
 	Filter.PackagePaths.Add(FName("/Game"));
+	// Runs as a background job phase: in-memory assets may only be queried from the game thread
+	Filter.bIncludeOnlyOnDiskAssets = !IsInGameThread();
 
 	TArray<FAssetData> FoundAssets;
 	AssetRegistryModule.Get().GetAssets(Filter, FoundAssets);
@@ -370,168 +479,103 @@ bool FSSVoiceCultureUtils::LoadSavedCultureReport(FSSVoiceCultureReport& OutRepo
 
 int32 FSSVoiceCultureUtils::AutoPopulateCulture(
 	const FString& TargetCulture,
-	bool bOverrideExisting)
+	bool bOverrideExisting,
+	const FSSVoiceCultureBatchOptions& Options,
+	FSSVoiceCultureOperationStats* OutStats)
 {
-	// Display a progress dialog
-	TSharedPtr<FScopedSlowTask> SlowTask = MakeShared<FScopedSlowTask>(
-		1.f,
-		FText::Format(
-			NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateCultureTitle", "Auto-populate voice culture '{0}'..."),
-			FText::FromString(TargetCulture.ToUpper()))
-	);
-	SlowTask->MakeDialog(true);
+	FSSVoiceCultureOperationStats Stats;
+	Stats.Operation = FString::Printf(TEXT("AutoPopulateCulture:%s"), *TargetCulture.ToLower());
+	const double StartTime = FPlatformTime::Seconds();
 
-	// Step 0: Preload all SoundBase assets once to avoid multiple scans
-	const TArray<FAssetData> AllSoundAssets = USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets();
-	
-	// Phase 1 - Asset scan and filtering using metadata only
-	const FString NormalizedCulture = TargetCulture.ToLower();
-	
-	// 1. Retrieve assets
-	TArray<FAssetData> AssetList = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	bool bNativeStrategy = false;
+	USSVoiceCultureStrategy* Strategy = GetPlanStrategy(bNativeStrategy);
 
-	// Filter down to only the assets that need AutoPopulate
-	TArray<FAssetData> AssetsToProcess;
-	for (const FAssetData& AssetData : AssetList)
+	if (!IsValid(Strategy))
 	{
-		bool bSkip = false;
-
-		if (!bOverrideExisting)
-		{
-			const FAssetTagValueRef Tag = AssetData.TagsAndValues.FindTag("VoiceCultures");
-
-			if (Tag.IsSet())
-			{
-				const FString TagValue = Tag.GetValue(); // e.g. "fr,en"
-				TArray<FString> TagCultures;
-				TagValue.ParseIntoArray(TagCultures, TEXT(","));
-
-				// Skip if culture already listed and we do not want to override
-				if (TagCultures.ContainsByPredicate(
-					[&](const FString& Val) { return Val.ToLower() == NormalizedCulture; }))
-				{
-					bSkip = true;
-				}
-			}
-		}
-
-		if (!bSkip)
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] AutoPopulateCulture: no active strategy."));
+		if (Options.bInteractive)
 		{
-			AssetsToProcess.Add(AssetData);
+			FSSVoiceCultureUI::NotifyFailure(
+				NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulate_NoProfile", "No active auto-populate strategy found."));
 		}
+		return 0;
 	}
 
-	// Phase 2 - load and modify eligible assets
-	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	// Filter by tag in the plan, only assets without the culture (or all when overriding) get loaded
+	const TArray<FAssetData> AssetList = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	Stats.AssetsScanned = AssetList.Num();
 
-	TSet<UPackage*> ModifiedPackages;
-	int32 ModifiedAssets = 0;
+	TArray<FString> Cultures;
+	Cultures.Add(TargetCulture.ToLower());
 
-	// Retrieve the active strategy from project settings
-	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
-	USSVoiceCultureStrategy* Strategy = VLEditorSubsystem->GetActiveStrategy();
+	// Blueprint strategies override the BlueprintNativeEvents only: per-asset fallback on the game thread
+	const int32 ModifiedAssets = bNativeStrategy
+		                             ? RunAutoPopulatePlan(*Strategy, AssetList, Cultures, bOverrideExisting, Options, Stats)
+		                             : RunStrategyAutoPopulate(*Strategy, AssetList, Cultures, bOverrideExisting, Options, Stats);
 
-	if (!Strategy)
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	if (OutStats)
 	{
-		FSSVoiceCultureUI::NotifyFailure(
-			NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulate_NoProfile", "No active auto-populate strategy found."));
-		return 0;
+		*OutStats = Stats;
 	}
 
-	// Iterate through each asset and apply AutoPopulate
-	for (const FAssetData& AssetData : AssetsToProcess)
+	// Notify result
+	if (Options.bInteractive)
 	{
-		USSVoiceCultureSound* Asset = Cast<USSVoiceCultureSound>(AssetData.GetAsset());
-		if (!IsValid(Asset))
-			continue;
-
-		// Check if culture is already set
-		const bool bAlreadyHasCulture = Asset->VoiceCultures.ContainsByPredicate(
-			[&](const FSSCultureAudioEntry& Entry)
-			{
-				return Entry.Culture.ToLower() == NormalizedCulture;
-			});
-
-		if (bAlreadyHasCulture && !bOverrideExisting)
-			continue;
-
-		// Execute AutoPopulate strategy
-		FSSCultureAudioEntry NewEntry;
-
-		// NOTE: Each call to FindMatchingSoundAsset performs a full asset search.
-		// Consider optimizing if matching for many cultures in sequence.
-		if (Strategy->ExecuteOptimizedOneCultureAutoPopulateInAsset(
-			Asset, NormalizedCulture, bOverrideExisting, NewEntry, AllSoundAssets))
+		if (ModifiedAssets > 0)
 		{
-			bool bCultureAlreadyExists = false;
+			FSSVoiceCultureUI::NotifySuccess(FText::Format(
+				NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateDone", "Auto-populate completed: {0} assets updated."),
+				FText::AsNumber(ModifiedAssets)));
+		}
+		else
+		{
+			FSSVoiceCultureUI::NotifyFailure(
+				NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateNoChange", "No assets required auto-populate."));
+		}
+	}
 
-			// Update existing entry if needed
-			for (FSSCultureAudioEntry& Entry : Asset->VoiceCultures)
-			{
-				if (Entry.Culture.ToLower() == NewEntry.Culture.ToLower())
-				{
-					bCultureAlreadyExists = true;
+	return ModifiedAssets;
+}
 
-					if (bOverrideExisting)
-					{
-						Entry.Sound = NewEntry.Sound;
-						ModifiedAssets++;
-						Asset->MarkPackageDirty();
-						if (EditorSettings->bAutoSaveAfterAutoPopulate)
-							ModifiedPackages.Add(
-								Asset->GetOutermost());
-					}
+int32 FSSVoiceCultureUtils::AutoPopulateAllCultures(bool bOverrideExisting, const FSSVoiceCultureBatchOptions& Options,
+                                                    FSSVoiceCultureOperationStats* OutStats)
+{
+	FSSVoiceCultureOperationStats Stats;
+	Stats.Operation = TEXT("AutoPopulateAllCultures");
+	const double StartTime = FPlatformTime::Seconds();
 
-					break;
-				}
-			}
+	bool bNativeStrategy = false;
+	USSVoiceCultureStrategy* Strategy = GetPlanStrategy(bNativeStrategy);
 
-			// Add new entry if it didn't exist
-			if (!bCultureAlreadyExists)
-			{
-				Asset->VoiceCultures.Add(NewEntry);
-				ModifiedAssets++;
-				Asset->MarkPackageDirty();
-				if (EditorSettings->bAutoSaveAfterAutoPopulate)
-					ModifiedPackages.Add(
-						Asset->GetOutermost());
-			}
-		}
-	}
-
-	// if should auto save
-	if (EditorSettings->bAutoSaveAfterAutoPopulate)
+	if (!IsValid(Strategy))
 	{
-		// Save modified packages
-		for (UPackage* Package : ModifiedPackages)
-		{
-			FString PackageFilename;
-			if (FPackageName::TryConvertLongPackageNameToFilename(
-				Package->GetName(), PackageFilename, FPackageName::GetAssetPackageExtension()))
-			{
-				SaveAsset(Package->GetOutermost(), PackageFilename);
-			}
-		}
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] AutoPopulateAllCultures: no active strategy."));
+		return 0;
 	}
 
-	// Finalize UI
-	if (SlowTask.IsValid())
+	const TArray<FAssetData> AssetList = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	Stats.AssetsScanned = AssetList.Num();
+
+	// One pass for every supported culture, so each voice asset is loaded and saved at most once
+	const TArray<FString> Cultures = USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures.Array();
+
+	const int32 ModifiedAssets = bNativeStrategy
+		                             ? RunAutoPopulatePlan(*Strategy, AssetList, Cultures, bOverrideExisting, Options, Stats)
+		                             : RunStrategyAutoPopulate(*Strategy, AssetList, Cultures, bOverrideExisting, Options, Stats);
+
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	if (OutStats)
 	{
-		SlowTask->EnterProgressFrame(1.f);
+		*OutStats = Stats;
 	}
 
-	// Notify result
-	if (ModifiedAssets > 0)
+	if (Options.bInteractive)
 	{
 		FSSVoiceCultureUI::NotifySuccess(FText::Format(
 			NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateDone", "Auto-populate completed: {0} assets updated."),
 			FText::AsNumber(ModifiedAssets)));
 	}
-	else
-	{
-		FSSVoiceCultureUI::NotifyFailure(
-			NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateNoChange", "No assets required auto-populate."));
-	}
 
 	return ModifiedAssets;
 }
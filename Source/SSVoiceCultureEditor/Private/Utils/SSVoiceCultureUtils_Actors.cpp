@@ -15,6 +15,12 @@
 #include "Settings/SSVoiceCultureStrategy.h"
 
 void FSSVoiceCultureUtils::GenerateActorListJson()
+{
+	TArray<FString> Actors;
+	GenerateActorListJson(Actors);
+}
+
+void FSSVoiceCultureUtils::GenerateActorListJson(TArray<FString>& OutActors)
 {
 	// Step 1: Use active strategy to extract actor names from the asset registry
 	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
@@ -24,22 +30,35 @@ void FSSVoiceCultureUtils::GenerateActorListJson()
 
 	Strategy->ExecuteExtractActorNameFromAssetRegistry(UniqueActors);
 
-	// Step 2: Convert the list of actor names to a JSON array
+	// Sorted so the file is stable between runs
+	OutActors = UniqueActors.Array();
+	OutActors.Sort();
+
+	// Step 2: Save as JSON
+	SaveActorListJson(OutActors);
+}
+
+bool FSSVoiceCultureUtils::SaveActorListJson(const TArray<FString>& Actors)
+{
+	// Convert the list of actor names to a JSON array
 	TArray<TSharedPtr<FJsonValue>> JsonArray;
-	for (const FString& Actor : UniqueActors)
+	for (const FString& Actor : Actors)
 	{
 		JsonArray.Add(MakeShared<FJsonValueString>(Actor));
 	}
 
-	TSharedRef<FJsonValueArray> RootValue = MakeShared<FJsonValueArray>(JsonArray);
-
 	FString OutputString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
 	FJsonSerializer::Serialize(JsonArray, Writer);
 
-	// Step 3: Save the JSON string to a file
+	// Save the JSON string to a file
 	const FString OutputPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture") / TEXT("VoiceActors.json");
-	FFileHelper::SaveStringToFile(OutputString, *OutputPath);
+	if (!FFileHelper::SaveStringToFile(OutputString, *OutputPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Failed to save voice actor list to %s"), *OutputPath);
+		return false;
+	}
 
 	UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Saved voice actor list to %s"), *OutputPath);
+	return true;
 }
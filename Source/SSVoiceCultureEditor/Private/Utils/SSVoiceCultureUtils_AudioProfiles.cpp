@@ -0,0 +1,358 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureTable.h"
+#include "AudioCompressionSettingsUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Sound/SoundWave.h"
+
+DECLARE_CYCLE_STAT(TEXT("Apply Culture Audio Profiles"), STAT_VoiceCulture_ApplyAudioProfiles, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** Culture sound waves by culture, each wave once (first culture found wins) */
+	struct FCultureWaves
+	{
+		TArray<FAssetData> Waves;
+		TArray<FString> Cultures;
+		TMap<FSoftObjectPath, int32> IndexByPath;
+
+		void Add(IAssetRegistry& AssetRegistry, const FString& Culture, const FSoftObjectPath& SoundPath,
+		         TArray<FString>& OutSharedSounds)
+		{
+			if (SoundPath.IsNull())
+				return;
+
+			if (const int32* Index = IndexByPath.Find(SoundPath))
+			{
+				if (!Cultures[*Index].Equals(Culture, ESearchCase::IgnoreCase))
+				{
+					OutSharedSounds.AddUnique(SoundPath.ToString());
+				}
+				return;
+			}
+
+			const FAssetData Wave = AssetRegistry.GetAssetByObjectPath(SoundPath);
+			if (!Wave.IsValid() || !Wave.IsInstanceOf(USoundWave::StaticClass()))
+				return;
+
+			IndexByPath.Add(SoundPath, Waves.Num());
+			Waves.Add(Wave);
+			Cultures.Add(Culture.ToLower());
+		}
+	};
+
+	ESoundwaveSampleRateSettings GetBucketSampleRate(const FSSVoiceCultureAudioProfile& Profile, float Duration,
+	                                                 ESoundwaveSampleRateSettings Current)
+	{
+		for (const FSSVoiceCultureSampleRateBucket& Bucket : Profile.SampleRateBuckets)
+		{
+			if (Duration <= Bucket.MaxDuration)
+				return Bucket.SampleRate;
+		}
+		return Current;
+	}
+
+	/** Sample rate the running platform cooks the wave at for a sample rate setting */
+	float GetCookSampleRate(const USoundWave& Wave, ESoundwaveSampleRateSettings SampleRate)
+	{
+		const float SourceRate = static_cast<float>(Wave.GetSampleRateForCurrentPlatform());
+		const FPlatformAudioCookOverrides* Overrides = FPlatformCompressionUtilities::GetCookOverrides();
+		if (!Overrides || !Overrides->bResampleForDevice)
+			return SourceRate;
+
+		const float* PlatformRate = Overrides->PlatformSampleRates.Find(SampleRate);
+		return PlatformRate && *PlatformRate > 0.f ? FMath::Min(*PlatformRate, static_cast<float>(Wave.SampleRate)) : SourceRate;
+	}
+
+	/**
+	 * Compressed size of the wave under the profile, scaled from its current size by the platform sample rates and
+	 * the compression quality. Rough (the bitrate is not linear in the quality), but nothing is recompressed.
+	 */
+	int64 EstimateProfileSize(const USoundWave& Wave, const FSSVoiceCultureAudioProfile& Profile, int64 CurrentBytes)
+	{
+		const ESoundwaveSampleRateSettings SampleRate = GetBucketSampleRate(Profile, Wave.Duration, Wave.SampleRateQuality);
+		const float CurrentRate = GetCookSampleRate(Wave, Wave.SampleRateQuality);
+		const float RateRatio = CurrentRate > 0.f ? GetCookSampleRate(Wave, SampleRate) / CurrentRate : 1.f;
+
+		const int32 Quality = Profile.bOverrideCompressionQuality ? Profile.CompressionQuality : Wave.CompressionQuality;
+		const float QualityRatio = Wave.CompressionQuality > 0 ? static_cast<float>(FMath::Max(1, Quality)) / Wave.CompressionQuality : 1.f;
+
+		return static_cast<int64>(CurrentBytes * RateRatio * QualityRatio);
+	}
+
+	/** Applies the profile to the wave, or only tells whether it would change when bApply is false */
+	bool ApplyProfile(USoundWave* Wave, const FSSVoiceCultureAudioProfile& Profile, bool bApply)
+	{
+		const int32 CompressionQuality = Profile.bOverrideCompressionQuality ? Profile.CompressionQuality : Wave->CompressionQuality;
+		const ESoundWaveLoadingBehavior LoadingBehavior = Profile.bOverrideLoadingBehavior ? Profile.LoadingBehavior : Wave->LoadingBehavior;
+		const ESoundwaveSampleRateSettings SampleRate = GetBucketSampleRate(Profile, Wave->Duration, Wave->SampleRateQuality);
+
+		if (CompressionQuality == Wave->CompressionQuality && LoadingBehavior == Wave->LoadingBehavior &&
+			SampleRate == Wave->SampleRateQuality)
+			return false;
+
+		if (bApply)
+		{
+			Wave->Modify();
+			Wave->CompressionQuality = CompressionQuality;
+			Wave->LoadingBehavior = LoadingBehavior;
+			Wave->SampleRateQuality = SampleRate;
+			Wave->InvalidateCompressedData(true);
+			Wave->PostEditChange();
+			Wave->MarkPackageDirty();
+		}
+		return true;
+	}
+}
+
+void FSSVoiceCultureUtils::ApplyCultureAudioProfiles(bool bApply, const FSSVoiceCultureBatchOptions& Options,
+                                                     FSSVoiceCultureAudioProfileReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_ApplyAudioProfiles, "VoiceCulture::ApplyCultureAudioProfiles");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("AudioProfiles");
+	OutReport.bApplied = bApply;
+
+	const USSVoiceCultureEditorSettings* Settings = USSVoiceCultureEditorSettings::GetSetting();
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	// 1. Culture of each sound wave, from the voice assets' "VoiceCultureSounds" tag then the voice table columns.
+	// Only voice assets saved before the tag existed are loaded
+	FCultureWaves CultureWaves;
+	TArray<FAssetData> VoiceAssets;
+	TMap<FString, FString> TaggedSounds;
+	for (const FAssetData& VoiceAsset : USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets())
+	{
+		if (!GetTaggedCultureSounds(VoiceAsset, TaggedSounds))
+		{
+			VoiceAssets.Add(VoiceAsset);
+			continue;
+		}
+
+		for (const TPair<FString, FString>& Sound : TaggedSounds)
+		{
+			CultureWaves.Add(AssetRegistry, Sound.Key, FSoftObjectPath(Sound.Value), OutReport.SharedSounds);
+		}
+	}
+
+	FARFilter TableFilter;
+	TableFilter.ClassPaths.Add(USSVoiceCultureTable::StaticClass()->GetClassPathName());
+	TableFilter.bRecursivePaths = true;
+	TableFilter.PackagePaths.Add(FName("/Game"));
+	TArray<FAssetData> Tables;
+	AssetRegistry.GetAssets(TableFilter, Tables);
+
+	FScopedSlowTask SlowTask(VoiceAssets.Num() + Tables.Num() * 2, NSLOCTEXT("SSVoiceCultureEditor", "ApplyingAudioProfiles",
+	                                                                     "Applying culture audio profiles..."), Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	// Cancelling skips the remaining work, the stats and summary are still filled in below
+	bool bCancelled = false;
+	for (int32 BatchStart = 0; BatchStart < VoiceAssets.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			bCancelled = true;
+			break;
+		}
+
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(VoiceAssets).Slice(
+			BatchStart, FMath::Min(BatchSize, VoiceAssets.Num() - BatchStart));
+		SlowTask.EnterProgressFrame(Batch.Num());
+		LoadAssetsParallel(Batch);
+
+		for (const FAssetData& VoiceAsset : Batch)
+		{
+			const USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false));
+			if (!VoiceSound)
+				continue;
+
+			for (const FSSCultureAudioEntry& Entry : VoiceSound->VoiceCultures)
+			{
+				CultureWaves.Add(AssetRegistry, Entry.Culture, Entry.Sound.ToSoftObjectPath(), OutReport.SharedSounds);
+			}
+		}
+
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	if (bCancelled)
+	{
+		Tables.Reset();
+	}
+
+	SlowTask.EnterProgressFrame(Tables.Num());
+	for (const FAssetData& TableAsset : Tables)
+	{
+		const USSVoiceCultureTable* Table = Cast<USSVoiceCultureTable>(TableAsset.GetAsset());
+		if (!Table)
+			continue;
+
+		for (const FSSVoiceCultureTableCulture& TableCulture : Table->Cultures)
+		{
+			const USSVoiceCultureTableColumn* Column = TableCulture.Column.LoadSynchronous();
+			if (!Column)
+				continue;
+
+			const FString Culture = TableCulture.Culture.ToString();
+			for (const TSoftObjectPtr<USoundBase>& Sound : Column->Sounds)
+			{
+				CultureWaves.Add(AssetRegistry, Culture, Sound.ToSoftObjectPath(), OutReport.SharedSounds);
+			}
+		}
+	}
+
+	Stats.AssetsScanned = CultureWaves.Waves.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// 2. Only the waves of a culture with a profile are loaded
+	TArray<FAssetData> Waves;
+	TArray<const FSSVoiceCultureAudioProfile*> Profiles;
+	TArray<int32> ReportIndices;
+	TMap<FString, int32> ReportIndexByCulture;
+
+	for (int32 i = 0; i < CultureWaves.Waves.Num(); ++i)
+	{
+		const FString& Culture = CultureWaves.Cultures[i];
+		const FSSVoiceCultureAudioProfile* Profile = Settings->FindCultureAudioProfile(Culture);
+		if (!Profile)
+			continue;
+
+		int32* ReportIndex = ReportIndexByCulture.Find(Culture);
+		if (!ReportIndex)
+		{
+			ReportIndex = &ReportIndexByCulture.Add(Culture, OutReport.Cultures.Num());
+			OutReport.Cultures.AddDefaulted_GetRef().Culture = Culture;
+		}
+
+		Waves.Add(CultureWaves.Waves[i]);
+		Profiles.Add(Profile);
+		ReportIndices.Add(*ReportIndex);
+	}
+
+	// 3. Waves in batches: sizes before, profile and estimated sizes after
+	const double ApplyStart = FPlatformTime::Seconds();
+	double SaveSeconds = 0.0;
+
+	SlowTask.TotalAmountOfWork += Waves.Num();
+	for (int32 BatchStart = 0; BatchStart < Waves.Num(); BatchStart += BatchSize)
+	{
+		if (bCancelled || SlowTask.ShouldCancel())
+			break;
+
+		const int32 BatchNum = FMath::Min(BatchSize, Waves.Num() - BatchStart);
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(Waves).Slice(BatchStart, BatchNum);
+		SlowTask.EnterProgressFrame(BatchNum);
+		LoadAssetsParallel(Batch);
+
+		TSet<UPackage*> ModifiedPackages;
+		for (int32 i = 0; i < BatchNum; ++i)
+		{
+			USoundWave* Wave = Cast<USoundWave>(Batch[i].FastGetAsset(false));
+			if (!Wave)
+				continue;
+
+			FSSVoiceCultureAudioProfileCulture& CultureReport = OutReport.Cultures[ReportIndices[BatchStart + i]];
+			CultureReport.Sounds++;
+
+			// Only compressed data already built, asking for the size of a wave without would compress it
+			const FName Format = Wave->GetRuntimeFormat();
+			const bool bSizeKnown = Wave->HasCompressedData(Format);
+			const int64 BytesBefore = bSizeKnown ? Wave->GetCompressedDataSize(Format) : 0;
+			const int64 BytesAfter = bSizeKnown ? EstimateProfileSize(*Wave, *Profiles[BatchStart + i], BytesBefore) : 0;
+			if (bSizeKnown)
+			{
+				CultureReport.BytesBefore += BytesBefore;
+			}
+			else
+			{
+				CultureReport.UnknownSizes++;
+			}
+
+			if (!ApplyProfile(Wave, *Profiles[BatchStart + i], bApply))
+			{
+				CultureReport.BytesAfter += BytesBefore;
+				continue;
+			}
+
+			CultureReport.Modified++;
+			CultureReport.BytesAfter += BytesAfter;
+			Stats.AssetsMatched++;
+
+			if (bApply)
+			{
+				ModifiedPackages.Add(Wave->GetOutermost());
+			}
+		}
+		Stats.AssetsModified += ModifiedPackages.Num();
+
+		if (Options.bForceSave)
+		{
+			const double SaveStart = FPlatformTime::Seconds();
+			Stats.PackagesSaved += SavePackages(ModifiedPackages);
+			SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	Stats.SaveSeconds = SaveSeconds;
+	Stats.ApplySeconds = FPlatformTime::Seconds() - ApplyStart - SaveSeconds;
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	for (const FSSVoiceCultureAudioProfileCulture& CultureReport : OutReport.Cultures)
+	{
+		UE_LOG(LogVoiceCultureEditor, Display,
+		       TEXT("[SSVoiceCulture] %s: %d/%d sound(s) %s, %.1f MB -> ~%.1f MB (estimated, %d sound(s) not compressed yet left out)"),
+		       *CultureReport.Culture, CultureReport.Modified, CultureReport.Sounds, bApply ? TEXT("updated") : TEXT("to update"),
+		       CultureReport.BytesBefore / (1024.0 * 1024.0), CultureReport.BytesAfter / (1024.0 * 1024.0),
+		       CultureReport.UnknownSizes);
+	}
+	if (OutReport.SharedSounds.Num() > 0)
+	{
+		UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] %d sound(s) are used by several cultures, the first culture's profile applies"),
+		       OutReport.SharedSounds.Num());
+	}
+}
+
+bool FSSVoiceCultureUtils::SaveAudioProfileReport(const FSSVoiceCultureAudioProfileReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/AudioProfileReport.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Audio profile report written to %s"), *ReportPath);
+	return true;
+}
@@ -0,0 +1,398 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+#include "Utils/SSVoiceCultureSoundIndex.h"
+
+#define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
+
+DECLARE_CYCLE_STAT(TEXT("Build AutoPopulate Plan"), STAT_VoiceCulture_BuildAutoPopulatePlan, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Apply AutoPopulate Plan"), STAT_VoiceCulture_ApplyAutoPopulatePlan, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Run Strategy AutoPopulate"), STAT_VoiceCulture_RunStrategyAutoPopulate, STATGROUP_VoiceCulture);
+
+TSet<FString> FSSVoiceCultureUtils::GetTaggedCultures(const FAssetData& VoiceAsset)
+{
+	TSet<FString> Cultures;
+
+	// "VoiceCultures" tag is a comma-separated string like "en,fr,jp"
+	const FAssetTagValueRef Tag = VoiceAsset.TagsAndValues.FindTag("VoiceCultures");
+	if (Tag.IsSet())
+	{
+		TArray<FString> TagCultures;
+		Tag.GetValue().ParseIntoArray(TagCultures, TEXT(","));
+
+		for (FString& Culture : TagCultures)
+		{
+			Cultures.Add(Culture.ToLower());
+		}
+	}
+	return Cultures;
+}
+
+bool FSSVoiceCultureUtils::GetTaggedCultureSounds(const FAssetData& VoiceAsset, TMap<FString, FString>& OutSounds)
+{
+	OutSounds.Reset();
+
+	// "VoiceCultureSounds" tag is a comma-separated string like "en=/Game/VO/A_EN_Hello.A_EN_Hello,fr=..."
+	const FAssetTagValueRef Tag = VoiceAsset.TagsAndValues.FindTag("VoiceCultureSounds");
+	if (!Tag.IsSet())
+		return false;
+
+	TArray<FString> Entries;
+	Tag.GetValue().ParseIntoArray(Entries, TEXT(","));
+
+	FString Culture;
+	FString Sound;
+	for (const FString& Entry : Entries)
+	{
+		if (Entry.Split(TEXT("="), &Culture, &Sound))
+		{
+			OutSounds.Add(Culture.ToLower(), Sound);
+		}
+	}
+	return true;
+}
+
+void FSSVoiceCultureUtils::BuildAutoPopulatePlan(const USSVoiceCultureStrategy& Strategy,
+                                                 const TArray<FAssetData>& VoiceAssets,
+                                                 const TArray<FAssetData>& SoundAssets, const TArray<FString>& Cultures,
+                                                 bool bOverrideExisting, const FSSVoiceCultureBatchOptions& Options,
+                                                 TArray<FSSVoiceCultureAutoPopulateItem>& OutPlan)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_BuildAutoPopulatePlan, "VoiceCulture::BuildAutoPopulatePlan");
+
+	OutPlan.Reset();
+
+	// 1. Index every culture sound once by (suffix, culture)
+	FSSVoiceCultureSoundIndex Index;
+	Index.Build(Strategy, SoundAssets, Options.GetNumChunks(SoundAssets.Num()));
+
+	TArray<FString> WantedCultures;
+	for (const FString& Culture : Cultures)
+	{
+		WantedCultures.Add(Culture.ToLower());
+	}
+
+	// 2. Match voice assets in parallel, each chunk writes to its own slots to keep registry order
+	TArray<FSSVoiceCultureAutoPopulateItem> Items;
+	Items.SetNum(VoiceAssets.Num());
+
+	const int32 NumChunks = Options.GetNumChunks(VoiceAssets.Num());
+	const int32 ChunkSize = FMath::DivideAndRoundUp(VoiceAssets.Num(), NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, VoiceAssets.Num());
+		for (int32 i = Start; i < End; ++i)
+		{
+			const FAssetData& VoiceAsset = VoiceAssets[i];
+
+			// e.g. "LVA_NPC01_Hello" -> "NPC01_Hello"
+			const FString Suffix = Strategy.ExtractSuffixFromBaseName(VoiceAsset.AssetName.ToString());
+			if (Suffix.IsEmpty())
+				continue;
+
+			const TArray<FSSVoiceCultureSoundIndex::FEntry>* Line = Index.FindLine(Suffix);
+			if (!Line)
+				continue;
+
+			const TSet<FString> PresentCultures = bOverrideExisting ? TSet<FString>() : GetTaggedCultures(VoiceAsset);
+
+			FSSVoiceCultureAutoPopulateItem& Item = Items[i];
+			for (const FSSVoiceCultureSoundIndex::FEntry& Entry : *Line)
+			{
+				if (WantedCultures.Num() > 0 && !WantedCultures.Contains(Entry.Culture))
+					continue;
+
+				if (PresentCultures.Contains(Entry.Culture))
+					continue;
+
+				Item.CultureSounds.Add(Entry.Culture, Entry.Asset.GetSoftObjectPath());
+			}
+
+			if (Item.CultureSounds.Num() > 0)
+			{
+				Item.VoiceAsset = VoiceAsset;
+			}
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// 3. Keep only matched assets
+	for (FSSVoiceCultureAutoPopulateItem& Item : Items)
+	{
+		if (Item.CultureSounds.Num() > 0)
+		{
+			OutPlan.Add(MoveTemp(Item));
+		}
+	}
+}
+
+bool FSSVoiceCultureUtils::ApplyAutoPopulateItem(const FSSVoiceCultureAutoPopulateItem& Item, bool bOverrideExisting,
+                                                 TSet<UPackage*>& OutModifiedPackages)
+{
+	check(IsInGameThread());
+
+	USSVoiceCultureSound* Asset = Cast<USSVoiceCultureSound>(Item.VoiceAsset.GetAsset());
+	if (!IsValid(Asset))
+		return false;
+
+	bool bModified = false;
+
+	for (const TPair<FString, FSoftObjectPath>& Pair : Item.CultureSounds)
+	{
+		FSSCultureAudioEntry* Existing = Asset->VoiceCultures.FindByPredicate([&](const FSSCultureAudioEntry& Entry)
+		{
+			return Entry.Culture.Equals(Pair.Key, ESearchCase::IgnoreCase);
+		});
+
+		if (Existing)
+		{
+			// An entry without sound is treated as missing, same as the "VoiceCultures" tag
+			if (!Existing->Sound.IsNull() && !bOverrideExisting)
+				continue;
+
+			if (Existing->Sound.ToSoftObjectPath() == Pair.Value)
+				continue;
+
+			Existing->Sound = TSoftObjectPtr<USoundBase>(Pair.Value);
+		}
+		else
+		{
+			FSSCultureAudioEntry NewEntry;
+			NewEntry.Culture = Pair.Key;
+			NewEntry.Sound = TSoftObjectPtr<USoundBase>(Pair.Value);
+			Asset->VoiceCultures.Add(NewEntry);
+		}
+
+		bModified = true;
+	}
+
+	if (bModified)
+	{
+		Asset->MarkPackageDirty();
+		OutModifiedPackages.Add(Asset->GetOutermost());
+	}
+
+	return bModified;
+}
+
+int32 FSSVoiceCultureUtils::ApplyAutoPopulatePlan(const TArray<FSSVoiceCultureAutoPopulateItem>& Plan,
+                                                  bool bOverrideExisting, const FSSVoiceCultureBatchOptions& Options,
+                                                  FSSVoiceCultureOperationStats& Stats)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_ApplyAutoPopulatePlan, "VoiceCulture::ApplyAutoPopulatePlan");
+
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	const bool bSave = !Options.bNoSave && (Options.bForceSave || EditorSettings->bAutoSaveAfterAutoPopulate);
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	FScopedSlowTask SlowTask(Plan.Num(), NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateApplying", "Updating entries..."),
+	                         Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	int32 ModifiedAssets = 0;
+
+	for (int32 BatchStart = 0; BatchStart < Plan.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Plan.Num());
+		SlowTask.EnterProgressFrame(BatchEnd - BatchStart);
+
+		// Load and modify the batch
+		const double ApplyStart = FPlatformTime::Seconds();
+		TSet<UPackage*> ModifiedPackages;
+		for (int32 i = BatchStart; i < BatchEnd; ++i)
+		{
+			if (ApplyAutoPopulateItem(Plan[i], bOverrideExisting, ModifiedPackages))
+			{
+				ModifiedAssets++;
+			}
+		}
+		Stats.ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+		if (!bSave)
+			continue;
+
+		// Save the batch, then release it so memory stays bounded by BatchSize
+		const double SaveStart = FPlatformTime::Seconds();
+		Stats.PackagesSaved += SavePackages(ModifiedPackages);
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+		Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+	}
+
+	Stats.AssetsModified += ModifiedAssets;
+
+	UE_LOG(LogVoiceCultureEditor, Log, TEXT("[SSVoiceCulture] Auto-populate plan applied: %d/%d assets modified, %d packages saved."),
+	       ModifiedAssets, Plan.Num(), Stats.PackagesSaved);
+
+	return ModifiedAssets;
+}
+
+
+bool FSSVoiceCultureUtils::ApplyStrategyAutoPopulate(const USSVoiceCultureStrategy& Strategy, USSVoiceCultureSound* Asset,
+                                                     const TArray<FString>& Cultures, bool bOverrideExisting,
+                                                     const TArray<FAssetData>& SoundAssets,
+                                                     TSet<UPackage*>& OutModifiedPackages)
+{
+	check(IsInGameThread());
+
+	if (!IsValid(Asset))
+		return false;
+
+	bool bModified = false;
+
+	for (const FString& Culture : Cultures)
+	{
+		const FSSCultureAudioEntry* Existing = Asset->VoiceCultures.FindByPredicate([&](const FSSCultureAudioEntry& Entry)
+		{
+			return Entry.Culture.Equals(Culture, ESearchCase::IgnoreCase);
+		});
+
+		// An entry without sound is treated as missing, same as the plan path
+		if (Existing && !Existing->Sound.IsNull() && !bOverrideExisting)
+			continue;
+
+		FSSCultureAudioEntry NewEntry;
+		if (!Strategy.ExecuteOptimizedOneCultureAutoPopulateInAsset(Asset, Culture, bOverrideExisting, NewEntry,
+		                                                            SoundAssets))
+			continue;
+
+		FSSCultureAudioEntry* Entry = Asset->VoiceCultures.FindByPredicate([&](const FSSCultureAudioEntry& Other)
+		{
+			return Other.Culture.Equals(NewEntry.Culture, ESearchCase::IgnoreCase);
+		});
+
+		if (Entry)
+		{
+			if (Entry->Sound == NewEntry.Sound)
+				continue;
+
+			Entry->Sound = NewEntry.Sound;
+		}
+		else
+		{
+			Asset->VoiceCultures.Add(NewEntry);
+		}
+
+		bModified = true;
+	}
+
+	if (bModified)
+	{
+		Asset->MarkPackageDirty();
+		OutModifiedPackages.Add(Asset->GetOutermost());
+	}
+
+	return bModified;
+}
+
+int32 FSSVoiceCultureUtils::RunStrategyAutoPopulate(const USSVoiceCultureStrategy& Strategy,
+                                                   const TArray<FAssetData>& VoiceAssets,
+                                                   const TArray<FString>& Cultures, bool bOverrideExisting,
+                                                   const FSSVoiceCultureBatchOptions& Options,
+                                                   FSSVoiceCultureOperationStats& Stats)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_RunStrategyAutoPopulate, "VoiceCulture::RunStrategyAutoPopulate");
+
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	const bool bSave = !Options.bNoSave && (Options.bForceSave || EditorSettings->bAutoSaveAfterAutoPopulate);
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	// Phase 1 - registry scan, every SoundBase once, shared by every ExecuteOptimized call
+	double PhaseStart = FPlatformTime::Seconds();
+	const TArray<FAssetData> AllSoundAssets = USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets();
+	Stats.ScanSeconds += FPlatformTime::Seconds() - PhaseStart;
+
+	// Phase 2 - skip from the "VoiceCultures" tag the assets that have every culture already
+	PhaseStart = FPlatformTime::Seconds();
+	TArray<FAssetData> AssetsToProcess;
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		if (!bOverrideExisting)
+		{
+			const TSet<FString> PresentCultures = GetTaggedCultures(VoiceAsset);
+			if (!Cultures.ContainsByPredicate([&](const FString& Culture) { return !PresentCultures.Contains(Culture.ToLower()); }))
+				continue;
+		}
+		AssetsToProcess.Add(VoiceAsset);
+	}
+	Stats.MatchSeconds += FPlatformTime::Seconds() - PhaseStart;
+	Stats.AssetsMatched += AssetsToProcess.Num();
+
+	// Phase 3 - the strategy rules need the loaded voice asset, run them on the game thread in batches
+	FScopedSlowTask SlowTask(AssetsToProcess.Num(),
+	                         NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateApplying", "Updating entries..."),
+	                         Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	int32 ModifiedAssets = 0;
+
+	for (int32 BatchStart = 0; BatchStart < AssetsToProcess.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, AssetsToProcess.Num());
+		SlowTask.EnterProgressFrame(BatchEnd - BatchStart);
+
+		const double ApplyStart = FPlatformTime::Seconds();
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(AssetsToProcess).Slice(BatchStart, BatchEnd - BatchStart);
+		LoadAssetsParallel(Batch);
+
+		TSet<UPackage*> ModifiedPackages;
+		for (const FAssetData& VoiceAsset : Batch)
+		{
+			USSVoiceCultureSound* Asset = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false));
+			if (ApplyStrategyAutoPopulate(Strategy, Asset, Cultures, bOverrideExisting, AllSoundAssets, ModifiedPackages))
+			{
+				ModifiedAssets++;
+			}
+		}
+		Stats.ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+		if (!bSave)
+			continue;
+
+		const double SaveStart = FPlatformTime::Seconds();
+		Stats.PackagesSaved += SavePackages(ModifiedPackages);
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+		Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+	}
+
+	Stats.AssetsModified += ModifiedAssets;
+
+	UE_LOG(LogVoiceCultureEditor, Log,
+	       TEXT("[SSVoiceCulture] Strategy auto-populate ('%s'): %d/%d assets modified, %d packages saved."),
+	       *Strategy.GetClass()->GetName(), ModifiedAssets, AssetsToProcess.Num(), Stats.PackagesSaved);
+
+	return ModifiedAssets;
+}
+
+#undef LOCTEXT_NAMESPACE
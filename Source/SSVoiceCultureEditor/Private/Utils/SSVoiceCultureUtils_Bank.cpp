@@ -0,0 +1,242 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "ObjectTools.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	/** Bank line id of a voice asset: its package path with '/' as '_', unique even when short names collide across folders */
+	FName MakeBankLineId(const USSVoiceCultureSound& Line)
+	{
+		FString LineId = Line.GetOutermost()->GetName();
+		LineId.RemoveFromStart(TEXT("/"));
+		LineId.ReplaceCharInline(TEXT('/'), TEXT('_'));
+		return FName(*LineId);
+	}
+}
+
+USSVoiceCultureBank* FSSVoiceCultureUtils::BuildVoiceBank(const FString& BankObjectPath, const TArray<FAssetData>& VoiceAssets,
+                                                         bool bSave, FSSVoiceCultureOperationStats& OutStats)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats.Operation = TEXT("BuildBank");
+
+	const FSoftObjectPath BankPath(BankObjectPath);
+	const FString BankPackageName = BankPath.GetLongPackageName();
+	if (BankPath.IsNull() || !FPackageName::IsValidLongPackageName(BankPackageName))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Invalid bank path '%s'"), *BankObjectPath);
+		return nullptr;
+	}
+
+	const FString BankName = BankPath.GetAssetName();
+	USSVoiceCultureBank* Bank = LoadOrCreateAsset<USSVoiceCultureBank>(BankPackageName, BankName);
+	if (!Bank)
+		return nullptr;
+
+	// 1. Lines, sorted by line id so chunks are stable between builds
+	TArray<USSVoiceCultureSound*> Lines;
+	if (VoiceAssets.Num() > 0)
+	{
+		for (const FAssetData& VoiceAsset : VoiceAssets)
+		{
+			if (USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.GetAsset()))
+			{
+				Lines.AddUnique(VoiceSound);
+			}
+		}
+	}
+	else
+	{
+		for (const TSoftObjectPtr<USSVoiceCultureSound>& SourceLine : Bank->SourceLines)
+		{
+			if (USSVoiceCultureSound* VoiceSound = SourceLine.LoadSynchronous())
+			{
+				Lines.AddUnique(VoiceSound);
+			}
+		}
+	}
+	TMap<const USSVoiceCultureSound*, FName> LineIds;
+	for (const USSVoiceCultureSound* Line : Lines)
+	{
+		LineIds.Add(Line, MakeBankLineId(*Line));
+	}
+	Lines.Sort([&LineIds](const USSVoiceCultureSound& A, const USSVoiceCultureSound& B)
+	{
+		return LineIds[&A].LexicalLess(LineIds[&B]);
+	});
+
+	OutStats.AssetsScanned = Lines.Num();
+	if (Lines.Num() == 0)
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] No voice asset to pack into %s"), *BankObjectPath);
+		return nullptr;
+	}
+
+	TSet<FString> Cultures;
+	for (const USSVoiceCultureSound* Line : Lines)
+	{
+		for (const FSSCultureAudioEntry& Entry : Line->VoiceCultures)
+		{
+			if (!Entry.Sound.IsNull())
+			{
+				Cultures.Add(Entry.Culture.ToLower());
+			}
+		}
+	}
+
+	TSet<UPackage*> PackagesToSave;
+	PackagesToSave.Add(Bank->GetOutermost());
+
+	// Lines and chunks of the previous build, released below if this build no longer has them
+	const TArray<TSoftObjectPtr<USSVoiceCultureSound>> PreviousLines = Bank->SourceLines;
+	const TArray<FSSVoiceCultureBankCulture> PreviousCultures = Bank->Cultures;
+
+	Bank->LineIds.Reset(Lines.Num());
+	Bank->SourceLines.Reset(Lines.Num());
+	for (USSVoiceCultureSound* Line : Lines)
+	{
+		Bank->LineIds.Add(LineIds[Line]);
+		Bank->SourceLines.Add(Line);
+	}
+
+	// 2. One chunk per culture, the line sounds are copied into the chunk's package
+	TMap<const USSVoiceCultureSound*, TArray<FName>> PackedCultures;
+	Bank->Cultures.Reset();
+	for (const FString& Culture : Cultures)
+	{
+		// Same path the voice assets derive at cook time
+		const FSoftObjectPath ChunkPath = USSVoiceCultureBank::GetChunkPath(BankPath, Culture);
+		USSVoiceCultureBankChunk* Chunk = LoadOrCreateAsset<USSVoiceCultureBankChunk>(
+			ChunkPath.GetLongPackageName(), ChunkPath.GetAssetName());
+		if (!Chunk)
+			continue;
+
+		// Previous build: move the old copies out of the package
+		for (USoundBase* OldSound : Chunk->Sounds)
+		{
+			if (OldSound)
+			{
+				OldSound->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional);
+			}
+		}
+		Chunk->Sounds.Reset(Lines.Num());
+
+		for (const USSVoiceCultureSound* Line : Lines)
+		{
+			USoundBase* SourceSound = nullptr;
+			for (const FSSCultureAudioEntry& Entry : Line->VoiceCultures)
+			{
+				if (Entry.Culture.Equals(Culture, ESearchCase::IgnoreCase))
+				{
+					SourceSound = Entry.Sound.LoadSynchronous();
+					break;
+				}
+			}
+
+			// Named after the line id: the voice asset points at its copy by name when cooked
+			USoundBase* BankSound = SourceSound ? DuplicateObject<USoundBase>(SourceSound, Chunk, LineIds[Line]) : nullptr;
+			if (BankSound)
+			{
+				// Referenced from other packages, but not an asset of its own
+				BankSound->SetFlags(RF_Public);
+				BankSound->ClearFlags(RF_Standalone);
+				PackedCultures.FindOrAdd(Line).Add(FName(*Culture));
+				OutStats.AssetsMatched++;
+			}
+			Chunk->Sounds.Add(BankSound);
+		}
+
+		Chunk->MarkPackageDirty();
+		PackagesToSave.Add(Chunk->GetOutermost());
+
+		FSSVoiceCultureBankCulture& BankCulture = Bank->Cultures.AddDefaulted_GetRef();
+		BankCulture.Culture = FName(*Culture);
+		BankCulture.Chunk = Chunk;
+	}
+
+	Bank->Cultures.Sort([](const FSSVoiceCultureBankCulture& A, const FSSVoiceCultureBankCulture& B)
+	{
+		return A.Culture.LexicalLess(B.Culture);
+	});
+	Bank->MarkPackageDirty();
+
+	// 3. Redirect the lines to the bank, with the cultures packed for each so the cook resolves them without loading it
+	for (USSVoiceCultureSound* Line : Lines)
+	{
+		TArray<FName> LineCultures = PackedCultures.FindRef(Line);
+		LineCultures.Sort(FNameLexicalLess());
+
+		if (Line->Bank.Get() == Bank && Line->BankLineId == LineIds[Line] && Line->BankCultures == LineCultures)
+			continue;
+
+		Line->Modify();
+		Line->Bank = Bank;
+		Line->BankLineId = LineIds[Line];
+		Line->BankCultures = MoveTemp(LineCultures);
+		Line->MarkPackageDirty();
+		PackagesToSave.Add(Line->GetOutermost());
+		OutStats.AssetsModified++;
+	}
+
+	// 4. Lines dropped from the bank resolve from their own culture sounds again
+	for (const TSoftObjectPtr<USSVoiceCultureSound>& PreviousLine : PreviousLines)
+	{
+		USSVoiceCultureSound* Line = PreviousLine.LoadSynchronous();
+		if (!Line || Lines.Contains(Line) || Line->Bank.Get() != Bank)
+			continue;
+
+		Line->Modify();
+		Line->Bank.Reset();
+		Line->BankLineId = NAME_None;
+		Line->BankCultures.Reset();
+		Line->MarkPackageDirty();
+		PackagesToSave.Add(Line->GetOutermost());
+		OutStats.AssetsModified++;
+	}
+
+	// 5. Chunks of cultures no longer in the bank
+	TArray<UObject*> StaleChunks;
+	for (const FSSVoiceCultureBankCulture& PreviousCulture : PreviousCultures)
+	{
+		if (Cultures.Contains(PreviousCulture.Culture.ToString()))
+			continue;
+
+		if (USSVoiceCultureBankChunk* Chunk = PreviousCulture.Chunk.LoadSynchronous())
+		{
+			PackagesToSave.Remove(Chunk->GetOutermost());
+			StaleChunks.Add(Chunk);
+		}
+	}
+	if (StaleChunks.Num() > 0)
+	{
+		const int32 NumDeleted = ObjectTools::DeleteObjects(StaleChunks, /*bShowConfirmation*/ false);
+		UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Bank %s: %d stale culture chunk(s) deleted"),
+		       *BankName, NumDeleted);
+	}
+
+	OutStats.ApplySeconds = FPlatformTime::Seconds() - StartTime;
+
+	if (bSave)
+	{
+		const double SaveStart = FPlatformTime::Seconds();
+		OutStats.PackagesSaved = SavePackages(PackagesToSave);
+		OutStats.SaveSeconds = FPlatformTime::Seconds() - SaveStart;
+	}
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display,
+	       TEXT("[SSVoiceCulture] Bank %s: %d line(s), %d culture(s), %d sound(s) packed, %d voice asset(s) redirected"),
+	       *BankName, Lines.Num(), Cultures.Num(), OutStats.AssetsMatched, OutStats.AssetsModified);
+
+	return Bank;
+}
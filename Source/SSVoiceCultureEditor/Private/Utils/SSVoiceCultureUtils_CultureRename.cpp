@@ -0,0 +1,319 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+
+DECLARE_CYCLE_STAT(TEXT("Rename Culture Codes"), STAT_VoiceCulture_RenameCultures, STATGROUP_VoiceCulture);
+
+namespace
+{
+	FString CultureToString(const FString& Culture) { return Culture; }
+	FString CultureToString(FName Culture) { return Culture.ToString(); }
+
+	/**
+	 * Renames the cultures of one array of an asset (NewByOld is keyed by lowercase old code).
+	 * An item is left as is when its new code is already used by another item. Returns true if Owner was modified.
+	 */
+	template <typename ItemType, typename CultureType>
+	bool RenameCultures(TArray<ItemType>& Items, CultureType ItemType::* CultureMember, const TMap<FString, FString>& NewByOld,
+	                    UObject* Owner, const TCHAR* Field, FSSVoiceCultureRenameReport& Report)
+	{
+		// Codes the asset keeps, a renamed item must not collide with them
+		TSet<FString> Taken;
+		for (const ItemType& Item : Items)
+		{
+			const FString Culture = CultureToString(Item.*CultureMember).ToLower();
+			if (!NewByOld.Contains(Culture))
+			{
+				Taken.Add(Culture);
+			}
+		}
+
+		bool bModified = false;
+		for (ItemType& Item : Items)
+		{
+			const FString OldCulture = CultureToString(Item.*CultureMember);
+			const FString* NewCulture = NewByOld.Find(OldCulture.ToLower());
+			if (!NewCulture)
+				continue;
+
+			FSSVoiceCultureRenameAudit& Audit = Report.Changes.AddDefaulted_GetRef();
+			Audit.Asset = Owner->GetPathName();
+			Audit.Field = Field;
+			Audit.OldCulture = OldCulture;
+			Audit.NewCulture = *NewCulture;
+
+			if (Taken.Contains(NewCulture->ToLower()))
+			{
+				Audit.bApplied = false;
+				Report.Conflicts++;
+				Taken.Add(OldCulture.ToLower());
+				continue;
+			}
+
+			if (!bModified)
+			{
+				Owner->Modify();
+				bModified = true;
+			}
+			Item.*CultureMember = CultureType(**NewCulture);
+			Taken.Add(NewCulture->ToLower());
+		}
+		return bModified;
+	}
+
+	/** Renames one settings value, returns true if it changed */
+	bool RenameSetting(FString& Value, const TMap<FString, FString>& NewByOld, const UObject* Settings, const TCHAR* Field,
+	                   FSSVoiceCultureRenameReport& Report)
+	{
+		const FString* NewCulture = NewByOld.Find(Value.ToLower());
+		if (!NewCulture)
+			return false;
+
+		FSSVoiceCultureRenameAudit& Audit = Report.Changes.AddDefaulted_GetRef();
+		Audit.Asset = Settings->GetClass()->GetPathName();
+		Audit.Field = Field;
+		Audit.OldCulture = Value;
+		Audit.NewCulture = *NewCulture;
+
+		Value = *NewCulture;
+		return true;
+	}
+
+	TArray<FAssetData> GetAssetsOfClass(IAssetRegistry& AssetRegistry, const UClass* Class)
+	{
+		FARFilter Filter;
+		Filter.ClassPaths.Add(Class->GetClassPathName());
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Add(FName("/Game"));
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssets(Filter, Assets);
+		return Assets;
+	}
+}
+
+bool FSSVoiceCultureUtils::RenameCultureCodes(const TMap<FString, FString>& Renames, const FSSVoiceCultureBatchOptions& Options,
+                                              FSSVoiceCultureRenameReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_RenameCultures, "VoiceCulture::RenameCultureCodes");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("CultureRename");
+	OutReport.Renames = Renames;
+
+	TMap<FString, FString> NewByOld;
+	for (const TPair<FString, FString>& Rename : Renames)
+	{
+		const FString OldCulture = Rename.Key.TrimStartAndEnd();
+		const FString NewCulture = Rename.Value.TrimStartAndEnd();
+		if (OldCulture.IsEmpty() || NewCulture.IsEmpty() || OldCulture.Equals(NewCulture, ESearchCase::CaseSensitive) ||
+			NewByOld.Contains(OldCulture.ToLower()))
+		{
+			UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Invalid culture rename '%s' -> '%s'"), *Rename.Key, *Rename.Value);
+			return false;
+		}
+		NewByOld.Add(OldCulture.ToLower(), NewCulture);
+	}
+	if (NewByOld.Num() == 0)
+		return false;
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	// 1. Affected voice assets from the "VoiceCultures" tag, nothing is loaded
+	const TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	TArray<FAssetData> AffectedAssets;
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		for (const FString& Culture : GetTaggedCultures(VoiceAsset))
+		{
+			if (NewByOld.Contains(Culture))
+			{
+				AffectedAssets.Add(VoiceAsset);
+				break;
+			}
+		}
+	}
+
+	const TArray<FAssetData> Tables = GetAssetsOfClass(AssetRegistry, USSVoiceCultureTable::StaticClass());
+	const TArray<FAssetData> Banks = GetAssetsOfClass(AssetRegistry, USSVoiceCultureBank::StaticClass());
+
+	Stats.AssetsScanned = VoiceAssets.Num() + Tables.Num() + Banks.Num();
+	Stats.AssetsMatched = AffectedAssets.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Culture rename: %d of %d voice assets affected, %d table(s), %d bank(s) to check"),
+	       AffectedAssets.Num(), VoiceAssets.Num(), Tables.Num(), Banks.Num());
+
+	FScopedSlowTask SlowTask(AffectedAssets.Num() + Tables.Num() + Banks.Num() + 1,
+	                         NSLOCTEXT("SSVoiceCultureEditor", "RenamingCultures", "Renaming culture codes..."), Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	// 2. Voice assets, tables and banks in batches
+	const double ApplyStart = FPlatformTime::Seconds();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+	double SaveSeconds = 0.0;
+	bool bCancelled = false;
+
+	auto RenameAssets = [&](const TArray<FAssetData>& Assets)
+	{
+		for (int32 BatchStart = 0; BatchStart < Assets.Num() && !bCancelled; BatchStart += BatchSize)
+		{
+			if (SlowTask.ShouldCancel())
+			{
+				bCancelled = true;
+				break;
+			}
+
+			const TConstArrayView<FAssetData> Batch = MakeArrayView(Assets).Slice(
+				BatchStart, FMath::Min(BatchSize, Assets.Num() - BatchStart));
+			SlowTask.EnterProgressFrame(Batch.Num());
+			LoadAssetsParallel(Batch);
+
+			TSet<UPackage*> ModifiedPackages;
+			for (const FAssetData& AssetData : Batch)
+			{
+				UObject* Asset = AssetData.FastGetAsset(false);
+				bool bModified = false;
+
+				if (USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(Asset))
+				{
+					bModified |= RenameCultures(VoiceSound->VoiceCultures, &FSSCultureAudioEntry::Culture, NewByOld, VoiceSound,
+					                            TEXT("VoiceCultures"), OutReport);
+					bModified |= RenameCultures(VoiceSound->CultureAnalysis, &FSSCultureSoundAnalysis::Culture, NewByOld, VoiceSound,
+					                            TEXT("CultureAnalysis"), OutReport);
+				}
+				else if (USSVoiceCultureTable* Table = Cast<USSVoiceCultureTable>(Asset))
+				{
+					bModified = RenameCultures(Table->Cultures, &FSSVoiceCultureTableCulture::Culture, NewByOld, Table,
+					                           TEXT("Cultures"), OutReport);
+				}
+				else if (USSVoiceCultureBank* Bank = Cast<USSVoiceCultureBank>(Asset))
+				{
+					bModified = RenameCultures(Bank->Cultures, &FSSVoiceCultureBankCulture::Culture, NewByOld, Bank,
+					                           TEXT("Cultures"), OutReport);
+				}
+
+				if (bModified)
+				{
+					Asset->MarkPackageDirty();
+					ModifiedPackages.Add(Asset->GetOutermost());
+				}
+			}
+			Stats.AssetsModified += ModifiedPackages.Num();
+
+			if (Options.bForceSave)
+			{
+				const double SaveStart = FPlatformTime::Seconds();
+				Stats.PackagesSaved += SavePackages(ModifiedPackages);
+				SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+			}
+			if (Options.bCollectGarbageBetweenBatches)
+			{
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			}
+		}
+	};
+
+	RenameAssets(AffectedAssets);
+	RenameAssets(Tables);
+	RenameAssets(Banks);
+
+	Stats.SaveSeconds = SaveSeconds;
+	Stats.ApplySeconds = FPlatformTime::Seconds() - ApplyStart - SaveSeconds;
+
+	// 3. Settings last, all values at once, so a cancelled run never points them at codes the assets do not use yet
+	if (!bCancelled)
+	{
+		SlowTask.EnterProgressFrame(1);
+
+		USSVoiceCultureSettings* Settings = USSVoiceCultureSettings::GetMutableSetting();
+
+		TSet<FString> SupportedCultures;
+		bool bSettingsModified = false;
+		for (FString Culture : Settings->SupportedVoiceCultures)
+		{
+			bSettingsModified |= RenameSetting(Culture, NewByOld, Settings, TEXT("SupportedVoiceCultures"), OutReport);
+			SupportedCultures.Add(Culture);
+		}
+
+		FString CurrentLanguage = Settings->CurrentLanguage;
+		FString PreviewLanguage = Settings->PreviewLanguage;
+		bSettingsModified |= RenameSetting(CurrentLanguage, NewByOld, Settings, TEXT("CurrentLanguage"), OutReport);
+		const bool bPreviewModified = RenameSetting(PreviewLanguage, NewByOld, Settings, TEXT("PreviewLanguage"), OutReport);
+
+		if (bSettingsModified || bPreviewModified)
+		{
+			Settings->SupportedVoiceCultures = MoveTemp(SupportedCultures);
+			Settings->CurrentLanguage = CurrentLanguage;
+			Settings->PreviewLanguage = PreviewLanguage;
+
+			// Project-wide change, written to DefaultGame.ini for the whole team
+			Settings->TryUpdateDefaultConfigFile();
+
+			if (bPreviewModified)
+			{
+				USSVoiceCultureSettings::OnPreviewLanguageChanged.Broadcast(PreviewLanguage);
+			}
+		}
+
+		USSVoiceCultureEditorSettings* EditorSettings = USSVoiceCultureEditorSettings::GetMutableSetting();
+		bool bEditorSettingsModified = RenameSetting(EditorSettings->ReferenceCulture, NewByOld, EditorSettings,
+		                                             TEXT("ReferenceCulture"), OutReport);
+		for (FSSVoiceCultureAudioProfile& Profile : EditorSettings->CultureAudioProfiles)
+		{
+			bEditorSettingsModified |= RenameSetting(Profile.Culture, NewByOld, EditorSettings, TEXT("CultureAudioProfiles"), OutReport);
+		}
+		if (bEditorSettingsModified)
+		{
+			EditorSettings->SaveConfig();
+		}
+
+		OutReport.bSettingsUpdated = true;
+	}
+
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Culture rename %s: %d change(s), %d conflict(s), %d asset(s) modified, %d saved (%.2fs)"),
+	       bCancelled ? TEXT("cancelled") : TEXT("done"), OutReport.Changes.Num(), OutReport.Conflicts, Stats.AssetsModified,
+	       Stats.PackagesSaved, Stats.TotalSeconds);
+
+	return !bCancelled;
+}
+
+bool FSSVoiceCultureUtils::SaveCultureRenameReport(const FSSVoiceCultureRenameReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/CultureRename.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Culture rename report written to %s"), *ReportPath);
+	return true;
+}
@@ -0,0 +1,446 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "Audio.h"
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Sound/SoundWave.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find Duplicate Sounds"), STAT_VoiceCulture_FindDuplicates, STATGROUP_VoiceCulture);
+
+namespace
+{
+	constexpr int32 PcmHashCacheVersion = 1;
+
+	/** Identity of the PCM data of a wave */
+	struct FPcmHash
+	{
+		/** Saved hash of the package the entry was computed from, the entry is stale once it changes */
+		FIoHash PackageHash;
+
+		uint64 Hash = 0;
+		int64 NumBytes = 0;
+		uint32 SampleRate = 0;
+		uint16 NumChannels = 0;
+
+		/** Same audio, whatever package it comes from */
+		bool operator==(const FPcmHash& Other) const
+		{
+			return Hash == Other.Hash && NumBytes == Other.NumBytes && SampleRate == Other.SampleRate &&
+				NumChannels == Other.NumChannels;
+		}
+
+		friend uint32 GetTypeHash(const FPcmHash& PcmHash)
+		{
+			return ::GetTypeHash(PcmHash.Hash);
+		}
+
+		friend FArchive& operator<<(FArchive& Ar, FPcmHash& PcmHash)
+		{
+			return Ar << PcmHash.PackageHash << PcmHash.Hash << PcmHash.NumBytes << PcmHash.SampleRate << PcmHash.NumChannels;
+		}
+	};
+
+	FString GetPcmHashCachePath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/PcmHashCache.bin");
+	}
+
+	void LoadPcmHashCache(TMap<FName, FPcmHash>& OutCache)
+	{
+		const TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*GetPcmHashCachePath()));
+		if (!Ar)
+			return;
+
+		int32 Version = 0;
+		int32 NumEntries = 0;
+		*Ar << Version << NumEntries;
+		if (Version != PcmHashCacheVersion || NumEntries < 0)
+			return;
+
+		OutCache.Reserve(NumEntries);
+		for (int32 i = 0; i < NumEntries && !Ar->IsError(); ++i)
+		{
+			FString PackageName;
+			FPcmHash PcmHash;
+			*Ar << PackageName << PcmHash;
+			OutCache.Add(FName(PackageName), PcmHash);
+		}
+	}
+
+	void SavePcmHashCache(const TMap<FName, FPcmHash>& Cache)
+	{
+		const TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileWriter(*GetPcmHashCachePath()));
+		if (!Ar)
+		{
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Could not write %s"), *GetPcmHashCachePath());
+			return;
+		}
+
+		int32 Version = PcmHashCacheVersion;
+		int32 NumEntries = Cache.Num();
+		*Ar << Version << NumEntries;
+
+		for (const TPair<FName, FPcmHash>& Pair : Cache)
+		{
+			FString PackageName = Pair.Key.ToString();
+			FPcmHash PcmHash = Pair.Value;
+			*Ar << PackageName << PcmHash;
+		}
+	}
+
+	/** Hashes the sample data of an imported wave file (headers and metadata chunks differ between imports) */
+	bool HashPayload(const FSharedBuffer& Payload, FPcmHash& OutHash)
+	{
+		if (Payload.GetSize() == 0)
+			return false;
+
+		const uint8* Data = static_cast<const uint8*>(Payload.GetData());
+
+		FWaveModInfo WaveInfo;
+		if (WaveInfo.ReadWaveInfo(Data, static_cast<int32>(Payload.GetSize())))
+		{
+			OutHash.Hash = FXxHash64::HashBuffer(WaveInfo.SampleDataStart, WaveInfo.SampleDataSize).Hash;
+			OutHash.NumBytes = WaveInfo.SampleDataSize;
+			OutHash.SampleRate = *WaveInfo.pSamplesPerSec;
+			OutHash.NumChannels = *WaveInfo.pChannels;
+			return true;
+		}
+
+		// Not a wave file: only identical payloads match
+		OutHash.Hash = FXxHash64::HashBuffer(Data, Payload.GetSize()).Hash;
+		OutHash.NumBytes = Payload.GetSize();
+		return true;
+	}
+
+	/** Voice assets and table columns, the assets that reference culture sounds */
+	TArray<FAssetData> GetCultureSoundReferencers()
+	{
+		TArray<FAssetData> Referencers = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+
+		FARFilter Filter;
+		Filter.ClassPaths.Add(USSVoiceCultureTableColumn::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Add(FName("/Game"));
+		USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get().GetAssets(Filter, Referencers);
+
+		return Referencers;
+	}
+}
+
+void FSSVoiceCultureUtils::FindDuplicateCultureSounds(const FSSVoiceCultureBatchOptions& Options,
+                                                      FSSVoiceCultureDedupReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_FindDuplicates, "VoiceCulture::FindDuplicateCultureSounds");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("Dedup");
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	// 1. Culture sound waves from the soft references of voice assets and table columns (registry only)
+	TMap<FName, FAssetData> WavesByPackage;
+	TMap<FName, TArray<FString>> ReferencersByWave;
+	TSet<FName> NonWavePackages;
+
+	TArray<FName> Dependencies;
+	TArray<FAssetData> PackageAssets;
+	for (const FAssetData& Referencer : GetCultureSoundReferencers())
+	{
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(Referencer.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+		                              UE::AssetRegistry::EDependencyQuery::Soft);
+
+		for (const FName& Dependency : Dependencies)
+		{
+			if (NonWavePackages.Contains(Dependency))
+				continue;
+
+			if (!WavesByPackage.Contains(Dependency))
+			{
+				PackageAssets.Reset();
+				AssetRegistry.GetAssetsByPackageName(Dependency, PackageAssets);
+
+				const FAssetData* Wave = PackageAssets.FindByPredicate([](const FAssetData& Asset)
+				{
+					return Asset.IsInstanceOf(USoundWave::StaticClass());
+				});
+				if (!Wave)
+				{
+					NonWavePackages.Add(Dependency);
+					continue;
+				}
+				WavesByPackage.Add(Dependency, *Wave);
+			}
+			ReferencersByWave.FindOrAdd(Dependency).AddUnique(Referencer.GetObjectPathString());
+		}
+	}
+
+	Stats.AssetsScanned = WavesByPackage.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// 2. Cached hashes for unchanged packages, the rest is loaded and hashed
+	TMap<FName, FPcmHash> Cache;
+	LoadPcmHashCache(Cache);
+
+	TMap<FName, FPcmHash> Hashes;
+	TArray<FAssetData> WavesToHash;
+	for (const TPair<FName, FAssetData>& Pair : WavesByPackage)
+	{
+		const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Pair.Key);
+		const FIoHash PackageHash = PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash();
+
+		const FPcmHash* Cached = Cache.Find(Pair.Key);
+		if (Cached && !PackageHash.IsZero() && Cached->PackageHash == PackageHash)
+		{
+			Hashes.Add(Pair.Key, *Cached);
+			OutReport.CacheHits++;
+			continue;
+		}
+		WavesToHash.Add(Pair.Value);
+	}
+
+	const double HashStart = FPlatformTime::Seconds();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	for (int32 BatchStart = 0; BatchStart < WavesToHash.Num(); BatchStart += BatchSize)
+	{
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(WavesToHash).Slice(
+			BatchStart, FMath::Min(BatchSize, WavesToHash.Num() - BatchStart));
+		LoadAssetsParallel(Batch);
+
+		// Payload requests on the game thread, decoding and hashing on workers
+		TArray<TFuture<FSharedBuffer>> Payloads;
+		Payloads.Reserve(Batch.Num());
+		for (const FAssetData& WaveAsset : Batch)
+		{
+			const USoundWave* Wave = Cast<USoundWave>(WaveAsset.FastGetAsset(false));
+			Payloads.Add(Wave ? Wave->RawData.GetPayload() : MakeFulfilledPromise<FSharedBuffer>().GetFuture());
+		}
+
+		TArray<FPcmHash> BatchHashes;
+		BatchHashes.SetNum(Batch.Num());
+		TArray<bool> BatchHashed;
+		BatchHashed.SetNumZeroed(Batch.Num());
+
+		ParallelFor(Batch.Num(), [&](int32 i)
+		{
+			const FSharedBuffer Payload = Payloads[i].Get();
+			BatchHashed[i] = HashPayload(Payload, BatchHashes[i]);
+		});
+
+		for (int32 i = 0; i < Batch.Num(); ++i)
+		{
+			if (!BatchHashed[i])
+			{
+				UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] No audio data for %s"),
+				       *Batch[i].GetObjectPathString());
+				continue;
+			}
+
+			const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Batch[i].PackageName);
+			BatchHashes[i].PackageHash = PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash();
+
+			Hashes.Add(Batch[i].PackageName, BatchHashes[i]);
+			Cache.Add(Batch[i].PackageName, BatchHashes[i]);
+		}
+		OutReport.SoundsHashed += Batch.Num();
+
+		// Raw payloads are released with the futures, the waves with the GC
+		Payloads.Reset();
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	Stats.MatchSeconds = FPlatformTime::Seconds() - HashStart;
+	SavePcmHashCache(Cache);
+
+	// 3. Clusters of identical audio
+	TMap<FPcmHash, TArray<FName>> WavesByHash;
+	for (const TPair<FName, FPcmHash>& Pair : Hashes)
+	{
+		WavesByHash.FindOrAdd(Pair.Value).Add(Pair.Key);
+	}
+
+	for (TPair<FPcmHash, TArray<FName>>& Pair : WavesByHash)
+	{
+		if (Pair.Value.Num() < 2)
+			continue;
+
+		TArray<FString> WavePaths;
+		for (const FName& WavePackage : Pair.Value)
+		{
+			WavePaths.Add(WavesByPackage[WavePackage].GetObjectPathString());
+		}
+		WavePaths.Sort();
+
+		FSSVoiceCultureDuplicateCluster& Cluster = OutReport.Clusters.AddDefaulted_GetRef();
+		Cluster.Canonical = WavePaths[0];
+		Cluster.Duplicates = TArray<FString>(WavePaths.GetData() + 1, WavePaths.Num() - 1);
+		Cluster.NumBytes = Pair.Key.NumBytes;
+
+		for (const FName& WavePackage : Pair.Value)
+		{
+			if (WavesByPackage[WavePackage].GetObjectPathString() == Cluster.Canonical)
+				continue;
+
+			for (const FString& Referencer : ReferencersByWave[WavePackage])
+			{
+				Cluster.Referencers.AddUnique(Referencer);
+			}
+		}
+
+		OutReport.DuplicateBytes += Cluster.NumBytes * Cluster.Duplicates.Num();
+		Stats.AssetsMatched += Cluster.Duplicates.Num();
+	}
+
+	// Biggest savings first
+	OutReport.Clusters.Sort([](const FSSVoiceCultureDuplicateCluster& A, const FSSVoiceCultureDuplicateCluster& B)
+	{
+		return A.NumBytes * A.Duplicates.Num() > B.NumBytes * B.Duplicates.Num();
+	});
+
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display,
+	       TEXT("[SSVoiceCulture] %d culture sound(s), %d hashed, %d from cache: %d duplicate cluster(s), %.1f MB of duplicate PCM"),
+	       WavesByPackage.Num(), OutReport.SoundsHashed, OutReport.CacheHits, OutReport.Clusters.Num(),
+	       OutReport.DuplicateBytes / (1024.0 * 1024.0));
+}
+
+int32 FSSVoiceCultureUtils::ApplyDuplicateClusters(const TArray<FSSVoiceCultureDuplicateCluster>& Clusters,
+                                                   const FSSVoiceCultureBatchOptions& Options,
+                                                   FSSVoiceCultureOperationStats& OutStats)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TMap<FSoftObjectPath, FSoftObjectPath> Redirects;
+	TSet<FString> ReferencerPaths;
+	for (const FSSVoiceCultureDuplicateCluster& Cluster : Clusters)
+	{
+		for (const FString& Duplicate : Cluster.Duplicates)
+		{
+			Redirects.Add(FSoftObjectPath(Duplicate), FSoftObjectPath(Cluster.Canonical));
+		}
+		ReferencerPaths.Append(Cluster.Referencers);
+	}
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	TArray<FAssetData> Referencers;
+	for (const FString& ReferencerPath : ReferencerPaths)
+	{
+		const FAssetData Referencer = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ReferencerPath));
+		if (Referencer.IsValid())
+		{
+			Referencers.Add(Referencer);
+		}
+	}
+
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+	int32 ModifiedAssets = 0;
+	double SaveSeconds = 0.0;
+
+	for (int32 BatchStart = 0; BatchStart < Referencers.Num(); BatchStart += BatchSize)
+	{
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(Referencers).Slice(
+			BatchStart, FMath::Min(BatchSize, Referencers.Num() - BatchStart));
+		LoadAssetsParallel(Batch);
+
+		TSet<UPackage*> ModifiedPackages;
+		for (const FAssetData& ReferencerAsset : Batch)
+		{
+			UObject* Referencer = ReferencerAsset.FastGetAsset(false);
+			bool bModified = false;
+
+			auto Redirect = [&](TSoftObjectPtr<USoundBase>& Sound)
+			{
+				if (const FSoftObjectPath* Canonical = Redirects.Find(Sound.ToSoftObjectPath()))
+				{
+					if (!bModified)
+					{
+						Referencer->Modify();
+						bModified = true;
+					}
+					Sound = TSoftObjectPtr<USoundBase>(*Canonical);
+				}
+			};
+
+			if (USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(Referencer))
+			{
+				for (FSSCultureAudioEntry& Entry : VoiceSound->VoiceCultures)
+				{
+					Redirect(Entry.Sound);
+				}
+			}
+			else if (USSVoiceCultureTableColumn* Column = Cast<USSVoiceCultureTableColumn>(Referencer))
+			{
+				for (TSoftObjectPtr<USoundBase>& Sound : Column->Sounds)
+				{
+					Redirect(Sound);
+				}
+			}
+
+			if (bModified)
+			{
+				Referencer->MarkPackageDirty();
+				ModifiedPackages.Add(Referencer->GetOutermost());
+				ModifiedAssets++;
+			}
+		}
+
+		if (Options.bForceSave)
+		{
+			const double SaveStart = FPlatformTime::Seconds();
+			OutStats.PackagesSaved += SavePackages(ModifiedPackages);
+			SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	OutStats.AssetsModified += ModifiedAssets;
+	OutStats.SaveSeconds += SaveSeconds;
+	OutStats.ApplySeconds += FPlatformTime::Seconds() - StartTime - SaveSeconds;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d duplicate sound(s) redirected in %d asset(s)"),
+	       Redirects.Num(), ModifiedAssets);
+
+	return ModifiedAssets;
+}
+
+bool FSSVoiceCultureUtils::SaveDedupReport(const FSSVoiceCultureDedupReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/DuplicateSounds.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Duplicate sounds report written to %s"), *ReportPath);
+	return true;
+}
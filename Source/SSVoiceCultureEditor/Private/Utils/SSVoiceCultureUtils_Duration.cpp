@@ -0,0 +1,114 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "SSVoiceCultureStats.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find Duration Mismatches"), STAT_VoiceCulture_FindDurationMismatches, STATGROUP_VoiceCulture);
+
+namespace
+{
+	const FName VoiceDurationsTag("VoiceDurations");
+
+	/** Calls Func(FStringView Culture, float Duration) for each "culture=seconds" entry of a "VoiceDurations" tag */
+	template <typename FuncType>
+	void ForEachTaggedDuration(FStringView Tag, FuncType&& Func)
+	{
+		while (Tag.Len() > 0)
+		{
+			int32 EntryEnd = INDEX_NONE;
+			if (!Tag.FindChar(TEXT(','), EntryEnd))
+			{
+				EntryEnd = Tag.Len();
+			}
+
+			const FStringView Entry = Tag.Left(EntryEnd);
+			int32 Separator = INDEX_NONE;
+			if (Entry.FindChar(TEXT('='), Separator))
+			{
+				// The tag string is null-terminated, Atof stops at the next ','
+				Func(Entry.Left(Separator), FCString::Atof(Entry.GetData() + Separator + 1));
+			}
+			Tag.RightChopInline(EntryEnd + 1);
+		}
+	}
+}
+
+void FSSVoiceCultureUtils::FindDurationMismatches(const TArray<FAssetData>& VoiceAssets, const FString& ReferenceCulture,
+                                                  float MaxRatio, const FSSVoiceCultureBatchOptions& Options,
+                                                  TArray<FSSVoiceCultureDurationMismatch>& OutMismatches)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_FindDurationMismatches, "VoiceCulture::FindDurationMismatches");
+
+	OutMismatches.Reset();
+
+	const FString Reference = ReferenceCulture.ToLower();
+	const float MinRatio = 1.f / FMath::Max(MaxRatio, 1.f);
+
+	// Each chunk collects its own mismatches, merged in registry order
+	const int32 NumChunks = Options.GetNumChunks(VoiceAssets.Num());
+	const int32 ChunkSize = FMath::DivideAndRoundUp(VoiceAssets.Num(), NumChunks);
+
+	TArray<TArray<FSSVoiceCultureDurationMismatch>> ChunkMismatches;
+	ChunkMismatches.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, VoiceAssets.Num());
+		for (int32 i = Start; i < End; ++i)
+		{
+			const FAssetData& VoiceAsset = VoiceAssets[i];
+
+			// "VoiceDurations" tag: "en=2.350,fr=2.910"
+			const FAssetTagValueRef Tag = VoiceAsset.TagsAndValues.FindTag(VoiceDurationsTag);
+			if (!Tag.IsSet())
+				continue;
+
+			const FString Durations = Tag.GetValue();
+
+			float ReferenceDuration = 0.f;
+			ForEachTaggedDuration(Durations, [&](FStringView Culture, float Duration)
+			{
+				if (Culture.Equals(Reference, ESearchCase::CaseSensitive))
+				{
+					ReferenceDuration = Duration;
+				}
+			});
+			if (ReferenceDuration <= 0.f)
+				continue;
+
+			ForEachTaggedDuration(Durations, [&](FStringView Culture, float Duration)
+			{
+				const float Ratio = Duration / ReferenceDuration;
+				if (Ratio <= MaxRatio && Ratio >= MinRatio)
+					return;
+
+				FSSVoiceCultureDurationMismatch& Mismatch = ChunkMismatches[ChunkIndex].AddDefaulted_GetRef();
+				Mismatch.VoiceAsset = VoiceAsset;
+				Mismatch.Culture = FString(Culture);
+				Mismatch.ReferenceDuration = ReferenceDuration;
+				Mismatch.Duration = Duration;
+			});
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (TArray<FSSVoiceCultureDurationMismatch>& Mismatches : ChunkMismatches)
+	{
+		OutMismatches.Append(MoveTemp(Mismatches));
+	}
+
+	// Most off first, a line half as long counts as much as one twice as long
+	OutMismatches.StableSort([](const FSSVoiceCultureDurationMismatch& A, const FSSVoiceCultureDurationMismatch& B)
+	{
+		const float RatioA = A.GetRatio();
+		const float RatioB = B.GetRatio();
+		return FMath::Max(RatioA, 1.f / RatioA) > FMath::Max(RatioB, 1.f / RatioB);
+	});
+}
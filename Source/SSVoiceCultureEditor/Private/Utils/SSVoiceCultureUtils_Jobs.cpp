@@ -0,0 +1,488 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureSettings.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Utils/SSVoiceCultureUI.h"
+
+#define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
+
+namespace
+{
+	/** Shared by the phases of one auto-populate job */
+	struct FAutoPopulateJobState
+	{
+		/** Kept alive even if the active profile changes while the job runs */
+		TStrongObjectPtr<USSVoiceCultureStrategy> Strategy;
+		bool bNativeStrategy = false;
+
+		TArray<FString> Cultures;
+		bool bOverrideExisting = false;
+		FSSVoiceCultureBatchOptions Options;
+
+		TArray<FAssetData> VoiceAssets;
+		TArray<FAssetData> SoundAssets;
+		TArray<FSSVoiceCultureAutoPopulateItem> Plan;
+
+		/** Next plan item (or voice asset, for blueprint strategies) to apply */
+		int32 Cursor = 0;
+
+		bool bSave = false;
+		int32 SaveBatchSize = 64;
+		TSet<UPackage*> PendingPackages;
+
+		FSSVoiceCultureOperationStats Stats;
+		double StartTime = 0.0;
+	};
+
+	TSharedRef<FAutoPopulateJobState> MakeAutoPopulateState(const FString& Operation)
+	{
+		TSharedRef<FAutoPopulateJobState> State = MakeShared<FAutoPopulateJobState>();
+
+		auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+		USSVoiceCultureStrategy* Strategy = VLEditorSubsystem->GetActiveStrategy();
+		State->Strategy.Reset(Strategy);
+
+		// Blueprint strategies override the BlueprintNativeEvents only, they must run on the game thread
+		State->bNativeStrategy = IsValid(Strategy) && Strategy->GetClass()->HasAnyClassFlags(CLASS_Native);
+
+		const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+		State->bSave = EditorSettings->bAutoSaveAfterAutoPopulate;
+		State->SaveBatchSize = FMath::Max(1, EditorSettings->BackgroundJobSaveBatchSize);
+		State->Options.bInteractive = false;
+
+		State->Stats.Operation = Operation;
+		State->StartTime = FPlatformTime::Seconds();
+		return State;
+	}
+
+	void AddMatchPhase(FSSVoiceCultureJob& Job, const TSharedRef<FAutoPopulateJobState>& State)
+	{
+		Job.AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobMatching", "Matching culture sounds..."),
+		                   [State](FSSVoiceCultureJob& InJob)
+		                   {
+			                   if (InJob.IsCancelRequested())
+				                   return;
+
+			                   // Blueprint strategies with explicit cultures match per asset against this cache
+			                   const bool bStrategyFallback = !State->bNativeStrategy && State->Cultures.Num() > 0;
+			                   if (!State->bNativeStrategy && !bStrategyFallback)
+				                   return; // AutoPopulateFromNaming scans on its own
+
+			                   const double PhaseStart = FPlatformTime::Seconds();
+			                   State->SoundAssets = USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets();
+			                   State->Stats.ScanSeconds += FPlatformTime::Seconds() - PhaseStart;
+			                   InJob.SetPhaseProgress(0.5f);
+
+			                   if (bStrategyFallback)
+				                   return;
+
+			                   const double MatchStart = FPlatformTime::Seconds();
+			                   FSSVoiceCultureUtils::BuildAutoPopulatePlan(
+				                   *State->Strategy, State->VoiceAssets, State->SoundAssets, State->Cultures,
+				                   State->bOverrideExisting, State->Options, State->Plan);
+			                   State->Stats.MatchSeconds += FPlatformTime::Seconds() - MatchStart;
+			                   State->Stats.AssetsMatched = State->Plan.Num();
+
+			                   // No longer needed, release before the long apply phase
+			                   State->SoundAssets.Empty();
+		                   });
+	}
+
+	/** Saves the pending packages when the batch is full (or when forced) */
+	void FlushPendingPackages(FAutoPopulateJobState& State, bool bForce)
+	{
+		if (!State.bSave || State.PendingPackages.Num() == 0)
+			return;
+
+		if (!bForce && State.PendingPackages.Num() < State.SaveBatchSize)
+			return;
+
+		const double SaveStart = FPlatformTime::Seconds();
+		State.Stats.PackagesSaved += FSSVoiceCultureUtils::SavePackages(State.PendingPackages);
+		State.Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		State.PendingPackages.Reset();
+	}
+
+	void AddApplyPhase(FSSVoiceCultureJob& Job, const TSharedRef<FAutoPopulateJobState>& State)
+	{
+		Job.AddGameThreadPhase(NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateApplying", "Updating entries..."),
+		                       [State](FSSVoiceCultureJob& InJob)
+		                       {
+			                       const double ApplyStart = FPlatformTime::Seconds();
+
+			                       if (State->bNativeStrategy)
+			                       {
+				                       if (State->Plan.IsValidIndex(State->Cursor))
+				                       {
+					                       if (FSSVoiceCultureUtils::ApplyAutoPopulateItem(
+						                       State->Plan[State->Cursor], State->bOverrideExisting, State->PendingPackages))
+					                       {
+						                       State->Stats.AssetsModified++;
+					                       }
+					                       State->Cursor++;
+				                       }
+			                       }
+			                       else if (State->VoiceAssets.IsValidIndex(State->Cursor))
+			                       {
+				                       // Blueprint strategy: per-asset path
+				                       USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(
+					                       State->VoiceAssets[State->Cursor].GetAsset());
+				                       if (State->Cultures.Num() > 0)
+				                       {
+					                       if (FSSVoiceCultureUtils::ApplyStrategyAutoPopulate(
+						                       *State->Strategy, VoiceSound, State->Cultures, State->bOverrideExisting,
+						                       State->SoundAssets, State->PendingPackages))
+					                       {
+						                       State->Stats.AssetsModified++;
+					                       }
+				                       }
+				                       else if (VoiceSound && FSSVoiceCultureUtils::AutoPopulateFromNaming(VoiceSound, false, false))
+				                       {
+					                       State->Stats.AssetsModified++;
+				                       }
+				                       State->Cursor++;
+			                       }
+			                       State->Stats.ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+			                       const int32 Total = State->bNativeStrategy ? State->Plan.Num() : State->VoiceAssets.Num();
+			                       const bool bDone = State->Cursor >= Total;
+
+			                       InJob.SetPhaseProgress(Total > 0 ? static_cast<float>(State->Cursor) / Total : 1.f);
+			                       FlushPendingPackages(*State, bDone);
+			                       return bDone;
+		                       });
+	}
+
+	FSSVoiceCultureJob::FOnFinished MakeAutoPopulateFinished(const TSharedRef<FAutoPopulateJobState>& State,
+	                                                         FSSVoiceCultureJob::FOnFinished&& OnDone)
+	{
+		return [State, OnDone = MoveTemp(OnDone)](bool bCancelled)
+		{
+			FSSVoiceCultureOperationStats& Stats = State->Stats;
+			Stats.TotalSeconds = FPlatformTime::Seconds() - State->StartTime;
+
+			UE_LOG(LogVoiceCultureEditor, Log,
+			       TEXT("[SSVoiceCulture] %s%s: scanned %d, matched %d, modified %d, saved %d "
+				       "(scan %.2fs, match %.2fs, apply %.2fs, save %.2fs, total %.2fs)"),
+			       *Stats.Operation, bCancelled ? TEXT(" (cancelled)") : TEXT(""), Stats.AssetsScanned,
+			       Stats.AssetsMatched, Stats.AssetsModified, Stats.PackagesSaved, Stats.ScanSeconds,
+			       Stats.MatchSeconds, Stats.ApplySeconds, Stats.SaveSeconds, Stats.TotalSeconds);
+
+			if (bCancelled)
+			{
+				FSSVoiceCultureUI::NotifyFailure(FText::Format(
+					NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateCancelled",
+					          "Auto-populate cancelled: {0} assets updated (unsaved changes stay dirty)."),
+					FText::AsNumber(Stats.AssetsModified)));
+			}
+			else if (Stats.AssetsModified > 0)
+			{
+				FSSVoiceCultureUI::NotifySuccess(FText::Format(
+					NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateDone", "Auto-populate completed: {0} assets updated."),
+					FText::AsNumber(Stats.AssetsModified)));
+			}
+			else
+			{
+				FSSVoiceCultureUI::NotifyFailure(
+					NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateNoChange", "No assets required auto-populate."));
+			}
+
+			if (OnDone)
+			{
+				OnDone(bCancelled);
+			}
+		};
+	}
+}
+
+TSharedRef<FSSVoiceCultureJob> FSSVoiceCultureUtils::MakeAutoPopulateCultureJob(const FString& TargetCulture,
+                                                                                bool bOverrideExisting,
+                                                                                FSSVoiceCultureJob::FOnFinished&& OnDone)
+{
+	TSharedRef<FAutoPopulateJobState> State = MakeAutoPopulateState(
+		FString::Printf(TEXT("AutoPopulateCulture:%s"), *TargetCulture.ToLower()));
+	State->Cultures.Add(TargetCulture.ToLower());
+	State->bOverrideExisting = bOverrideExisting;
+
+	TSharedRef<FSSVoiceCultureJob> Job = MakeShared<FSSVoiceCultureJob>(FText::Format(
+		NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulateCultureTitle", "Auto-populate voice culture '{0}'..."),
+		FText::FromString(TargetCulture.ToUpper())));
+
+	if (!State->Strategy.IsValid())
+	{
+		Job->AddGameThreadPhase(FText::GetEmpty(), [](FSSVoiceCultureJob&)
+		{
+			FSSVoiceCultureUI::NotifyFailure(
+				NSLOCTEXT("SSVoiceCultureEditor", "AutoPopulate_NoProfile", "No active auto-populate strategy found."));
+			return true;
+		});
+		Job->OnFinished(MoveTemp(OnDone));
+		return Job;
+	}
+
+	Job->AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobScanning", "Scanning assets..."),
+	                    [State](FSSVoiceCultureJob&)
+	                    {
+		                    const double PhaseStart = FPlatformTime::Seconds();
+		                    State->VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+		                    State->Stats.AssetsScanned = State->VoiceAssets.Num();
+		                    State->Stats.ScanSeconds += FPlatformTime::Seconds() - PhaseStart;
+	                    });
+
+	AddMatchPhase(*Job, State);
+	AddApplyPhase(*Job, State);
+	Job->OnFinished(MakeAutoPopulateFinished(State, MoveTemp(OnDone)));
+	return Job;
+}
+
+TSharedRef<FSSVoiceCultureJob> FSSVoiceCultureUtils::MakeAutoPopulateFromVoiceActorJob(const FString& VoiceActorName,
+	bool bOnlyMissingCulture, FSSVoiceCultureJob::FOnFinished&& OnDone)
+{
+	TSharedRef<FAutoPopulateJobState> State = MakeAutoPopulateState(
+		FString::Printf(TEXT("AutoPopulateFromVoiceActor:%s"), *VoiceActorName));
+	State->bOverrideExisting = USSVoiceCultureEditorSettings::GetSetting()->bAutoPopulateOverwriteExisting;
+
+	TSharedRef<FSSVoiceCultureJob> Job = MakeShared<FSSVoiceCultureJob>(FText::Format(
+		NSLOCTEXT("SSVoiceCultureEditor", "FilterByVoiceActor", "Filtering assets by voice actor: {0}"),
+		FText::FromString(VoiceActorName)));
+
+	Job->AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobScanning", "Scanning assets..."),
+	                    [State, VoiceActorName, bOnlyMissingCulture](FSSVoiceCultureJob&)
+	                    {
+		                    const double PhaseStart = FPlatformTime::Seconds();
+		                    USSVoiceCultureEditorSubsystem::GetAssetsFromVoiceActor(State->VoiceAssets, VoiceActorName);
+		                    if (bOnlyMissingCulture)
+		                    {
+			                    USSVoiceCultureEditorSubsystem::GetAssetsWithCulture(State->VoiceAssets, false);
+		                    }
+		                    State->Stats.AssetsScanned = State->VoiceAssets.Num();
+		                    State->Stats.ScanSeconds += FPlatformTime::Seconds() - PhaseStart;
+	                    });
+
+	AddMatchPhase(*Job, State);
+	AddApplyPhase(*Job, State);
+	Job->OnFinished(MakeAutoPopulateFinished(State, MoveTemp(OnDone)));
+	return Job;
+}
+
+TSharedRef<FSSVoiceCultureJob> FSSVoiceCultureUtils::MakeRescanActorsJob(FSSVoiceCultureJob::FOnFinished&& OnDone)
+{
+	struct FRescanState
+	{
+		TStrongObjectPtr<USSVoiceCultureStrategy> Strategy;
+		TArray<FAssetData> VoiceAssets;
+		TSet<FString> UniqueActors;
+		int32 Cursor = 0;
+	};
+
+	TSharedRef<FRescanState> State = MakeShared<FRescanState>();
+
+	auto* VLEditorSubsystem = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>();
+	USSVoiceCultureStrategy* Strategy = VLEditorSubsystem->GetActiveStrategy();
+	State->Strategy.Reset(Strategy);
+
+	const bool bNativeStrategy = IsValid(Strategy) && Strategy->GetClass()->HasAnyClassFlags(CLASS_Native);
+
+	TSharedRef<FSSVoiceCultureJob> Job = MakeShared<FSSVoiceCultureJob>(
+		NSLOCTEXT("SSVoiceCultureEditor", "RescanningActors", "Rescanning actors..."));
+
+	Job->AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobScanning", "Scanning assets..."),
+	                    [State, bNativeStrategy](FSSVoiceCultureJob& InJob)
+	                    {
+		                    State->VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+		                    if (!bNativeStrategy)
+			                    return;
+
+		                    // Native rules are plain name parsing, call them directly off the game thread
+		                    for (int32 i = 0; i < State->VoiceAssets.Num() && !InJob.IsCancelRequested(); ++i)
+		                    {
+			                    FString ActorName;
+			                    if (State->Strategy->ExecuteExtractActorNameFromAsset_Implementation(State->VoiceAssets[i], ActorName))
+			                    {
+				                    State->UniqueActors.Add(ActorName);
+			                    }
+		                    }
+		                    State->Cursor = State->VoiceAssets.Num();
+	                    });
+
+	if (!bNativeStrategy)
+	{
+		// Blueprint strategy: the extraction event must run on the game thread
+		Job->AddGameThreadPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobParsingNames", "Parsing asset names..."),
+		                        [State](FSSVoiceCultureJob& InJob)
+		                        {
+			                        if (!IsValid(State->Strategy.Get()) || !State->VoiceAssets.IsValidIndex(State->Cursor))
+				                        return true;
+
+			                        FString ActorName;
+			                        if (State->Strategy->ExecuteExtractActorNameFromAsset(State->VoiceAssets[State->Cursor], ActorName))
+			                        {
+				                        State->UniqueActors.Add(ActorName);
+			                        }
+			                        State->Cursor++;
+			                        InJob.SetPhaseProgress(static_cast<float>(State->Cursor) / State->VoiceAssets.Num());
+			                        return State->Cursor >= State->VoiceAssets.Num();
+		                        });
+	}
+
+	Job->AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "GeneratingJson", "Generating JSON..."),
+	                    [State](FSSVoiceCultureJob&)
+	                    {
+		                    TArray<FString> Actors = State->UniqueActors.Array();
+		                    Actors.Sort();
+		                    SaveActorListJson(Actors);
+	                    });
+
+	Job->OnFinished([OnDone = MoveTemp(OnDone)](bool bCancelled)
+	{
+		if (!bCancelled)
+		{
+			FSSVoiceCultureUI::NotifySuccess(NSLOCTEXT("SSVoiceCultureEditor", "ScanVoiceNameComplete",
+			                                           "Actor voice scan completed."));
+		}
+
+		if (OnDone)
+		{
+			OnDone(bCancelled);
+		}
+	});
+	return Job;
+}
+
+TSharedRef<FSSVoiceCultureJob> FSSVoiceCultureUtils::MakeCoverageReportJob(const TSharedRef<FSSVoiceCultureReport>& OutReport,
+                                                                           FSSVoiceCultureJob::FOnFinished&& OnDone)
+{
+	TSharedRef<FSSVoiceCultureJob> Job = MakeShared<FSSVoiceCultureJob>(
+		NSLOCTEXT("SSVoiceCultureEditor", "ScanningCultures", "Scanning voice cultures..."));
+
+	// Registry and tag parsing only, no loads
+	Job->AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "ScanningCultures", "Scanning voice cultures..."),
+	                    [OutReport](FSSVoiceCultureJob&)
+	                    {
+		                    GenerateCultureCoverageReport(*OutReport);
+	                    });
+
+	Job->OnFinished([OnDone = MoveTemp(OnDone)](bool bCancelled)
+	{
+		if (!bCancelled)
+		{
+			FSSVoiceCultureUI::NotifySuccess(
+				NSLOCTEXT("SSVoiceCultureEditor", "ScanningCulturesSuccess", "Successfully scanned voice cultures."));
+		}
+
+		if (OnDone)
+		{
+			OnDone(bCancelled);
+		}
+	});
+	return Job;
+}
+
+TSharedRef<FSSVoiceCultureJob> FSSVoiceCultureUtils::MakeLoudnessAnalysisJob(
+	const TSharedRef<FSSVoiceCultureLoudnessReport>& OutReport, FSSVoiceCultureJob::FOnFinished&& OnDone)
+{
+	struct FLoudnessState
+	{
+		TArray<FAssetData> VoiceAssets;
+		int32 Cursor = 0;
+
+		bool bSave = false;
+		int32 SaveBatchSize = 64;
+		TSet<UPackage*> PendingPackages;
+
+		FSSVoiceCultureOperationStats Stats;
+		double StartTime = 0.0;
+	};
+
+	TSharedRef<FLoudnessState> State = MakeShared<FLoudnessState>();
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	State->bSave = EditorSettings->bAutoSaveAfterAutoPopulate;
+	State->SaveBatchSize = FMath::Max(1, EditorSettings->BackgroundJobSaveBatchSize);
+	State->Stats.Operation = TEXT("Loudness");
+	State->StartTime = FPlatformTime::Seconds();
+
+	TSharedRef<FSSVoiceCultureJob> Job = MakeShared<FSSVoiceCultureJob>(
+		NSLOCTEXT("SSVoiceCultureEditor", "AnalyzingLoudness", "Analyzing culture sound loudness..."));
+
+	Job->AddWorkerPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobScanning", "Scanning assets..."),
+	                    [State](FSSVoiceCultureJob&)
+	                    {
+		                    const double PhaseStart = FPlatformTime::Seconds();
+		                    State->VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+		                    State->Stats.AssetsScanned = State->VoiceAssets.Num();
+		                    State->Stats.ScanSeconds += FPlatformTime::Seconds() - PhaseStart;
+	                    });
+
+	// A few voice assets per step: their sounds are loaded together and measured on workers
+	Job->AddGameThreadPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobMeasuringLoudness", "Measuring culture sounds..."),
+	                        [State](FSSVoiceCultureJob& InJob)
+	                        {
+		                        constexpr int32 StepSize = 8;
+		                        const double ApplyStart = FPlatformTime::Seconds();
+
+		                        const int32 Num = FMath::Min(StepSize, State->VoiceAssets.Num() - State->Cursor);
+		                        if (Num > 0)
+		                        {
+			                        State->Stats.AssetsMatched += AnalyzeCultureLoudnessBatch(
+				                        MakeArrayView(State->VoiceAssets).Slice(State->Cursor, Num), State->PendingPackages);
+			                        State->Cursor += Num;
+		                        }
+		                        State->Stats.ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+		                        const bool bDone = State->Cursor >= State->VoiceAssets.Num();
+		                        InJob.SetPhaseProgress(State->VoiceAssets.Num() > 0
+			                                               ? static_cast<float>(State->Cursor) / State->VoiceAssets.Num()
+			                                               : 1.f);
+
+		                        if (State->bSave && State->PendingPackages.Num() > 0 &&
+			                        (bDone || State->PendingPackages.Num() >= State->SaveBatchSize))
+		                        {
+			                        const double SaveStart = FPlatformTime::Seconds();
+			                        State->Stats.PackagesSaved += SavePackages(State->PendingPackages);
+			                        State->Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+			                        State->PendingPackages.Reset();
+		                        }
+		                        return bDone;
+	                        });
+
+	// Reads the analysis of the (loaded) voice assets, game thread
+	Job->AddGameThreadPhase(NSLOCTEXT("SSVoiceCultureEditor", "JobLoudnessReport", "Comparing cultures..."),
+	                        [State, OutReport](FSSVoiceCultureJob&)
+	                        {
+		                        State->Stats.TotalSeconds = FPlatformTime::Seconds() - State->StartTime;
+		                        BuildLoudnessReport(State->VoiceAssets, *OutReport);
+		                        OutReport->Stats = State->Stats;
+		                        SaveLoudnessReport(*OutReport);
+		                        return true;
+	                        });
+
+	Job->OnFinished([OutReport, OnDone = MoveTemp(OnDone)](bool bCancelled)
+	{
+		if (!bCancelled)
+		{
+			FSSVoiceCultureUI::NotifySuccess(FText::Format(
+				NSLOCTEXT("SSVoiceCultureEditor", "LoudnessAnalysisDone",
+				          "Loudness analysis completed: {0} culture sounds off the reference culture."),
+				FText::AsNumber(OutReport->Flagged.Num())));
+		}
+
+		if (OnDone)
+		{
+			OnDone(bCancelled);
+		}
+	});
+	return Job;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,276 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureLevelManifest.h"
+#include "SSVoiceCultureTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+
+const TCHAR* FSSVoiceCultureUtils::DefaultLevelManifestPath = TEXT("/Game/VoiceCulture/VoiceCultureLevelManifest.VoiceCultureLevelManifest");
+
+namespace
+{
+	/** Voice packages reachable from the roots through hard package dependencies */
+	void CollectVoicePackages(IAssetRegistry& AssetRegistry, const TArray<FName>& Roots, const TSet<FName>& VoicePackages,
+	                          TSet<FName>& OutVoicePackages)
+	{
+		TSet<FName> Visited;
+		TArray<FName> Stack = Roots;
+		TArray<FName> Dependencies;
+
+		while (Stack.Num() > 0)
+		{
+			const FName PackageName = Stack.Pop();
+
+			bool bAlreadyVisited = false;
+			Visited.Add(PackageName, &bAlreadyVisited);
+			if (bAlreadyVisited)
+				continue;
+
+			// Culture sounds are soft references of the voice asset, nothing to follow below it
+			if (VoicePackages.Contains(PackageName))
+			{
+				OutVoicePackages.Add(PackageName);
+				continue;
+			}
+
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+			                              UE::AssetRegistry::EDependencyQuery::Hard);
+
+			for (const FName& Dependency : Dependencies)
+			{
+				// Native classes and engine content never reference project voice
+				const FNameBuilder DependencyName(Dependency);
+				if (DependencyName.ToView().StartsWith(TEXT("/Script/")) || DependencyName.ToView().StartsWith(TEXT("/Engine/")))
+					continue;
+
+				Stack.Add(Dependency);
+			}
+		}
+	}
+}
+
+void FSSVoiceCultureUtils::BuildLevelManifest(const TArray<FString>& MapPackages, USSVoiceCultureLevelManifest& Manifest,
+                                              FSSVoiceCultureOperationStats& OutStats)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats.Operation = TEXT("LevelManifest");
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	// 1. Maps and voice assets from the registry
+	TArray<FName> Maps;
+	if (MapPackages.Num() > 0)
+	{
+		for (const FString& MapPackage : MapPackages)
+		{
+			Maps.Add(FName(MapPackage));
+		}
+	}
+	else
+	{
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UWorld::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Add(FName("/Game"));
+
+		TArray<FAssetData> MapAssets;
+		AssetRegistry.GetAssets(Filter, MapAssets);
+		for (const FAssetData& MapAsset : MapAssets)
+		{
+			Maps.AddUnique(MapAsset.PackageName);
+		}
+	}
+
+	TMap<FName, FSoftObjectPath> VoiceAssetsByPackage;
+	for (const FAssetData& VoiceAsset : USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets())
+	{
+		VoiceAssetsByPackage.Add(VoiceAsset.PackageName, VoiceAsset.GetSoftObjectPath());
+	}
+
+	TSet<FName> VoicePackages;
+	VoicePackages.Reserve(VoiceAssetsByPackage.Num());
+	for (const TPair<FName, FSoftObjectPath>& Pair : VoiceAssetsByPackage)
+	{
+		VoicePackages.Add(Pair.Key);
+	}
+
+	// 2. Voice assets referenced per map (dependency walk, maps are not loaded)
+	TMap<FName, TSet<FName>> VoicePackagesByMap;
+	TArray<FAssetData> ExternalActors;
+	for (const FName& Map : Maps)
+	{
+		TArray<FName> Roots = {Map};
+
+		// World Partition / one file per actor: actors live in their own packages, not referenced by the map
+		ExternalActors.Reset();
+		AssetRegistry.GetAssetsByPath(FName(ULevel::GetExternalActorsPath(Map.ToString())), ExternalActors, true, true);
+		for (const FAssetData& ExternalActor : ExternalActors)
+		{
+			Roots.AddUnique(ExternalActor.PackageName);
+		}
+
+		TSet<FName> MapVoicePackages;
+		CollectVoicePackages(AssetRegistry, Roots, VoicePackages, MapVoicePackages);
+		if (MapVoicePackages.Num() > 0)
+		{
+			VoicePackagesByMap.Add(Map, MoveTemp(MapVoicePackages));
+		}
+	}
+
+	OutStats.AssetsScanned = Maps.Num();
+	OutStats.AssetsMatched = VoicePackagesByMap.Num();
+	OutStats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// 3. Culture sounds of each referenced voice asset (voice assets are small, culture sounds stay unloaded)
+	const double ApplyStart = FPlatformTime::Seconds();
+
+	Manifest.Sounds.Reset();
+	Manifest.Levels.Reset();
+
+	TMap<FSoftObjectPath, int32> SoundIndices;
+	TMap<FName, TArray<TPair<FString, int32>>> CultureSoundsByVoicePackage;
+
+	for (const TPair<FName, TSet<FName>>& MapPair : VoicePackagesByMap)
+	{
+		for (const FName& VoicePackage : MapPair.Value)
+		{
+			if (CultureSoundsByVoicePackage.Contains(VoicePackage))
+				continue;
+
+			TArray<TPair<FString, int32>>& CultureSounds = CultureSoundsByVoicePackage.Add(VoicePackage);
+
+			const USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAssetsByPackage[VoicePackage].TryLoad());
+			if (!VoiceSound)
+			{
+				UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Could not load %s"), *VoicePackage.ToString());
+				continue;
+			}
+
+			// Lines packed into a bank load their whole culture chunk instead
+			const USSVoiceCultureBank* Bank = VoiceSound->Bank.LoadSynchronous();
+			const bool bInBank = Bank && Bank->LineIds.Contains(VoiceSound->BankLineId);
+
+			auto AddCultureSound = [&](const FString& Culture, const FSoftObjectPath& SoundPath)
+			{
+				int32* SoundIndex = SoundIndices.Find(SoundPath);
+				if (!SoundIndex)
+				{
+					SoundIndex = &SoundIndices.Add(SoundPath, Manifest.Sounds.Add(SoundPath));
+				}
+				CultureSounds.Emplace(Culture.ToLower(), *SoundIndex);
+			};
+
+			for (const FSSCultureAudioEntry& Entry : VoiceSound->VoiceCultures)
+			{
+				if (Entry.Sound.IsNull())
+					continue;
+
+				FSoftObjectPath SoundPath = Entry.Sound.ToSoftObjectPath();
+				if (const FSSVoiceCultureBankCulture* BankCulture = bInBank ? Bank->FindCulture(Entry.Culture) : nullptr)
+				{
+					SoundPath = BankCulture->Chunk.ToSoftObjectPath();
+				}
+				AddCultureSound(Entry.Culture, SoundPath);
+			}
+
+			// Lines migrated to a table: their row in each culture column
+			const USSVoiceCultureTable* Table = VoiceSound->VoiceCultures.Num() == 0 ? VoiceSound->Table.LoadSynchronous() : nullptr;
+			const FName LineId = VoiceSound->TableLineId.IsNone() ? VoiceSound->GetFName() : VoiceSound->TableLineId;
+			const int32 LineIndex = Table ? Table->FindLineIndex(LineId) : INDEX_NONE;
+			if (LineIndex != INDEX_NONE)
+			{
+				for (const FSSVoiceCultureTableCulture& TableCulture : Table->Cultures)
+				{
+					const USSVoiceCultureTableColumn* Column = TableCulture.Column.LoadSynchronous();
+					if (Column && Column->Sounds.IsValidIndex(LineIndex) && !Column->Sounds[LineIndex].IsNull())
+					{
+						AddCultureSound(TableCulture.Culture.ToString(), Column->Sounds[LineIndex].ToSoftObjectPath());
+					}
+				}
+			}
+		}
+		OutStats.AssetsModified = CultureSoundsByVoicePackage.Num();
+
+		// 4. Level entry, sounds grouped per culture
+		FSSVoiceCultureManifestLevel& Level = Manifest.Levels.AddDefaulted_GetRef();
+		Level.PackageName = MapPair.Key;
+		Level.NumVoiceSounds = MapPair.Value.Num();
+
+		for (const FName& VoicePackage : MapPair.Value)
+		{
+			for (const TPair<FString, int32>& CultureSound : CultureSoundsByVoicePackage[VoicePackage])
+			{
+				FSSVoiceCultureManifestCulture* Culture = Level.Cultures.FindByPredicate(
+					[&CultureSound](const FSSVoiceCultureManifestCulture& C) { return C.Culture == CultureSound.Key; });
+				if (!Culture)
+				{
+					Culture = &Level.Cultures.AddDefaulted_GetRef();
+					Culture->Culture = CultureSound.Key;
+				}
+				Culture->SoundIndices.AddUnique(CultureSound.Value);
+			}
+		}
+	}
+
+	Manifest.SortLevels();
+
+	OutStats.ApplySeconds = FPlatformTime::Seconds() - ApplyStart;
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display,
+	       TEXT("[SSVoiceCulture] Level manifest: %d map(s) scanned, %d with voice, %d voice asset(s), %d culture sound(s)"),
+	       OutStats.AssetsScanned, OutStats.AssetsMatched, OutStats.AssetsModified, Manifest.Sounds.Num());
+}
+
+USSVoiceCultureLevelManifest* FSSVoiceCultureUtils::GenerateLevelManifest(const FString& ManifestObjectPath,
+                                                                         const TArray<FString>& MapPackages, bool bSave,
+                                                                         FSSVoiceCultureOperationStats& OutStats)
+{
+	const FSoftObjectPath ManifestPath(ManifestObjectPath);
+	const FString PackageName = ManifestPath.GetLongPackageName();
+	if (ManifestPath.IsNull() || !FPackageName::IsValidLongPackageName(PackageName))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Invalid level manifest path '%s'"), *ManifestObjectPath);
+		return nullptr;
+	}
+
+	// Reuse the existing asset so references to it stay valid
+	USSVoiceCultureLevelManifest* Manifest = Cast<USSVoiceCultureLevelManifest>(ManifestPath.TryLoad());
+	if (!Manifest)
+	{
+		UPackage* Package = CreatePackage(*PackageName);
+		Manifest = NewObject<USSVoiceCultureLevelManifest>(Package, *ManifestPath.GetAssetName(), RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(Manifest);
+	}
+
+	BuildLevelManifest(MapPackages, *Manifest, OutStats);
+	Manifest->MarkPackageDirty();
+
+	if (bSave)
+	{
+		const double SaveStart = FPlatformTime::Seconds();
+
+		FString PackageFilename;
+		if (FPackageName::TryConvertLongPackageNameToFilename(PackageName, PackageFilename,
+		                                                      FPackageName::GetAssetPackageExtension()) &&
+			SaveAsset(Manifest->GetOutermost(), PackageFilename))
+		{
+			OutStats.PackagesSaved = 1;
+		}
+		OutStats.SaveSeconds = FPlatformTime::Seconds() - SaveStart;
+	}
+
+	return Manifest;
+}
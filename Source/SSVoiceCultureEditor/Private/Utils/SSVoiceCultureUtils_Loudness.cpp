@@ -0,0 +1,825 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "Audio.h"
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Settings/SSVoiceCultureEditorSettings.h"
+#include "Sound/SoundWave.h"
+
+DECLARE_CYCLE_STAT(TEXT("Analyze Loudness"), STAT_VoiceCulture_AnalyzeLoudness, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Trim Silence"), STAT_VoiceCulture_TrimSilence, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** Floor of the measured loudness and peak, also the BS.1770 absolute gate */
+	constexpr float MinLoudness = -70.f;
+	constexpr float MinPeakDb = -100.f;
+
+	/** Silence shorter than this (per side, past the padding) is not worth a re-import */
+	constexpr float MinTrimSeconds = 0.01f;
+
+	/** 16-bit PCM samples of an imported wave file, pointing into its payload */
+	struct FWaveView
+	{
+		const int16* Samples = nullptr;
+		int32 NumSamples = 0;
+		int32 NumChannels = 0;
+		int32 SampleRate = 0;
+
+		int32 GetNumFrames() const { return NumSamples / NumChannels; }
+	};
+
+	bool ReadWaveView(const FSharedBuffer& Payload, FWaveView& OutView)
+	{
+		if (Payload.GetSize() == 0)
+			return false;
+
+		FWaveModInfo WaveInfo;
+		if (!WaveInfo.ReadWaveInfo(static_cast<const uint8*>(Payload.GetData()), static_cast<int32>(Payload.GetSize())))
+			return false;
+
+		// Imported voice lines are 16-bit PCM, other encodings are not measured
+		if (*WaveInfo.pFormatTag != 1 || *WaveInfo.pBitsPerSample != 16 || *WaveInfo.pChannels == 0 ||
+			*WaveInfo.pSamplesPerSec == 0)
+			return false;
+
+		OutView.Samples = reinterpret_cast<const int16*>(WaveInfo.SampleDataStart);
+		OutView.NumChannels = *WaveInfo.pChannels;
+		OutView.SampleRate = static_cast<int32>(*WaveInfo.pSamplesPerSec);
+		OutView.NumSamples = WaveInfo.SampleDataSize / sizeof(int16) / OutView.NumChannels * OutView.NumChannels;
+		return OutView.NumSamples > 0;
+	}
+
+	void DecodeSamples(const FWaveView& View, TArray<float>& OutSamples)
+	{
+		OutSamples.SetNumUninitialized(View.NumSamples);
+		for (int32 i = 0; i < View.NumSamples; ++i)
+		{
+			OutSamples[i] = View.Samples[i] * (1.f / 32768.f);
+		}
+	}
+
+	// ------------------------
+	// Vector kernels, 4 samples per iteration
+	// ------------------------
+
+	float HorizontalMax(const VectorRegister4Float& Vector)
+	{
+		float Lanes[4];
+		VectorStore(Vector, Lanes);
+		return FMath::Max(FMath::Max(Lanes[0], Lanes[1]), FMath::Max(Lanes[2], Lanes[3]));
+	}
+
+	float PeakAbs(const float* Samples, int32 Num)
+	{
+		VectorRegister4Float Peak = VectorZeroFloat();
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			Peak = VectorMax(Peak, VectorAbs(VectorLoad(Samples + i)));
+		}
+
+		float Result = HorizontalMax(Peak);
+		for (; i < Num; ++i)
+		{
+			Result = FMath::Max(Result, FMath::Abs(Samples[i]));
+		}
+		return Result;
+	}
+
+	double SumOfSquares(const float* Samples, int32 Num)
+	{
+		VectorRegister4Float Sum = VectorZeroFloat();
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			const VectorRegister4Float Value = VectorLoad(Samples + i);
+			Sum = VectorMultiplyAdd(Value, Value, Sum);
+		}
+
+		float Lanes[4];
+		VectorStore(Sum, Lanes);
+		double Result = static_cast<double>(Lanes[0]) + Lanes[1] + Lanes[2] + Lanes[3];
+		for (; i < Num; ++i)
+		{
+			Result += Samples[i] * Samples[i];
+		}
+		return Result;
+	}
+
+	/** Index of the first sample louder than Threshold, INDEX_NONE if none */
+	int32 FindFirstAbove(const float* Samples, int32 Num, float Threshold)
+	{
+		const VectorRegister4Float Limit = VectorSetFloat1(Threshold);
+		int32 i = 0;
+		for (; i + 4 <= Num; i += 4)
+		{
+			if (VectorAnyGreaterThan(VectorAbs(VectorLoad(Samples + i)), Limit))
+				break;
+		}
+
+		for (; i < Num; ++i)
+		{
+			if (FMath::Abs(Samples[i]) > Threshold)
+				return i;
+		}
+		return INDEX_NONE;
+	}
+
+	/** Index of the last sample louder than Threshold, INDEX_NONE if none */
+	int32 FindLastAbove(const float* Samples, int32 Num, float Threshold)
+	{
+		const VectorRegister4Float Limit = VectorSetFloat1(Threshold);
+		int32 End = Num;
+		for (; End >= 4; End -= 4)
+		{
+			if (VectorAnyGreaterThan(VectorAbs(VectorLoad(Samples + End - 4)), Limit))
+				break;
+		}
+
+		for (int32 i = End - 1; i >= 0; --i)
+		{
+			if (FMath::Abs(Samples[i]) > Threshold)
+				return i;
+		}
+		return INDEX_NONE;
+	}
+
+	// ------------------------
+	// Loudness (ITU-R BS.1770)
+	// ------------------------
+
+	/** Transposed direct form II biquad */
+	struct FBiquad
+	{
+		float B0 = 1.f, B1 = 0.f, B2 = 0.f, A1 = 0.f, A2 = 0.f;
+		float Z1 = 0.f, Z2 = 0.f;
+
+		float Process(float X)
+		{
+			const float Y = B0 * X + Z1;
+			Z1 = B1 * X - A1 * Y + Z2;
+			Z2 = B2 * X - A2 * Y;
+			return Y;
+		}
+	};
+
+	/** K-weighting first stage (head shelf), coefficients derived for any sample rate */
+	FBiquad MakeShelfFilter(int32 SampleRate)
+	{
+		const double K = FMath::Tan(PI * 1681.974450955533 / SampleRate);
+		const double Q = 0.7071752369554196;
+		const double Vh = FMath::Pow(10.0, 3.999843853973347 / 20.0);
+		const double Vb = FMath::Pow(Vh, 0.4996667741545416);
+		const double A0 = 1.0 + K / Q + K * K;
+
+		FBiquad Filter;
+		Filter.B0 = static_cast<float>((Vh + Vb * K / Q + K * K) / A0);
+		Filter.B1 = static_cast<float>(2.0 * (K * K - Vh) / A0);
+		Filter.B2 = static_cast<float>((Vh - Vb * K / Q + K * K) / A0);
+		Filter.A1 = static_cast<float>(2.0 * (K * K - 1.0) / A0);
+		Filter.A2 = static_cast<float>((1.0 - K / Q + K * K) / A0);
+		return Filter;
+	}
+
+	/** K-weighting second stage (RLB high pass) */
+	FBiquad MakeHighPassFilter(int32 SampleRate)
+	{
+		const double K = FMath::Tan(PI * 38.13547087602444 / SampleRate);
+		const double Q = 0.5003270373238773;
+		const double A0 = 1.0 + K / Q + K * K;
+
+		FBiquad Filter;
+		Filter.B0 = 1.f;
+		Filter.B1 = -2.f;
+		Filter.B2 = 1.f;
+		Filter.A1 = static_cast<float>(2.0 * (K * K - 1.0) / A0);
+		Filter.A2 = static_cast<float>((1.0 - K / Q + K * K) / A0);
+		return Filter;
+	}
+
+	float EnergyToLoudness(double Energy)
+	{
+		return Energy > 0.0 ? static_cast<float>(-0.691 + 10.0 * FMath::LogX(10.0, Energy)) : MinLoudness;
+	}
+
+	/**
+	 * Gated integrated loudness: 400 ms blocks with 75% overlap, absolute gate at -70 LUFS, relative gate 10 LU
+	 * under the absolute-gated mean. Sounds shorter than one block are measured as a single block.
+	 * The filters are recursive so they run per sample; block energies use the vector kernel.
+	 */
+	float MeasureIntegratedLoudness(const TArray<float>& Samples, int32 NumChannels, int32 SampleRate)
+	{
+		const int32 NumFrames = Samples.Num() / NumChannels;
+		const int32 StepFrames = FMath::Max(1, SampleRate / 10);
+		const int32 NumSteps = NumFrames / StepFrames;
+
+		// Energy of each 100 ms step, summed over channels (voice channels all have a weight of 1)
+		TArray<double> StepEnergy;
+		StepEnergy.SetNumZeroed(NumSteps);
+		double TotalEnergy = 0.0;
+
+		TArray<float> Filtered;
+		Filtered.SetNumUninitialized(NumFrames);
+		for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+		{
+			FBiquad Shelf = MakeShelfFilter(SampleRate);
+			FBiquad HighPass = MakeHighPassFilter(SampleRate);
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				Filtered[Frame] = HighPass.Process(Shelf.Process(Samples[Frame * NumChannels + Channel]));
+			}
+
+			for (int32 Step = 0; Step < NumSteps; ++Step)
+			{
+				StepEnergy[Step] += SumOfSquares(Filtered.GetData() + Step * StepFrames, StepFrames);
+			}
+			TotalEnergy += SumOfSquares(Filtered.GetData(), NumFrames);
+		}
+
+		TArray<double> Blocks;
+		if (NumSteps < 4)
+		{
+			Blocks.Add(NumFrames > 0 ? TotalEnergy / NumFrames : 0.0);
+		}
+		else
+		{
+			Blocks.Reserve(NumSteps - 3);
+			for (int32 Step = 0; Step + 4 <= NumSteps; ++Step)
+			{
+				Blocks.Add((StepEnergy[Step] + StepEnergy[Step + 1] + StepEnergy[Step + 2] + StepEnergy[Step + 3]) /
+					(4.0 * StepFrames));
+			}
+		}
+
+		auto GatedMean = [&Blocks](double Gate, double& OutMean)
+		{
+			double Sum = 0.0;
+			int32 Count = 0;
+			for (const double Block : Blocks)
+			{
+				if (Block > Gate)
+				{
+					Sum += Block;
+					Count++;
+				}
+			}
+			OutMean = Count > 0 ? Sum / Count : 0.0;
+			return Count > 0;
+		};
+
+		const double AbsoluteGate = FMath::Pow(10.0, (MinLoudness + 0.691) / 10.0);
+		double Mean = 0.0;
+		if (!GatedMean(AbsoluteGate, Mean))
+			return MinLoudness;
+
+		// -10 LU relative gate
+		const double RelativeGate = FMath::Max(AbsoluteGate, Mean * 0.1);
+		if (!GatedMean(RelativeGate, Mean))
+			return MinLoudness;
+
+		return FMath::Max(MinLoudness, EnergyToLoudness(Mean));
+	}
+
+	/** Loudness, peak and silence of one culture sound. Worker-safe. */
+	bool AnalyzePayload(const FSharedBuffer& Payload, float SilenceThreshold, FSSCultureSoundAnalysis& OutAnalysis)
+	{
+		FWaveView View;
+		if (!ReadWaveView(Payload, View))
+			return false;
+
+		TArray<float> Samples;
+		DecodeSamples(View, Samples);
+
+		const int32 NumFrames = View.GetNumFrames();
+		OutAnalysis.Duration = static_cast<float>(NumFrames) / View.SampleRate;
+
+		const float Peak = PeakAbs(Samples.GetData(), Samples.Num());
+		OutAnalysis.PeakDb = Peak > 0.f ? FMath::Max(MinPeakDb, 20.f * FMath::LogX(10.f, Peak)) : MinPeakDb;
+		OutAnalysis.IntegratedLoudness = MeasureIntegratedLoudness(Samples, View.NumChannels, View.SampleRate);
+
+		const int32 First = FindFirstAbove(Samples.GetData(), Samples.Num(), SilenceThreshold);
+		if (First == INDEX_NONE)
+		{
+			// Silent sound, nothing to trim
+			OutAnalysis.LeadingSilence = OutAnalysis.Duration;
+			OutAnalysis.TrailingSilence = 0.f;
+			return true;
+		}
+
+		const int32 Last = FindLastAbove(Samples.GetData(), Samples.Num(), SilenceThreshold);
+		OutAnalysis.LeadingSilence = static_cast<float>(First / View.NumChannels) / View.SampleRate;
+		OutAnalysis.TrailingSilence = static_cast<float>(NumFrames - 1 - Last / View.NumChannels) / View.SampleRate;
+		return true;
+	}
+
+	/** Silence removed by trimming with the given padding, 0 for a silent sound */
+	float GetTrimmableSeconds(const FSSCultureSoundAnalysis& Analysis, float Padding)
+	{
+		if (Analysis.LeadingSilence >= Analysis.Duration)
+			return 0.f;
+
+		float Seconds = 0.f;
+		for (const float Silence : {Analysis.LeadingSilence, Analysis.TrailingSilence})
+		{
+			if (Silence - Padding > MinTrimSeconds)
+			{
+				Seconds += Silence - Padding;
+			}
+		}
+		return Seconds;
+	}
+
+	float GetSilenceThreshold()
+	{
+		return FMath::Pow(10.f, USSVoiceCultureEditorSettings::GetSetting()->SilenceThresholdDb / 20.f);
+	}
+
+	/** Culture sound wave of a voice asset entry, invalid for empty entries and non-wave sounds (cues) */
+	FAssetData GetCultureWave(IAssetRegistry& AssetRegistry, const FSSCultureAudioEntry& Entry)
+	{
+		if (Entry.Sound.IsNull())
+			return FAssetData();
+
+		FAssetData Wave = AssetRegistry.GetAssetByObjectPath(Entry.Sound.ToSoftObjectPath());
+		return Wave.IsValid() && Wave.IsInstanceOf(USoundWave::StaticClass()) ? Wave : FAssetData();
+	}
+
+	/** Payload requests must be made on the game thread, the data is read on workers */
+	TArray<TFuture<FSharedBuffer>> RequestPayloads(const TArray<FAssetData>& Waves)
+	{
+		TArray<TFuture<FSharedBuffer>> Payloads;
+		Payloads.Reserve(Waves.Num());
+		for (const FAssetData& WaveAsset : Waves)
+		{
+			const USoundWave* Wave = Cast<USoundWave>(WaveAsset.FastGetAsset(false));
+			Payloads.Add(Wave ? Wave->RawData.GetPayload() : MakeFulfilledPromise<FSharedBuffer>().GetFuture());
+		}
+		return Payloads;
+	}
+}
+
+int32 FSSVoiceCultureUtils::AnalyzeCultureLoudnessBatch(TConstArrayView<FAssetData> VoiceAssets,
+                                                        TSet<UPackage*>& OutModifiedPackages)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_AnalyzeLoudness, "VoiceCulture::AnalyzeCultureLoudness");
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+	LoadAssetsParallel(VoiceAssets);
+
+	// One item per culture sound wave
+	struct FItem
+	{
+		USSVoiceCultureSound* VoiceSound = nullptr;
+		FString Culture;
+	};
+	TArray<FItem> Items;
+	TArray<FAssetData> Waves;
+
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false));
+		if (!VoiceSound)
+			continue;
+
+		for (const FSSCultureAudioEntry& Entry : VoiceSound->VoiceCultures)
+		{
+			const FAssetData Wave = GetCultureWave(AssetRegistry, Entry);
+			if (!Wave.IsValid())
+				continue;
+
+			Items.Add({VoiceSound, Entry.Culture.ToLower()});
+			Waves.Add(Wave);
+		}
+	}
+
+	LoadAssetsParallel(Waves);
+	TArray<TFuture<FSharedBuffer>> Payloads = RequestPayloads(Waves);
+
+	TArray<FSSCultureSoundAnalysis> Results;
+	Results.SetNum(Items.Num());
+	TArray<bool> Analyzed;
+	Analyzed.SetNumZeroed(Items.Num());
+
+	const float SilenceThreshold = GetSilenceThreshold();
+	ParallelFor(Items.Num(), [&](int32 i)
+	{
+		Analyzed[i] = AnalyzePayload(Payloads[i].Get(), SilenceThreshold, Results[i]);
+	});
+
+	// Results replace the previous analysis of each voice asset of the batch
+	TMap<USSVoiceCultureSound*, TArray<FSSCultureSoundAnalysis>> AnalysisBySound;
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		if (USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false)))
+		{
+			AnalysisBySound.Add(VoiceSound);
+		}
+	}
+
+	int32 NumAnalyzed = 0;
+	for (int32 i = 0; i < Items.Num(); ++i)
+	{
+		if (!Analyzed[i])
+		{
+			UE_LOG(LogVoiceCultureEditor, Verbose, TEXT("[SSVoiceCulture] %s is not 16-bit PCM, not analyzed"),
+			       *Waves[i].GetObjectPathString());
+			continue;
+		}
+
+		Results[i].Culture = Items[i].Culture;
+		AnalysisBySound.FindChecked(Items[i].VoiceSound).Add(Results[i]);
+		NumAnalyzed++;
+	}
+
+	for (TPair<USSVoiceCultureSound*, TArray<FSSCultureSoundAnalysis>>& Pair : AnalysisBySound)
+	{
+		if (Pair.Value.Num() == 0 && Pair.Key->CultureAnalysis.Num() == 0)
+			continue;
+
+		Pair.Key->Modify();
+		Pair.Key->CultureAnalysis = MoveTemp(Pair.Value);
+		Pair.Key->MarkPackageDirty();
+		OutModifiedPackages.Add(Pair.Key->GetOutermost());
+	}
+
+	return NumAnalyzed;
+}
+
+void FSSVoiceCultureUtils::AnalyzeCultureLoudness(const TArray<FAssetData>& VoiceAssets,
+                                                  const FSSVoiceCultureBatchOptions& Options,
+                                                  FSSVoiceCultureOperationStats& OutStats)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats.Operation = TEXT("Loudness");
+	OutStats.AssetsScanned += VoiceAssets.Num();
+
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+	double SaveSeconds = 0.0;
+
+	FScopedSlowTask SlowTask(VoiceAssets.Num(), NSLOCTEXT("SSVoiceCultureEditor", "AnalyzingLoudness",
+	                                                      "Analyzing culture sound loudness..."), Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	for (int32 BatchStart = 0; BatchStart < VoiceAssets.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(VoiceAssets).Slice(
+			BatchStart, FMath::Min(BatchSize, VoiceAssets.Num() - BatchStart));
+		SlowTask.EnterProgressFrame(Batch.Num());
+
+		TSet<UPackage*> ModifiedPackages;
+		OutStats.AssetsMatched += AnalyzeCultureLoudnessBatch(Batch, ModifiedPackages);
+		OutStats.AssetsModified += ModifiedPackages.Num();
+
+		if (Options.bForceSave)
+		{
+			const double SaveStart = FPlatformTime::Seconds();
+			OutStats.PackagesSaved += SavePackages(ModifiedPackages);
+			SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	OutStats.SaveSeconds += SaveSeconds;
+	OutStats.ApplySeconds += FPlatformTime::Seconds() - StartTime - SaveSeconds;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d culture sound(s) analyzed in %d voice asset(s)"),
+	       OutStats.AssetsMatched, OutStats.AssetsModified);
+}
+
+TArray<FSSCultureSoundAnalysis> FSSVoiceCultureUtils::GetTaggedAnalysis(const FAssetData& VoiceAsset)
+{
+	// Loaded voice assets may hold an analysis that is not saved (and tagged) yet
+	if (const USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false)))
+		return VoiceSound->CultureAnalysis;
+
+	TArray<FSSCultureSoundAnalysis> Analyses;
+
+	// "VoiceLoudness" tag: "en=-23.1/-1.2/0.100/0.350/2.500;fr=..."
+	const FAssetTagValueRef Tag = VoiceAsset.TagsAndValues.FindTag("VoiceLoudness");
+	if (!Tag.IsSet())
+		return Analyses;
+
+	TArray<FString> Entries;
+	Tag.GetValue().ParseIntoArray(Entries, TEXT(";"));
+	for (const FString& Entry : Entries)
+	{
+		FString Culture;
+		FString Values;
+		if (!Entry.Split(TEXT("="), &Culture, &Values))
+			continue;
+
+		TArray<FString> Fields;
+		if (Values.ParseIntoArray(Fields, TEXT("/")) != 5)
+			continue;
+
+		FSSCultureSoundAnalysis& Analysis = Analyses.AddDefaulted_GetRef();
+		Analysis.Culture = Culture;
+		Analysis.IntegratedLoudness = FCString::Atof(*Fields[0]);
+		Analysis.PeakDb = FCString::Atof(*Fields[1]);
+		Analysis.LeadingSilence = FCString::Atof(*Fields[2]);
+		Analysis.TrailingSilence = FCString::Atof(*Fields[3]);
+		Analysis.Duration = FCString::Atof(*Fields[4]);
+	}
+	return Analyses;
+}
+
+void FSSVoiceCultureUtils::BuildLoudnessReport(const TArray<FAssetData>& VoiceAssets,
+                                               FSSVoiceCultureLoudnessReport& OutReport)
+{
+	const auto* EditorSettings = USSVoiceCultureEditorSettings::GetSetting();
+	OutReport.ReferenceCulture = EditorSettings->ReferenceCulture.ToLower();
+	OutReport.ToleranceLU = EditorSettings->LoudnessToleranceLU;
+
+	TMap<FString, FSSVoiceCultureLoudnessCulture> Cultures;
+	TMap<FString, TPair<double, int32>> DeviationSums;
+
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		const TArray<FSSCultureSoundAnalysis> Analyses = GetTaggedAnalysis(VoiceAsset);
+		const FSSCultureSoundAnalysis* Reference = Analyses.FindByPredicate(
+			[&OutReport](const FSSCultureSoundAnalysis& Analysis)
+			{
+				return Analysis.Culture == OutReport.ReferenceCulture;
+			});
+
+		bool bTrimmable = false;
+		for (const FSSCultureSoundAnalysis& Analysis : Analyses)
+		{
+			FSSVoiceCultureLoudnessCulture& Culture = Cultures.FindOrAdd(Analysis.Culture);
+			Culture.Culture = Analysis.Culture;
+			Culture.Analyzed++;
+
+			const float TrimmableSeconds = GetTrimmableSeconds(Analysis, EditorSettings->TrimPaddingSeconds);
+			Culture.TrimmableSeconds += TrimmableSeconds;
+			bTrimmable |= TrimmableSeconds > 0.f;
+
+			if (!Reference || &Analysis == Reference)
+				continue;
+
+			const float Deviation = Analysis.IntegratedLoudness - Reference->IntegratedLoudness;
+			TPair<double, int32>& Sum = DeviationSums.FindOrAdd(Analysis.Culture);
+			Sum.Key += Deviation;
+			Sum.Value++;
+
+			if (FMath::Abs(Deviation) > OutReport.ToleranceLU)
+			{
+				Culture.Deviating++;
+
+				FSSVoiceCultureLoudnessFlag& Flag = OutReport.Flagged.AddDefaulted_GetRef();
+				Flag.Asset = VoiceAsset.GetObjectPathString();
+				Flag.Culture = Analysis.Culture;
+				Flag.Deviation = Deviation;
+			}
+		}
+
+		if (bTrimmable)
+		{
+			OutReport.Trimmable.Add(VoiceAsset.GetObjectPathString());
+		}
+	}
+
+	for (TPair<FString, FSSVoiceCultureLoudnessCulture>& Pair : Cultures)
+	{
+		if (const TPair<double, int32>* Sum = DeviationSums.Find(Pair.Key))
+		{
+			Pair.Value.MeanDeviation = static_cast<float>(Sum->Key / Sum->Value);
+		}
+		OutReport.Cultures.Add(Pair.Value);
+	}
+
+	OutReport.Cultures.Sort([](const FSSVoiceCultureLoudnessCulture& A, const FSSVoiceCultureLoudnessCulture& B)
+	{
+		return A.Culture < B.Culture;
+	});
+	OutReport.Flagged.Sort([](const FSSVoiceCultureLoudnessFlag& A, const FSSVoiceCultureLoudnessFlag& B)
+	{
+		return FMath::Abs(A.Deviation) > FMath::Abs(B.Deviation);
+	});
+}
+
+int32 FSSVoiceCultureUtils::TrimCultureSilence(const TArray<FAssetData>& VoiceAssets,
+                                               const FSSVoiceCultureBatchOptions& Options,
+                                               FSSVoiceCultureOperationStats& OutStats)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_TrimSilence, "VoiceCulture::TrimCultureSilence");
+
+	const double StartTime = FPlatformTime::Seconds();
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	const float Padding = USSVoiceCultureEditorSettings::GetSetting()->TrimPaddingSeconds;
+	const float SilenceThreshold = GetSilenceThreshold();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	int32 TrimmedSounds = 0;
+	int64 RemovedBytes = 0;
+	double SaveSeconds = 0.0;
+
+	FScopedSlowTask SlowTask(VoiceAssets.Num(), NSLOCTEXT("SSVoiceCultureEditor", "TrimmingSilence",
+	                                                      "Trimming culture sound silence..."), Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	for (int32 BatchStart = 0; BatchStart < VoiceAssets.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(VoiceAssets).Slice(
+			BatchStart, FMath::Min(BatchSize, VoiceAssets.Num() - BatchStart));
+		SlowTask.EnterProgressFrame(Batch.Num());
+		LoadAssetsParallel(Batch);
+
+		// Culture sounds whose last analysis found silence to trim
+		struct FItem
+		{
+			USSVoiceCultureSound* VoiceSound = nullptr;
+			int32 AnalysisIndex = INDEX_NONE;
+
+			/** Trimmed wave file, empty if there is nothing to cut */
+			TArray<uint8> WaveFile;
+			int32 NumFrames = 0;
+			int32 SampleRate = 0;
+			FSSCultureSoundAnalysis Analysis;
+			bool bRead = false;
+		};
+		TArray<FItem> Items;
+		TArray<FAssetData> Waves;
+
+		for (const FAssetData& VoiceAsset : Batch)
+		{
+			USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAsset.FastGetAsset(false));
+			if (!VoiceSound)
+				continue;
+
+			for (int32 AnalysisIndex = 0; AnalysisIndex < VoiceSound->CultureAnalysis.Num(); ++AnalysisIndex)
+			{
+				const FSSCultureSoundAnalysis& Analysis = VoiceSound->CultureAnalysis[AnalysisIndex];
+				if (GetTrimmableSeconds(Analysis, Padding) <= 0.f)
+					continue;
+
+				const FSSCultureAudioEntry* Entry = VoiceSound->VoiceCultures.FindByPredicate(
+					[&Analysis](const FSSCultureAudioEntry& CultureEntry)
+					{
+						return CultureEntry.Culture.Equals(Analysis.Culture, ESearchCase::IgnoreCase);
+					});
+				const FAssetData Wave = Entry ? GetCultureWave(AssetRegistry, *Entry) : FAssetData();
+				if (!Wave.IsValid())
+					continue;
+
+				FItem& Item = Items.AddDefaulted_GetRef();
+				Item.VoiceSound = VoiceSound;
+				Item.AnalysisIndex = AnalysisIndex;
+				Item.Analysis = Analysis;
+				Waves.Add(Wave);
+			}
+		}
+
+		LoadAssetsParallel(Waves);
+		TArray<TFuture<FSharedBuffer>> Payloads = RequestPayloads(Waves);
+
+		// Silence scan and new wave file on workers
+		ParallelFor(Items.Num(), [&](int32 i)
+		{
+			FItem& Item = Items[i];
+			const FSharedBuffer Payload = Payloads[i].Get();
+
+			FWaveView View;
+			if (!ReadWaveView(Payload, View))
+				return;
+
+			TArray<float> Samples;
+			DecodeSamples(View, Samples);
+
+			const int32 First = FindFirstAbove(Samples.GetData(), Samples.Num(), SilenceThreshold);
+			if (First == INDEX_NONE)
+				return;
+			const int32 Last = FindLastAbove(Samples.GetData(), Samples.Num(), SilenceThreshold);
+
+			const int32 NumFrames = View.GetNumFrames();
+			const int32 PaddingFrames = FMath::RoundToInt(Padding * View.SampleRate);
+			const int32 StartFrame = FMath::Max(0, First / View.NumChannels - PaddingFrames);
+			const int32 EndFrame = FMath::Min(NumFrames, Last / View.NumChannels + 1 + PaddingFrames);
+
+			Item.bRead = true;
+			Item.SampleRate = View.SampleRate;
+			Item.NumFrames = EndFrame - StartFrame;
+			Item.Analysis.LeadingSilence = static_cast<float>(First / View.NumChannels - StartFrame) / View.SampleRate;
+			Item.Analysis.TrailingSilence = static_cast<float>(EndFrame - 1 - Last / View.NumChannels) / View.SampleRate;
+			Item.Analysis.Duration = static_cast<float>(Item.NumFrames) / View.SampleRate;
+
+			if (StartFrame == 0 && EndFrame == NumFrames)
+				return;
+
+			SerializeWaveFile(Item.WaveFile, reinterpret_cast<const uint8*>(View.Samples + StartFrame * View.NumChannels),
+			                  Item.NumFrames * View.NumChannels * sizeof(int16), View.NumChannels, View.SampleRate);
+		});
+		Payloads.Reset();
+
+		TSet<UPackage*> ModifiedPackages;
+		TSet<USoundWave*> TrimmedWaves;
+		for (int32 i = 0; i < Items.Num(); ++i)
+		{
+			FItem& Item = Items[i];
+			if (!Item.bRead)
+				continue;
+
+			// A wave shared by several lines is trimmed once, each line still gets its new analysis
+			USoundWave* Wave = Cast<USoundWave>(Waves[i].FastGetAsset(false));
+			if (Item.WaveFile.Num() > 0 && Wave && !TrimmedWaves.Contains(Wave))
+			{
+				RemovedBytes += Wave->RawData.GetPayloadSize() - Item.WaveFile.Num();
+
+				Wave->Modify();
+				Wave->RawData.UpdatePayload(FSharedBuffer::Clone(Item.WaveFile.GetData(), Item.WaveFile.Num()));
+				Wave->Duration = Item.Analysis.Duration;
+				Wave->TotalSamples = static_cast<float>(Item.NumFrames);
+				Wave->InvalidateCompressedData(true);
+				Wave->PostEditChange();
+				Wave->MarkPackageDirty();
+
+				TrimmedWaves.Add(Wave);
+				ModifiedPackages.Add(Wave->GetOutermost());
+				TrimmedSounds++;
+			}
+
+			Item.VoiceSound->Modify();
+			Item.VoiceSound->CultureAnalysis[Item.AnalysisIndex] = Item.Analysis;
+			Item.VoiceSound->MarkPackageDirty();
+			ModifiedPackages.Add(Item.VoiceSound->GetOutermost());
+		}
+		OutStats.AssetsModified += ModifiedPackages.Num();
+
+		if (Options.bForceSave)
+		{
+			const double SaveStart = FPlatformTime::Seconds();
+			OutStats.PackagesSaved += SavePackages(ModifiedPackages);
+			SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	OutStats.AssetsMatched += TrimmedSounds;
+	OutStats.SaveSeconds += SaveSeconds;
+	OutStats.ApplySeconds += FPlatformTime::Seconds() - StartTime - SaveSeconds;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d culture sound(s) trimmed, %.1f MB of source audio removed"),
+	       TrimmedSounds, RemovedBytes / (1024.0 * 1024.0));
+
+	return TrimmedSounds;
+}
+
+bool FSSVoiceCultureUtils::SaveLoudnessReport(const FSSVoiceCultureLoudnessReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/LoudnessReport.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Loudness report written to %s"), *ReportPath);
+	return true;
+}
+
+bool FSSVoiceCultureUtils::LoadSavedLoudnessReport(FSSVoiceCultureLoudnessReport& OutReport)
+{
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/LoudnessReport.json");
+
+	FString Json;
+	if (!FFileHelper::LoadFileToString(Json, *Path))
+		return false;
+
+	return FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutReport);
+}
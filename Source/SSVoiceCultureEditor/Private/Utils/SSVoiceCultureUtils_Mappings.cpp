@@ -0,0 +1,784 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureSound.h"
+#include "SSVoiceCultureStats.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+
+DECLARE_CYCLE_STAT(TEXT("Export Mappings"), STAT_VoiceCulture_ExportMappings, STATGROUP_VoiceCulture);
+DECLARE_CYCLE_STAT(TEXT("Import Mappings"), STAT_VoiceCulture_ImportMappings, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** Errors kept in the import report, the rest are only counted */
+	constexpr int32 MaxReportedErrors = 1000;
+
+	bool IsJsonLinesFile(const FString& FilePath)
+	{
+		const FString Extension = FPaths::GetExtension(FilePath);
+		return Extension.Equals(TEXT("jsonl"), ESearchCase::IgnoreCase) || Extension.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	}
+
+	bool IsFixedColumn(const FString& Column)
+	{
+		return Column.Equals(TEXT("LineId"), ESearchCase::IgnoreCase) || Column.Equals(TEXT("Asset"), ESearchCase::IgnoreCase) ||
+			Column.Equals(TEXT("Actor"), ESearchCase::IgnoreCase) || Column.Equals(TEXT("Suffix"), ESearchCase::IgnoreCase);
+	}
+
+	FString EscapeCsv(const FString& Field)
+	{
+		int32 Index;
+		if (!Field.FindChar(TEXT(','), Index) && !Field.FindChar(TEXT('"'), Index) && !Field.FindChar(TEXT('\n'), Index))
+			return Field;
+
+		return TEXT("\"") + Field.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+	}
+
+	/**
+	 * Reads a UTF-8 file in fixed-size chunks, one record at a time. With bQuoteAware (CSV) a line break inside a quoted
+	 * field does not end the record, EscapeCsv quotes fields containing '\n'. Only the current chunk and record are held.
+	 */
+	class FRecordReader
+	{
+	public:
+		static constexpr int32 ChunkSize = 64 * 1024;
+
+		FRecordReader(FArchive& InReader, bool bInQuoteAware)
+			: Reader(InReader)
+			, bQuoteAware(bInQuoteAware)
+		{
+		}
+
+		/** Next record without its line break, false at the end of the file. OutNumLines is the number of lines it spans. */
+		bool Next(FString& OutRecord, int32& OutNumLines)
+		{
+			RecordBytes.Reset();
+			OutNumLines = 1;
+			bool bQuoted = false;
+			bool bAnyByte = false;
+
+			while (BufferPos < Buffer.Num() || Fill())
+			{
+				const ANSICHAR Char = Buffer[BufferPos++];
+				bAnyByte = true;
+
+				// '"' and '\n' never appear inside a UTF-8 multi-byte sequence, bytes can be scanned as is
+				if (bQuoteAware && Char == '"')
+				{
+					bQuoted = !bQuoted;
+				}
+				else if (Char == '\n')
+				{
+					if (!bQuoted)
+						break;
+					++OutNumLines;
+				}
+				RecordBytes.Add(Char);
+			}
+
+			if (!bAnyByte)
+				return false;
+
+			// Byte order mark of the first record
+			int32 Start = 0;
+			if (bAtStart && RecordBytes.Num() >= 3 && static_cast<uint8>(RecordBytes[0]) == 0xEF &&
+				static_cast<uint8>(RecordBytes[1]) == 0xBB && static_cast<uint8>(RecordBytes[2]) == 0xBF)
+			{
+				Start = 3;
+			}
+			bAtStart = false;
+
+			const FUTF8ToTCHAR Converted(RecordBytes.GetData() + Start, RecordBytes.Num() - Start);
+			OutRecord = FString(Converted.Length(), Converted.Get());
+			return true;
+		}
+
+		/** Bytes consumed so far, for progress */
+		int64 GetBytesRead() const { return Reader.Tell() - (Buffer.Num() - BufferPos); }
+
+	private:
+		bool Fill()
+		{
+			const int64 Remaining = Reader.TotalSize() - Reader.Tell();
+			if (Remaining <= 0 || Reader.IsError())
+				return false;
+
+			Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(ChunkSize, Remaining)));
+			Reader.Serialize(Buffer.GetData(), Buffer.Num());
+			BufferPos = 0;
+			return !Reader.IsError();
+		}
+
+		FArchive& Reader;
+		bool bQuoteAware = false;
+		bool bAtStart = true;
+		TArray<ANSICHAR> Buffer;
+		int32 BufferPos = 0;
+		TArray<ANSICHAR> RecordBytes;
+	};
+
+	/** Splits one CSV record, quoted fields may contain ',', line breaks and doubled quotes */
+	void ParseCsvLine(FStringView Line, TArray<FString>& OutFields)
+	{
+		OutFields.Reset();
+		FString Field;
+		bool bQuoted = false;
+		for (int32 i = 0; i < Line.Len(); ++i)
+		{
+			const TCHAR Char = Line[i];
+			if (bQuoted)
+			{
+				if (Char != TEXT('"'))
+				{
+					Field.AppendChar(Char);
+				}
+				else if (i + 1 < Line.Len() && Line[i + 1] == TEXT('"'))
+				{
+					Field.AppendChar(Char);
+					++i;
+				}
+				else
+				{
+					bQuoted = false;
+				}
+			}
+			else if (Char == TEXT('"'))
+			{
+				bQuoted = true;
+			}
+			else if (Char == TEXT(','))
+			{
+				OutFields.Add(MoveTemp(Field));
+				Field.Reset();
+			}
+			else if (Char != TEXT('\r'))
+			{
+				Field.AppendChar(Char);
+			}
+		}
+		OutFields.Add(MoveTemp(Field));
+	}
+
+	void WriteLine(FArchive& Writer, const FString& Line)
+	{
+		const FTCHARToUTF8 Utf8(*Line);
+		Writer.Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+
+		ANSICHAR NewLine = '\n';
+		Writer.Serialize(&NewLine, 1);
+	}
+
+	/**
+	 * Culture (lowercase) -> sound path of a voice asset, from its "VoiceCultureSounds" tag. Assets saved before the tag
+	 * existed fall back to their soft dependencies whose name the strategy parses as a culture sound. Worker-safe.
+	 */
+	void GetCultureSounds(IAssetRegistry& AssetRegistry, const USSVoiceCultureStrategy* Strategy, const FAssetData& VoiceAsset,
+	                      TMap<FString, FString>& OutSounds)
+	{
+		if (FSSVoiceCultureUtils::GetTaggedCultureSounds(VoiceAsset, OutSounds))
+			return;
+
+		if (!Strategy)
+			return;
+
+		TArray<FName> Dependencies;
+		AssetRegistry.GetDependencies(VoiceAsset.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+		                              UE::AssetRegistry::EDependencyQuery::Soft);
+
+		TArray<FAssetData> PackageAssets;
+		FString Culture;
+		FString Suffix;
+		for (const FName& Dependency : Dependencies)
+		{
+			PackageAssets.Reset();
+			AssetRegistry.GetAssetsByPackageName(Dependency, PackageAssets, /*bIncludeOnlyOnDiskAssets*/ true);
+			for (const FAssetData& Asset : PackageAssets)
+			{
+				if (Strategy->ParseCultureSoundAsset(Asset, Culture, Suffix))
+				{
+					OutSounds.Add(Culture, Asset.GetObjectPathString());
+				}
+			}
+		}
+	}
+
+	/** One data row of a mapping file, validated on a worker */
+	struct FMappingRow
+	{
+		int32 LineNumber = 0;
+		FString Asset;
+		FString LineId;
+		TArray<TPair<FString, FString>> Sounds;
+
+		/** Filled by validation */
+		int32 VoiceAssetIndex = INDEX_NONE;
+		TArray<TPair<FString, FString>> ValidSounds;
+		TArray<FString> Errors;
+
+		/** Valid cells pointing at another sound than the registry has, the only rows worth loading */
+		int32 NumChanges = 0;
+	};
+}
+
+bool FSSVoiceCultureUtils::ExportVoiceCultureMappings(const FString& FilePath, const FSSVoiceCultureBatchOptions& Options,
+                                                      FSSVoiceCultureOperationStats& OutStats)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_ExportMappings, "VoiceCulture::ExportVoiceCultureMappings");
+
+	const double StartTime = FPlatformTime::Seconds();
+	OutStats.Operation = TEXT("ExportMappings");
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+	USSVoiceCultureStrategy* Strategy = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>()->GetActiveStrategy();
+
+	const TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+
+	// Columns: supported cultures plus any culture a voice asset is tagged with, so no mapping is dropped
+	TSet<FString> CultureSet;
+	for (const FString& Culture : USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures)
+	{
+		CultureSet.Add(Culture.ToLower());
+	}
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		CultureSet.Append(GetTaggedCultures(VoiceAsset));
+	}
+	TArray<FString> Cultures = CultureSet.Array();
+	Cultures.Sort();
+
+	OutStats.AssetsScanned = VoiceAssets.Num();
+	OutStats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer)
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to open %s for writing"), *FilePath);
+		return false;
+	}
+
+	const bool bJsonLines = IsJsonLinesFile(FilePath);
+	if (!bJsonLines)
+	{
+		FString Header = TEXT("LineId,Asset,Actor,Suffix");
+		for (const FString& Culture : Cultures)
+		{
+			Header += FString::Printf(TEXT(",%s,%s_status"), *EscapeCsv(Culture), *EscapeCsv(Culture));
+		}
+		WriteLine(*Writer, Header);
+	}
+
+	FScopedSlowTask SlowTask(VoiceAssets.Num(), NSLOCTEXT("SSVoiceCultureEditor", "ExportingMappings", "Exporting voice culture mappings..."),
+	                         Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+	TArray<FString> Actors;
+	TArray<FString> Lines;
+	TArray<int32> RowMatched;
+	bool bCancelled = false;
+
+	// Rows are formatted one batch at a time and written right away, memory does not grow with the project
+	for (int32 BatchStart = 0; BatchStart < VoiceAssets.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			bCancelled = true;
+			break;
+		}
+
+		const TConstArrayView<FAssetData> Batch = MakeArrayView(VoiceAssets).Slice(
+			BatchStart, FMath::Min(BatchSize, VoiceAssets.Num() - BatchStart));
+		SlowTask.EnterProgressFrame(Batch.Num());
+
+		// Actor extraction is a BlueprintNativeEvent, kept on the game thread
+		Actors.Reset();
+		for (const FAssetData& VoiceAsset : Batch)
+		{
+			FString& Actor = Actors.AddDefaulted_GetRef();
+			if (Strategy)
+			{
+				Strategy->ExecuteExtractActorNameFromAsset(VoiceAsset, Actor);
+			}
+		}
+
+		Lines.Reset();
+		Lines.SetNum(Batch.Num());
+		RowMatched.Reset();
+		RowMatched.SetNumZeroed(Batch.Num());
+
+		const int32 NumChunks = FMath::Clamp(Options.GetNumChunks(Batch.Num()), 1, Batch.Num());
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Batch.Num(), NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			TMap<FString, FString> Sounds;
+			const int32 Start = ChunkIndex * ChunkSize;
+			const int32 End = FMath::Min(Start + ChunkSize, Batch.Num());
+			for (int32 i = Start; i < End; ++i)
+			{
+				const FAssetData& VoiceAsset = Batch[i];
+				GetCultureSounds(AssetRegistry, Strategy, VoiceAsset, Sounds);
+				RowMatched[i] = Sounds.Num() > 0;
+
+				const FString LineId = VoiceAsset.AssetName.ToString();
+				const FString Suffix = Strategy ? Strategy->ExtractSuffixFromBaseName(LineId) : FString();
+
+				FString& Line = Lines[i];
+				TSharedPtr<FJsonObject> JsonCultures;
+				if (bJsonLines)
+				{
+					JsonCultures = MakeShared<FJsonObject>();
+				}
+				else
+				{
+					Line = FString::Printf(TEXT("%s,%s,%s,%s"), *EscapeCsv(LineId), *EscapeCsv(VoiceAsset.GetObjectPathString()),
+					                       *EscapeCsv(Actors[i]), *EscapeCsv(Suffix));
+				}
+
+				for (const FString& Culture : Cultures)
+				{
+					const FString* Sound = Sounds.Find(Culture);
+					const TCHAR* Status = TEXT("missing");
+					if (Sound)
+					{
+						// On-disk data only: looking up in-memory objects is not allowed on a worker thread
+						const bool bExists = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(*Sound), /*bIncludeOnlyOnDiskAssets*/ true).IsValid();
+						Status = bExists ? TEXT("ok") : TEXT("broken");
+					}
+
+					if (bJsonLines)
+					{
+						TSharedPtr<FJsonObject> JsonCulture = MakeShared<FJsonObject>();
+						JsonCulture->SetStringField(TEXT("Sound"), Sound ? *Sound : FString());
+						JsonCulture->SetStringField(TEXT("Status"), Status);
+						JsonCultures->SetObjectField(Culture, JsonCulture);
+					}
+					else
+					{
+						Line += TEXT(",");
+						Line += Sound ? EscapeCsv(*Sound) : FString();
+						Line += TEXT(",");
+						Line += Status;
+					}
+				}
+
+				if (bJsonLines)
+				{
+					TSharedRef<FJsonObject> JsonRow = MakeShared<FJsonObject>();
+					JsonRow->SetStringField(TEXT("LineId"), LineId);
+					JsonRow->SetStringField(TEXT("Asset"), VoiceAsset.GetObjectPathString());
+					JsonRow->SetStringField(TEXT("Actor"), Actors[i]);
+					JsonRow->SetStringField(TEXT("Suffix"), Suffix);
+					JsonRow->SetObjectField(TEXT("Cultures"), JsonCultures);
+
+					TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter =
+						TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Line);
+					FJsonSerializer::Serialize(JsonRow, JsonWriter);
+				}
+			}
+		}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		for (int32 i = 0; i < Lines.Num(); ++i)
+		{
+			WriteLine(*Writer, Lines[i]);
+			OutStats.AssetsMatched += RowMatched[i];
+		}
+	}
+
+	const bool bWritten = Writer->Close() && !Writer->IsError();
+	OutStats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	if (!bWritten)
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *FilePath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Mapping export %s: %d voice asset(s), %d culture column(s) written to %s (%.2fs)"),
+	       bCancelled ? TEXT("cancelled") : TEXT("done"), OutStats.AssetsScanned, Cultures.Num(), *FilePath, OutStats.TotalSeconds);
+
+	return !bCancelled;
+}
+
+bool FSSVoiceCultureUtils::ImportVoiceCultureMappings(const FString& FilePath, bool bApply, const FSSVoiceCultureBatchOptions& Options,
+                                                      FSSVoiceCultureMappingImportReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_ImportMappings, "VoiceCulture::ImportVoiceCultureMappings");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("ImportMappings");
+	OutReport.File = FilePath;
+	OutReport.bApplied = bApply;
+
+	if (!IFileManager::Get().FileExists(*FilePath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Mapping file not found: %s"), *FilePath);
+		return false;
+	}
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+	const USSVoiceCultureStrategy* Strategy = GEditor->GetEditorSubsystem<USSVoiceCultureEditorSubsystem>()->GetActiveStrategy();
+
+	// Lookups sized by the project, not by the file
+	const TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	TMap<FString, int32> VoiceAssetsByPath;
+	TMap<FName, int32> VoiceAssetsByName;
+	VoiceAssetsByPath.Reserve(VoiceAssets.Num());
+	VoiceAssetsByName.Reserve(VoiceAssets.Num());
+	for (int32 i = 0; i < VoiceAssets.Num(); ++i)
+	{
+		VoiceAssetsByPath.Add(VoiceAssets[i].GetObjectPathString(), i);
+		VoiceAssetsByName.Add(VoiceAssets[i].AssetName, i);
+	}
+
+	TSet<FTopLevelAssetPath> SoundClasses;
+	AssetRegistry.GetDerivedClassNames({USoundBase::StaticClass()->GetClassPathName()}, {}, SoundClasses);
+
+	TSet<FString> SupportedCultures;
+	for (const FString& Culture : USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures)
+	{
+		SupportedCultures.Add(Culture.ToLower());
+	}
+
+	Stats.AssetsScanned = VoiceAssets.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Progress in bytes read, the row count is unknown until the end of the file
+	FScopedSlowTask SlowTask(static_cast<float>(IFileManager::Get().FileSize(*FilePath)),
+	                         NSLOCTEXT("SSVoiceCultureEditor", "ImportingMappings", "Importing voice culture mappings..."),
+	                         Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	const bool bJsonLines = IsJsonLinesFile(FilePath);
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	TArray<FString> Columns;
+	TArray<FString> Fields;
+	TArray<FMappingRow> Rows;
+	Rows.Reserve(BatchSize);
+
+	double MatchSeconds = 0.0;
+	double ApplySeconds = 0.0;
+	double SaveSeconds = 0.0;
+	int32 LineNumber = 0;
+	bool bCancelled = false;
+	bool bHeaderError = false;
+
+	auto AddError = [&OutReport](int32 Line, const FString& Error)
+	{
+		if (OutReport.Errors.Num() < MaxReportedErrors)
+		{
+			OutReport.Errors.Add(FString::Printf(TEXT("line %d: %s"), Line, *Error));
+		}
+		OutReport.NumErrors++;
+	};
+
+	auto ProcessBatch = [&]()
+	{
+		if (Rows.Num() == 0)
+			return;
+
+		// 1. Validate against the registry in parallel, each row only writes to itself
+		const double MatchStart = FPlatformTime::Seconds();
+		const int32 NumChunks = FMath::Clamp(Options.GetNumChunks(Rows.Num()), 1, Rows.Num());
+		const int32 ChunkSize = FMath::DivideAndRoundUp(Rows.Num(), NumChunks);
+
+		ParallelFor(NumChunks, [&](int32 ChunkIndex)
+		{
+			TMap<FString, FString> CurrentSounds;
+			const int32 Start = ChunkIndex * ChunkSize;
+			const int32 End = FMath::Min(Start + ChunkSize, Rows.Num());
+			for (int32 i = Start; i < End; ++i)
+			{
+				FMappingRow& Row = Rows[i];
+
+				const int32* VoiceAssetIndex = !Row.Asset.IsEmpty() ? VoiceAssetsByPath.Find(Row.Asset)
+				                                                    : VoiceAssetsByName.Find(FName(*Row.LineId));
+				if (!VoiceAssetIndex)
+				{
+					Row.Errors.Add(FString::Printf(TEXT("unknown voice asset '%s'"), Row.Asset.IsEmpty() ? *Row.LineId : *Row.Asset));
+					continue;
+				}
+				Row.VoiceAssetIndex = *VoiceAssetIndex;
+				GetCultureSounds(AssetRegistry, Strategy, VoiceAssets[Row.VoiceAssetIndex], CurrentSounds);
+
+				for (TPair<FString, FString>& Sound : Row.Sounds)
+				{
+					if (!SupportedCultures.Contains(Sound.Key))
+					{
+						Row.Errors.Add(FString::Printf(TEXT("unsupported culture '%s'"), *Sound.Key));
+						continue;
+					}
+
+					// On-disk data only: looking up in-memory objects is not allowed on a worker thread
+					const FAssetData SoundAsset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Sound.Value), /*bIncludeOnlyOnDiskAssets*/ true);
+					if (!SoundAsset.IsValid() || !SoundClasses.Contains(SoundAsset.AssetClassPath))
+					{
+						Row.Errors.Add(FString::Printf(TEXT("'%s' is not a sound asset (%s)"), *Sound.Value, *Sound.Key));
+						continue;
+					}
+
+					const FString* CurrentSound = CurrentSounds.Find(Sound.Key);
+					if (!CurrentSound || FSoftObjectPath(*CurrentSound) != SoundAsset.GetSoftObjectPath())
+					{
+						Row.NumChanges++;
+					}
+					Row.ValidSounds.Add(MoveTemp(Sound));
+				}
+			}
+		}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		TArray<FAssetData> BatchAssets;
+		for (const FMappingRow& Row : Rows)
+		{
+			for (const FString& Error : Row.Errors)
+			{
+				AddError(Row.LineNumber, Error);
+			}
+			if (Row.Errors.Num() > 0)
+			{
+				OutReport.RowsInvalid++;
+			}
+			if (Row.NumChanges > 0)
+			{
+				BatchAssets.AddUnique(VoiceAssets[Row.VoiceAssetIndex]);
+				if (!bApply)
+				{
+					OutReport.EntriesChanged += Row.NumChanges;
+				}
+			}
+		}
+		Stats.AssetsMatched += BatchAssets.Num();
+		MatchSeconds += FPlatformTime::Seconds() - MatchStart;
+
+		// 2. Apply valid cells, one load of the batch
+		if (bApply && BatchAssets.Num() > 0)
+		{
+			const double ApplyStart = FPlatformTime::Seconds();
+			LoadAssetsParallel(BatchAssets);
+
+			TSet<UPackage*> ModifiedPackages;
+			for (const FMappingRow& Row : Rows)
+			{
+				if (Row.NumChanges == 0)
+					continue;
+
+				USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAssets[Row.VoiceAssetIndex].FastGetAsset(false));
+				if (!VoiceSound)
+				{
+					AddError(Row.LineNumber, FString::Printf(TEXT("failed to load '%s'"), *VoiceAssets[Row.VoiceAssetIndex].GetObjectPathString()));
+					continue;
+				}
+
+				bool bModified = false;
+				for (const TPair<FString, FString>& Sound : Row.ValidSounds)
+				{
+					const FSoftObjectPath SoundPath(Sound.Value);
+					FSSCultureAudioEntry* Entry = VoiceSound->VoiceCultures.FindByPredicate([&Sound](const FSSCultureAudioEntry& Existing)
+					{
+						return Existing.Culture.Equals(Sound.Key, ESearchCase::IgnoreCase);
+					});
+					if (Entry && Entry->Sound.ToSoftObjectPath() == SoundPath)
+						continue;
+
+					if (!bModified)
+					{
+						VoiceSound->Modify();
+						bModified = true;
+					}
+					if (!Entry)
+					{
+						Entry = &VoiceSound->VoiceCultures.AddDefaulted_GetRef();
+						Entry->Culture = Sound.Key;
+					}
+					Entry->Sound = TSoftObjectPtr<USoundBase>(SoundPath);
+					OutReport.EntriesChanged++;
+				}
+
+				if (bModified)
+				{
+					VoiceSound->MarkPackageDirty();
+					ModifiedPackages.Add(VoiceSound->GetOutermost());
+				}
+			}
+			Stats.AssetsModified += ModifiedPackages.Num();
+			ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+			if (Options.bForceSave)
+			{
+				const double SaveStart = FPlatformTime::Seconds();
+				Stats.PackagesSaved += SavePackages(ModifiedPackages);
+				SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+			}
+			if (Options.bCollectGarbageBetweenBatches)
+			{
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			}
+		}
+
+		Rows.Reset();
+	};
+
+	// The file is streamed in chunks, only one batch of rows is held at a time
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*FilePath));
+	if (!Reader)
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to open %s"), *FilePath);
+		return false;
+	}
+
+	FRecordReader Records(*Reader, !bJsonLines);
+	FString Line;
+	int32 NumLines = 0;
+	while (!bCancelled && !bHeaderError && Records.Next(Line, NumLines))
+	{
+		const int32 RecordLineNumber = LineNumber + 1;
+		LineNumber += NumLines;
+		if (Line.TrimStartAndEnd().IsEmpty())
+			continue;
+
+		if (!bJsonLines && Columns.Num() == 0)
+		{
+			ParseCsvLine(Line, Columns);
+			for (FString& Column : Columns)
+			{
+				Column.TrimStartAndEndInline();
+			}
+			if (!Columns.ContainsByPredicate([](const FString& Column) { return Column.Equals(TEXT("Asset"), ESearchCase::IgnoreCase); }) &&
+				!Columns.ContainsByPredicate([](const FString& Column) { return Column.Equals(TEXT("LineId"), ESearchCase::IgnoreCase); }))
+			{
+				AddError(RecordLineNumber, TEXT("header has neither an Asset nor a LineId column"));
+				bHeaderError = true;
+			}
+			continue;
+		}
+
+		FMappingRow& Row = Rows.AddDefaulted_GetRef();
+		Row.LineNumber = RecordLineNumber;
+		OutReport.RowsRead++;
+
+		if (bJsonLines)
+		{
+			TSharedPtr<FJsonObject> JsonRow;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<TCHAR>::Create(FString(Line)), JsonRow) || !JsonRow.IsValid())
+			{
+				Row.Errors.Add(TEXT("invalid JSON"));
+			}
+			else
+			{
+				JsonRow->TryGetStringField(TEXT("Asset"), Row.Asset);
+				JsonRow->TryGetStringField(TEXT("LineId"), Row.LineId);
+
+				const TSharedPtr<FJsonObject>* JsonCultures;
+				if (JsonRow->TryGetObjectField(TEXT("Cultures"), JsonCultures))
+				{
+					// A culture is either "en": "/Game/..." or "en": { "Sound": "/Game/...", "Status": ... }
+					for (const TPair<FString, TSharedPtr<FJsonValue>>& JsonCulture : (*JsonCultures)->Values)
+					{
+						FString Sound;
+						const TSharedPtr<FJsonObject>* JsonSound;
+						if (!JsonCulture.Value->TryGetString(Sound) && JsonCulture.Value->TryGetObject(JsonSound))
+						{
+							(*JsonSound)->TryGetStringField(TEXT("Sound"), Sound);
+						}
+						if (!Sound.IsEmpty())
+						{
+							Row.Sounds.Emplace(JsonCulture.Key.ToLower(), MoveTemp(Sound));
+						}
+					}
+				}
+			}
+		}
+		else
+		{
+			ParseCsvLine(Line, Fields);
+			for (int32 i = 0; i < Columns.Num() && i < Fields.Num(); ++i)
+			{
+				const FString& Column = Columns[i];
+				FString& Field = Fields[i];
+				Field.TrimStartAndEndInline();
+
+				if (Column.Equals(TEXT("Asset"), ESearchCase::IgnoreCase))
+				{
+					Row.Asset = MoveTemp(Field);
+				}
+				else if (Column.Equals(TEXT("LineId"), ESearchCase::IgnoreCase))
+				{
+					Row.LineId = MoveTemp(Field);
+				}
+				else if (!Field.IsEmpty() && !IsFixedColumn(Column) && !Column.EndsWith(TEXT("_status"), ESearchCase::IgnoreCase))
+				{
+					Row.Sounds.Emplace(Column.ToLower(), MoveTemp(Field));
+				}
+			}
+		}
+
+		if (Rows.Num() >= BatchSize)
+		{
+			ProcessBatch();
+			SlowTask.EnterProgressFrame(static_cast<float>(Records.GetBytesRead()) - SlowTask.CompletedWork, FText::Format(
+				NSLOCTEXT("SSVoiceCultureEditor", "ImportingMappingsProgress", "Importing voice culture mappings ({0} rows)..."),
+				FText::AsNumber(OutReport.RowsRead)));
+			bCancelled = SlowTask.ShouldCancel();
+		}
+	}
+
+	if (!bCancelled)
+	{
+		ProcessBatch();
+	}
+
+	Stats.MatchSeconds = MatchSeconds;
+	Stats.ApplySeconds = ApplySeconds;
+	Stats.SaveSeconds = SaveSeconds;
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Mapping import %s%s: %d row(s), %d invalid, %d error(s), %d entry change(s)%s, %d asset(s) modified, %d saved (%.2fs)"),
+	       bCancelled ? TEXT("cancelled") : TEXT("done"), bApply ? TEXT("") : TEXT(" (dry run)"), OutReport.RowsRead,
+	       OutReport.RowsInvalid, OutReport.NumErrors, OutReport.EntriesChanged, bApply ? TEXT("") : TEXT(" pending"),
+	       Stats.AssetsModified, Stats.PackagesSaved, Stats.TotalSeconds);
+
+	return !bCancelled && !bHeaderError;
+}
+
+bool FSSVoiceCultureUtils::SaveMappingImportReport(const FSSVoiceCultureMappingImportReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/MappingImport.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Mapping import report written to %s"), *ReportPath);
+	return true;
+}
@@ -0,0 +1,377 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureTable.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+
+#define LOCTEXT_NAMESPACE "SSVoiceCultureEditor"
+
+DECLARE_CYCLE_STAT(TEXT("Migrate Voice Folders"), STAT_VoiceCulture_Migrate, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** Voice assets under the folders (recursive), sorted by package so rows and batches are stable between runs */
+	TArray<FAssetData> GetFolderVoiceAssets(const TArray<FString>& Folders)
+	{
+		FARFilter Filter;
+		Filter.ClassPaths.Add(USSVoiceCultureSound::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
+		for (const FString& Folder : Folders)
+		{
+			Filter.PackagePaths.Add(FName(*Folder));
+		}
+
+		TArray<FAssetData> VoiceAssets;
+		USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get().GetAssets(Filter, VoiceAssets);
+		VoiceAssets.Sort([](const FAssetData& A, const FAssetData& B) { return A.PackageName.LexicalLess(B.PackageName); });
+		return VoiceAssets;
+	}
+
+	/** Column of a culture in the table, created next to the table (<Table>_<culture>) if missing */
+	USSVoiceCultureTableColumn* GetOrCreateColumn(USSVoiceCultureTable& Table, const FString& Culture,
+	                                              TSet<UPackage*>& OutPackages)
+	{
+		const FString CultureCode = Culture.ToLower();
+		if (const FSSVoiceCultureTableCulture* TableCulture = Table.FindCulture(CultureCode))
+		{
+			if (USSVoiceCultureTableColumn* Column = TableCulture->Column.LoadSynchronous())
+			{
+				OutPackages.Add(Column->GetOutermost());
+				return Column;
+			}
+		}
+
+		const FString ColumnName = FString::Printf(TEXT("%s_%s"), *Table.GetName(), *CultureCode);
+		const FString ColumnPackage = FPackageName::GetLongPackagePath(Table.GetOutermost()->GetName()) / ColumnName;
+		USSVoiceCultureTableColumn* Column = FSSVoiceCultureUtils::LoadOrCreateAsset<USSVoiceCultureTableColumn>(
+			ColumnPackage, ColumnName);
+		if (!Column)
+			return nullptr;
+
+		FSSVoiceCultureTableCulture* TableCulture = Table.Cultures.FindByPredicate(
+			[&CultureCode](const FSSVoiceCultureTableCulture& C) { return C.Culture == FName(*CultureCode); });
+		if (!TableCulture)
+		{
+			TableCulture = &Table.Cultures.AddDefaulted_GetRef();
+			TableCulture->Culture = FName(*CultureCode);
+		}
+		TableCulture->Column = Column;
+
+		OutPackages.Add(Column->GetOutermost());
+		return Column;
+	}
+}
+
+FString FSSVoiceCultureUtils::GetDefaultMigrationTarget(const FString& Folder, ESSVoiceCultureMigrationFormat Format)
+{
+	const FString AssetName = FString::Printf(TEXT("%s_%s"), Format == ESSVoiceCultureMigrationFormat::Table ? TEXT("VT") : TEXT("VB"),
+	                                          *FPackageName::GetShortName(Folder));
+	return FString::Printf(TEXT("%s/%s.%s"), *Folder, *AssetName, *AssetName);
+}
+
+bool FSSVoiceCultureUtils::MigrateVoiceFolders(const TArray<FString>& Folders, ESSVoiceCultureMigrationFormat Format,
+                                               const FString& TargetObjectPath, const FSSVoiceCultureBatchOptions& Options,
+                                               FSSVoiceCultureMigrationReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_Migrate, "VoiceCulture::MigrateVoiceFolders");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("Migrate");
+	OutReport.Format = StaticEnum<ESSVoiceCultureMigrationFormat>()->GetNameStringByValue(static_cast<int64>(Format));
+
+	if (Folders.Num() == 0)
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Migration needs at least one folder"));
+		return false;
+	}
+
+	// 1. Voice assets from the registry; assets without culture (already migrated, or empty) are not even loaded
+	TArray<FAssetData> VoiceAssets;
+	for (const FAssetData& VoiceAsset : GetFolderVoiceAssets(Folders))
+	{
+		if (GetTaggedCultures(VoiceAsset).Num() == 0)
+		{
+			OutReport.AddSkipped(VoiceAsset.GetObjectPathString(), TEXT("No culture sound"));
+			continue;
+		}
+		VoiceAssets.Add(VoiceAsset);
+	}
+	Stats.AssetsScanned = VoiceAssets.Num() + OutReport.Skipped.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	const bool bSave = Options.bForceSave;
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	// Banks: one per folder, the builder loads and copies the culture sounds so memory is bounded by the folder
+	if (Format == ESSVoiceCultureMigrationFormat::Bank)
+	{
+		TMap<FName, TArray<FAssetData>> AssetsByFolder;
+		for (const FAssetData& VoiceAsset : VoiceAssets)
+		{
+			AssetsByFolder.FindOrAdd(VoiceAsset.PackagePath).Add(VoiceAsset);
+		}
+
+		FScopedSlowTask SlowTask(AssetsByFolder.Num(), LOCTEXT("MigrateBanks", "Migrating voice lines to banks..."),
+		                         Options.bInteractive);
+		if (Options.bInteractive)
+		{
+			SlowTask.MakeDialog(true);
+		}
+
+		for (const TPair<FName, TArray<FAssetData>>& FolderPair : AssetsByFolder)
+		{
+			if (SlowTask.ShouldCancel())
+				break;
+			SlowTask.EnterProgressFrame(1);
+
+			const FString BankPath = GetDefaultMigrationTarget(FolderPair.Key.ToString(), Format);
+
+			FSSVoiceCultureOperationStats BankStats;
+			if (!BuildVoiceBank(BankPath, FolderPair.Value, bSave, BankStats))
+			{
+				for (const FAssetData& VoiceAsset : FolderPair.Value)
+				{
+					OutReport.AddSkipped(VoiceAsset.GetObjectPathString(), TEXT("Bank build failed"));
+				}
+				continue;
+			}
+
+			OutReport.Targets.Add(BankPath);
+			for (const FAssetData& VoiceAsset : FolderPair.Value)
+			{
+				OutReport.Migrated.Add(VoiceAsset.GetObjectPathString());
+			}
+			Stats.AssetsMatched += BankStats.AssetsMatched;
+			Stats.AssetsModified += BankStats.AssetsModified;
+			Stats.PackagesSaved += BankStats.PackagesSaved;
+			Stats.ApplySeconds += BankStats.ApplySeconds;
+			Stats.SaveSeconds += BankStats.SaveSeconds;
+
+			if (Options.bCollectGarbageBetweenBatches)
+			{
+				CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+			}
+		}
+
+		Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+		return true;
+	}
+
+	// Table: rows are written first and saved, then the voice assets are redirected, so an interrupted run
+	// never leaves a voice asset pointing at an unsaved row
+	const FSoftObjectPath TablePath(TargetObjectPath.IsEmpty() ? GetDefaultMigrationTarget(Folders[0], Format) : TargetObjectPath);
+	if (TablePath.IsNull() || !FPackageName::IsValidLongPackageName(TablePath.GetLongPackageName()))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Invalid table path '%s'"), *TablePath.ToString());
+		return false;
+	}
+
+	USSVoiceCultureTable* Table = LoadOrCreateAsset<USSVoiceCultureTable>(TablePath.GetLongPackageName(), TablePath.GetAssetName());
+	if (!Table)
+		return false;
+
+	OutReport.Targets.Add(TablePath.ToString());
+	Table->RebuildLineIndices();
+
+	FScopedSlowTask SlowTask(VoiceAssets.Num() * 2, LOCTEXT("MigrateTable", "Migrating voice lines to table..."),
+	                         Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	// 2. Read VoiceCultures batch by batch into the table rows
+	TSet<UPackage*> TablePackages;
+	TablePackages.Add(Table->GetOutermost());
+
+	// Voice assets whose row was written, redirected in step 3
+	TArray<FAssetData> RowAssets;
+	for (int32 BatchStart = 0; BatchStart < VoiceAssets.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, VoiceAssets.Num());
+		SlowTask.EnterProgressFrame(BatchEnd - BatchStart);
+
+		const double ApplyStart = FPlatformTime::Seconds();
+		LoadAssetsParallel(MakeArrayView(VoiceAssets).Slice(BatchStart, BatchEnd - BatchStart));
+
+		for (int32 i = BatchStart; i < BatchEnd; ++i)
+		{
+			const FString AssetPath = VoiceAssets[i].GetObjectPathString();
+			const USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(VoiceAssets[i].FastGetAsset(false));
+			if (!VoiceSound)
+			{
+				OutReport.AddSkipped(AssetPath, TEXT("Could not load"));
+				continue;
+			}
+			if (!VoiceSound->Table.IsNull())
+			{
+				OutReport.AddSkipped(AssetPath, TEXT("Already in a table"));
+				continue;
+			}
+			if (!VoiceSound->Bank.IsNull())
+			{
+				OutReport.AddSkipped(AssetPath, TEXT("Packed into a bank"));
+				continue;
+			}
+
+			// Two voice assets with the same name in different folders, in this run or an earlier one:
+			// the row belongs to the first, an existing row is only rewritten for the asset it was migrated from
+			const FName LineId = VoiceSound->GetFName();
+			const int32 ExistingIndex = Table->FindLineIndex(LineId);
+			if (ExistingIndex != INDEX_NONE &&
+				(!Table->SourceLines.IsValidIndex(ExistingIndex) || Table->SourceLines[ExistingIndex].Get() != VoiceSound))
+			{
+				UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] %s: line ID %s is already a row of %s (from %s)"),
+				       *AssetPath, *LineId.ToString(), *TablePath.ToString(),
+				       Table->SourceLines.IsValidIndex(ExistingIndex) ? *Table->SourceLines[ExistingIndex].ToString() : TEXT("unknown asset"));
+				OutReport.Conflicts.Add(AssetPath);
+				continue;
+			}
+
+			const int32 LineIndex = Table->AddLine(LineId);
+			Table->SourceLines.SetNum(Table->LineIds.Num());
+			Table->SourceLines[LineIndex] = VoiceSound;
+
+			for (const FSSCultureAudioEntry& Entry : VoiceSound->VoiceCultures)
+			{
+				if (Entry.Sound.IsNull())
+					continue;
+
+				if (USSVoiceCultureTableColumn* Column = GetOrCreateColumn(*Table, Entry.Culture, TablePackages))
+				{
+					Column->Sounds.SetNum(Table->LineIds.Num());
+					Column->Sounds[LineIndex] = Entry.Sound;
+				}
+			}
+
+			RowAssets.Add(VoiceAssets[i]);
+			Stats.AssetsMatched++;
+		}
+		Stats.ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+		// Only the table and its columns stay loaded between batches
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	// Every column has a slot per line
+	for (const FSSVoiceCultureTableCulture& TableCulture : Table->Cultures)
+	{
+		if (USSVoiceCultureTableColumn* Column = TableCulture.Column.Get())
+		{
+			Column->Sounds.SetNum(Table->LineIds.Num());
+			Column->MarkPackageDirty();
+		}
+	}
+	Table->Cultures.Sort([](const FSSVoiceCultureTableCulture& A, const FSSVoiceCultureTableCulture& B)
+	{
+		return A.Culture.LexicalLess(B.Culture);
+	});
+	Table->MarkPackageDirty();
+
+	if (bSave)
+	{
+		const double SaveStart = FPlatformTime::Seconds();
+		const int32 NumTablePackages = SavePackages(TablePackages);
+		Stats.PackagesSaved += NumTablePackages;
+		Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+
+		if (NumTablePackages != TablePackages.Num())
+		{
+			UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Table %s could not be saved, voice assets are left as is"),
+			       *TablePath.ToString());
+			return false;
+		}
+	}
+
+	// 3. Redirect the voice assets to their row, batch by batch
+	for (int32 BatchStart = 0; BatchStart < RowAssets.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, RowAssets.Num());
+		SlowTask.EnterProgressFrame(BatchEnd - BatchStart);
+
+		const double ApplyStart = FPlatformTime::Seconds();
+		LoadAssetsParallel(MakeArrayView(RowAssets).Slice(BatchStart, BatchEnd - BatchStart));
+
+		TSet<UPackage*> ModifiedPackages;
+		for (int32 i = BatchStart; i < BatchEnd; ++i)
+		{
+			USSVoiceCultureSound* VoiceSound = Cast<USSVoiceCultureSound>(RowAssets[i].FastGetAsset(false));
+			if (!VoiceSound)
+			{
+				OutReport.AddSkipped(RowAssets[i].GetObjectPathString(), TEXT("Could not load"));
+				continue;
+			}
+
+			VoiceSound->Modify();
+			VoiceSound->Table = Table;
+			VoiceSound->TableLineId = VoiceSound->GetFName();
+			VoiceSound->VoiceCultures.Reset();
+			VoiceSound->MarkPackageDirty();
+			ModifiedPackages.Add(VoiceSound->GetOutermost());
+
+			OutReport.Migrated.Add(RowAssets[i].GetObjectPathString());
+			Stats.AssetsModified++;
+		}
+		Stats.ApplySeconds += FPlatformTime::Seconds() - ApplyStart;
+
+		if (bSave)
+		{
+			const double SaveStart = FPlatformTime::Seconds();
+			Stats.PackagesSaved += SavePackages(ModifiedPackages);
+			Stats.SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display,
+	       TEXT("[SSVoiceCulture] Migrated %d voice asset(s) to %s, %d skipped, %d line ID conflict(s) (%d line(s), %d culture(s))"),
+	       OutReport.Migrated.Num(), *TablePath.ToString(), OutReport.Skipped.Num(), OutReport.Conflicts.Num(),
+	       Table->LineIds.Num(), Table->Cultures.Num());
+	return true;
+}
+
+bool FSSVoiceCultureUtils::SaveMigrationReport(const FSSVoiceCultureMigrationReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/MigrationReport.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Migration report written to %s"), *ReportPath);
+	return true;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,280 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "AssetToolsModule.h"
+#include "IAssetTools.h"
+#include "JsonObjectConverter.h"
+#include "ObjectTools.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find Orphan Sounds"), STAT_VoiceCulture_FindOrphans, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** Packages of the assets that own culture sounds: voice assets, table columns and bank chunks */
+	TSet<FName> GetCultureSoundOwnerPackages(IAssetRegistry& AssetRegistry)
+	{
+		TArray<FAssetData> Owners = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+
+		FARFilter Filter;
+		Filter.ClassPaths.Add(USSVoiceCultureTableColumn::StaticClass()->GetClassPathName());
+		Filter.ClassPaths.Add(USSVoiceCultureBankChunk::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Add(FName("/Game"));
+		AssetRegistry.GetAssets(Filter, Owners);
+
+		TSet<FName> OwnerPackages;
+		OwnerPackages.Reserve(Owners.Num());
+		for (const FAssetData& Owner : Owners)
+		{
+			OwnerPackages.Add(Owner.PackageName);
+		}
+		return OwnerPackages;
+	}
+
+	TArray<FAssetData> GetOrphanAssets(IAssetRegistry& AssetRegistry, TConstArrayView<FSSVoiceCultureOrphanSound> Orphans)
+	{
+		TArray<FAssetData> Assets;
+		Assets.Reserve(Orphans.Num());
+		for (const FSSVoiceCultureOrphanSound& Orphan : Orphans)
+		{
+			const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Orphan.Asset));
+			if (Asset.IsValid())
+			{
+				Assets.Add(Asset);
+			}
+		}
+		return Assets;
+	}
+}
+
+void FSSVoiceCultureUtils::FindOrphanCultureSounds(const USSVoiceCultureStrategy& Strategy,
+                                                   const FSSVoiceCultureBatchOptions& Options,
+                                                   FSSVoiceCultureOrphanReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_FindOrphans, "VoiceCulture::FindOrphanCultureSounds");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("Orphans");
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	const TArray<FAssetData> Sounds = USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets();
+	const TSet<FName> OwnerPackages = GetCultureSoundOwnerPackages(AssetRegistry);
+
+	Stats.AssetsScanned = Sounds.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Registry reads are thread-safe, each chunk collects its own orphans
+	const double MatchStart = FPlatformTime::Seconds();
+	const int32 NumChunks = Options.GetNumChunks(Sounds.Num());
+	const int32 ChunkSize = FMath::DivideAndRoundUp(Sounds.Num(), NumChunks);
+
+	TArray<TArray<FSSVoiceCultureOrphanSound>> ChunkOrphans;
+	ChunkOrphans.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		TArray<FName> Referencers;
+		FString Culture;
+		FString Suffix;
+
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, Sounds.Num());
+		for (int32 i = Start; i < End; ++i)
+		{
+			const FAssetData& Sound = Sounds[i];
+			if (!Strategy.ParseCultureSoundAsset(Sound, Culture, Suffix))
+				continue;
+
+			Referencers.Reset();
+			AssetRegistry.GetReferencers(Sound.PackageName, Referencers, UE::AssetRegistry::EDependencyCategory::Package);
+
+			int32 OtherReferencers = 0;
+			bool bOwned = false;
+			for (const FName& Referencer : Referencers)
+			{
+				if (OwnerPackages.Contains(Referencer))
+				{
+					bOwned = true;
+					break;
+				}
+				OtherReferencers++;
+			}
+			if (bOwned)
+				continue;
+
+			const TOptional<FAssetPackageData> PackageData = AssetRegistry.GetAssetPackageDataCopy(Sound.PackageName);
+
+			FSSVoiceCultureOrphanSound& Orphan = ChunkOrphans[ChunkIndex].AddDefaulted_GetRef();
+			Orphan.Asset = Sound.GetObjectPathString();
+			Orphan.Culture = Culture;
+			Orphan.Suffix = Suffix;
+			Orphan.DiskSize = PackageData.IsSet() ? PackageData->DiskSize : 0;
+			Orphan.OtherReferencers = OtherReferencers;
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	for (TArray<FSSVoiceCultureOrphanSound>& Orphans : ChunkOrphans)
+	{
+		OutReport.Orphans.Append(MoveTemp(Orphans));
+	}
+
+	for (const FSSVoiceCultureOrphanSound& Orphan : OutReport.Orphans)
+	{
+		OutReport.TotalDiskSize += Orphan.DiskSize;
+	}
+
+	OutReport.Orphans.Sort([](const FSSVoiceCultureOrphanSound& A, const FSSVoiceCultureOrphanSound& B)
+	{
+		return A.DiskSize > B.DiskSize;
+	});
+
+	Stats.AssetsMatched = OutReport.Orphans.Num();
+	Stats.MatchSeconds = FPlatformTime::Seconds() - MatchStart;
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d orphan culture sound(s) out of %d sounds, %.1f MB on disk (%.2fs)"),
+	       OutReport.Orphans.Num(), Sounds.Num(), OutReport.TotalDiskSize / (1024.0 * 1024.0), Stats.TotalSeconds);
+}
+
+int32 FSSVoiceCultureUtils::DeleteOrphanCultureSounds(const TArray<FSSVoiceCultureOrphanSound>& Orphans,
+                                                      const FSSVoiceCultureBatchOptions& Options)
+{
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	FScopedSlowTask SlowTask(Orphans.Num(), NSLOCTEXT("SSVoiceCultureEditor", "DeletingOrphans",
+	                                                  "Deleting orphan culture sounds..."), Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	int32 Deleted = 0;
+	for (int32 BatchStart = 0; BatchStart < Orphans.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const TConstArrayView<FSSVoiceCultureOrphanSound> Batch = MakeArrayView(Orphans).Slice(
+			BatchStart, FMath::Min(BatchSize, Orphans.Num() - BatchStart));
+		SlowTask.EnterProgressFrame(Batch.Num());
+
+		Deleted += ObjectTools::DeleteAssets(GetOrphanAssets(AssetRegistry, Batch), false);
+
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d orphan culture sound(s) deleted"), Deleted);
+	return Deleted;
+}
+
+int32 FSSVoiceCultureUtils::MoveOrphanCultureSounds(const TArray<FSSVoiceCultureOrphanSound>& Orphans,
+                                                    const FString& TargetFolder,
+                                                    const FSSVoiceCultureBatchOptions& Options)
+{
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+	IAssetTools& AssetTools = FModuleManager::LoadModuleChecked<FAssetToolsModule>("AssetTools").Get();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+
+	FScopedSlowTask SlowTask(Orphans.Num(), NSLOCTEXT("SSVoiceCultureEditor", "MovingOrphans",
+	                                                  "Moving orphan culture sounds..."), Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	int32 Moved = 0;
+	for (int32 BatchStart = 0; BatchStart < Orphans.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+			break;
+
+		const TConstArrayView<FSSVoiceCultureOrphanSound> Batch = MakeArrayView(Orphans).Slice(
+			BatchStart, FMath::Min(BatchSize, Orphans.Num() - BatchStart));
+		SlowTask.EnterProgressFrame(Batch.Num());
+
+		TArray<FAssetRenameData> Renames;
+		TArray<FString> PackageNames;
+		for (const FSSVoiceCultureOrphanSound& Orphan : Batch)
+		{
+			const FAssetData Asset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Orphan.Asset));
+			if (!Asset.IsValid())
+				continue;
+
+			const FString AssetName = Asset.AssetName.ToString();
+			const FString NewPackageName = TargetFolder / Orphan.Culture / AssetName;
+			if (NewPackageName == Asset.PackageName.ToString())
+				continue;
+
+			Renames.Emplace(Asset.GetSoftObjectPath(), FSoftObjectPath(NewPackageName + TEXT(".") + AssetName));
+			PackageNames.Add(Asset.PackageName.ToString());
+			PackageNames.Add(NewPackageName);
+		}
+
+		if (Renames.Num() == 0 || !AssetTools.RenameAssets(Renames))
+		{
+			UE_LOG(LogVoiceCultureEditor, Warning, TEXT("[SSVoiceCulture] Could not move %d orphan culture sound(s)"), Renames.Num());
+			continue;
+		}
+		Moved += Renames.Num();
+
+		// New packages and the redirectors left behind
+		if (Options.bForceSave)
+		{
+			TSet<UPackage*> Packages;
+			for (const FString& PackageName : PackageNames)
+			{
+				if (UPackage* Package = FindPackage(nullptr, *PackageName))
+				{
+					Packages.Add(Package);
+				}
+			}
+			SavePackages(Packages);
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] %d orphan culture sound(s) moved to %s"), Moved, *TargetFolder);
+	return Moved;
+}
+
+bool FSSVoiceCultureUtils::SaveOrphanReport(const FSSVoiceCultureOrphanReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/OrphanSounds.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Orphan report written to %s"), *ReportPath);
+	return true;
+}
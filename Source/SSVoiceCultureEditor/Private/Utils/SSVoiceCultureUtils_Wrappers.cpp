@@ -0,0 +1,274 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+
+#include "Utils/SSVoiceCultureUtils.h"
+
+#include "JsonObjectConverter.h"
+#include "SSVoiceCultureBank.h"
+#include "SSVoiceCultureEditorLog.h"
+#include "SSVoiceCultureEditorSubsystem.h"
+#include "SSVoiceCultureSettings.h"
+#include "SSVoiceCultureStats.h"
+#include "SSVoiceCultureTable.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Settings/SSVoiceCultureStrategy.h"
+
+DECLARE_CYCLE_STAT(TEXT("Create Voice Wrappers"), STAT_VoiceCulture_CreateWrappers, STATGROUP_VoiceCulture);
+
+namespace
+{
+	/** Culture sounds of one line without a voice asset */
+	struct FWrapperGroup
+	{
+		FString AssetName;
+		TArray<FSSCultureAudioEntry> Entries;
+	};
+
+	/**
+	 * Sound packages already used by a voice asset, a table column or a bank chunk. Their lines exist,
+	 * even when migrated under another name, and must not get a second wrapper.
+	 */
+	TSet<FName> GetOwnedSoundPackages(IAssetRegistry& AssetRegistry, const TArray<FAssetData>& VoiceAssets)
+	{
+		TArray<FAssetData> Owners = VoiceAssets;
+
+		FARFilter Filter;
+		Filter.ClassPaths.Add(USSVoiceCultureTableColumn::StaticClass()->GetClassPathName());
+		Filter.ClassPaths.Add(USSVoiceCultureBankChunk::StaticClass()->GetClassPathName());
+		Filter.bRecursivePaths = true;
+		Filter.PackagePaths.Add(FName("/Game"));
+		AssetRegistry.GetAssets(Filter, Owners);
+
+		TSet<FName> OwnedPackages;
+		TArray<FName> Dependencies;
+		for (const FAssetData& Owner : Owners)
+		{
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(Owner.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+			                              UE::AssetRegistry::EDependencyQuery::Soft);
+			OwnedPackages.Append(Dependencies);
+		}
+		return OwnedPackages;
+	}
+}
+
+bool FSSVoiceCultureUtils::CreateMissingVoiceCultureWrappers(const USSVoiceCultureStrategy& Strategy, const FString& TargetPath,
+                                                             bool bApply, const FSSVoiceCultureBatchOptions& Options,
+                                                             FSSVoiceCultureWrapperReport& OutReport)
+{
+	SS_VOICECULTURE_SCOPE(STAT_VoiceCulture_CreateWrappers, "VoiceCulture::CreateMissingVoiceCultureWrappers");
+
+	const double StartTime = FPlatformTime::Seconds();
+	FSSVoiceCultureOperationStats& Stats = OutReport.Stats;
+	Stats.Operation = TEXT("CreateWrappers");
+	OutReport.bApplied = bApply;
+
+	if (!FPackageName::IsValidPath(TargetPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Invalid wrapper folder '%s'"), *TargetPath);
+		return false;
+	}
+
+	IAssetRegistry& AssetRegistry = USSVoiceCultureEditorSubsystem::GetAssetRegistryModule().Get();
+
+	// 1. Registry only: existing lines and their sounds
+	const TArray<FAssetData> VoiceAssets = USSVoiceCultureEditorSubsystem::GetAllLocalizeVoiceSoundAssets();
+	const TArray<FAssetData> Sounds = USSVoiceCultureEditorSubsystem::GetAllSoundBaseAssets();
+	const TSet<FName> OwnedPackages = GetOwnedSoundPackages(AssetRegistry, VoiceAssets);
+
+	TSet<FString> ExistingSuffixes;
+	ExistingSuffixes.Reserve(VoiceAssets.Num());
+	for (const FAssetData& VoiceAsset : VoiceAssets)
+	{
+		ExistingSuffixes.Add(Strategy.ExtractSuffixFromBaseName(VoiceAsset.AssetName.ToString()));
+	}
+
+	TSet<FString> SupportedCultures;
+	for (const FString& Culture : USSVoiceCultureSettings::GetSetting()->SupportedVoiceCultures)
+	{
+		SupportedCultures.Add(Culture.ToLower());
+	}
+
+	Stats.AssetsScanned = Sounds.Num();
+	Stats.ScanSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// 2. Group the unowned culture sounds by suffix, one map per chunk merged afterwards
+	const double MatchStart = FPlatformTime::Seconds();
+	const int32 NumChunks = FMath::Clamp(Options.GetNumChunks(Sounds.Num()), 1, FMath::Max(1, Sounds.Num()));
+	const int32 ChunkSize = FMath::DivideAndRoundUp(Sounds.Num(), NumChunks);
+
+	TArray<TMap<FString, TArray<FSSCultureAudioEntry>>> ChunkGroups;
+	ChunkGroups.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [&](int32 ChunkIndex)
+	{
+		TMap<FString, TArray<FSSCultureAudioEntry>>& Groups = ChunkGroups[ChunkIndex];
+		FString Culture;
+		FString Suffix;
+
+		const int32 Start = ChunkIndex * ChunkSize;
+		const int32 End = FMath::Min(Start + ChunkSize, Sounds.Num());
+		for (int32 i = Start; i < End; ++i)
+		{
+			const FAssetData& Sound = Sounds[i];
+			if (OwnedPackages.Contains(Sound.PackageName) || !Strategy.ParseCultureSoundAsset(Sound, Culture, Suffix))
+				continue;
+
+			if (Suffix.IsEmpty() || ExistingSuffixes.Contains(Suffix) ||
+				(SupportedCultures.Num() > 0 && !SupportedCultures.Contains(Culture)))
+				continue;
+
+			FSSCultureAudioEntry& Entry = Groups.FindOrAdd(Suffix).AddDefaulted_GetRef();
+			Entry.Culture = Culture;
+			Entry.Sound = TSoftObjectPtr<USoundBase>(Sound.GetSoftObjectPath());
+		}
+	}, NumChunks <= 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	TMap<FString, TArray<FSSCultureAudioEntry>> EntriesBySuffix;
+	for (TMap<FString, TArray<FSSCultureAudioEntry>>& Groups : ChunkGroups)
+	{
+		for (TPair<FString, TArray<FSSCultureAudioEntry>>& Group : Groups)
+		{
+			TArray<FSSCultureAudioEntry>& Entries = EntriesBySuffix.FindOrAdd(Group.Key);
+			for (FSSCultureAudioEntry& Entry : Group.Value)
+			{
+				// One sound per culture, a duplicate take is left for review
+				if (!Entries.ContainsByPredicate([&Entry](const FSSCultureAudioEntry& Existing) { return Existing.Culture == Entry.Culture; }))
+				{
+					Entries.Add(MoveTemp(Entry));
+				}
+			}
+		}
+	}
+	ChunkGroups.Empty();
+
+	TArray<FWrapperGroup> Wrappers;
+	Wrappers.Reserve(EntriesBySuffix.Num());
+	for (TPair<FString, TArray<FSSCultureAudioEntry>>& Group : EntriesBySuffix)
+	{
+		const FString AssetName = Strategy.BuildVoiceAssetName(Group.Key);
+		if (AssetName.IsEmpty())
+			continue;
+
+		const FString ObjectPath = TargetPath / AssetName + TEXT(".") + AssetName;
+		if (AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(ObjectPath)).IsValid() ||
+			FindPackage(nullptr, *(TargetPath / AssetName)))
+		{
+			OutReport.Conflicts.Add(ObjectPath);
+			continue;
+		}
+
+		FWrapperGroup& Wrapper = Wrappers.AddDefaulted_GetRef();
+		Wrapper.AssetName = AssetName;
+		Wrapper.Entries = MoveTemp(Group.Value);
+		Wrapper.Entries.Sort([](const FSSCultureAudioEntry& A, const FSSCultureAudioEntry& B) { return A.Culture < B.Culture; });
+	}
+	EntriesBySuffix.Empty();
+
+	Wrappers.Sort([](const FWrapperGroup& A, const FWrapperGroup& B) { return A.AssetName < B.AssetName; });
+	Stats.AssetsMatched = Wrappers.Num();
+	Stats.MatchSeconds = FPlatformTime::Seconds() - MatchStart;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Wrapper creation: %d line(s) without a voice asset, %d name conflict(s)"),
+	       Wrappers.Num(), OutReport.Conflicts.Num());
+
+	if (!bApply)
+	{
+		for (const FWrapperGroup& Wrapper : Wrappers)
+		{
+			OutReport.Created.Add(TargetPath / Wrapper.AssetName + TEXT(".") + Wrapper.AssetName);
+			OutReport.NumEntries += Wrapper.Entries.Num();
+		}
+		Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+		return true;
+	}
+
+	// 3. Create and save in batches, the entries are soft paths so no sound is loaded
+	FScopedSlowTask SlowTask(Wrappers.Num(), NSLOCTEXT("SSVoiceCultureEditor", "CreatingWrappers", "Creating voice culture assets..."),
+	                         Options.bInteractive);
+	if (Options.bInteractive)
+	{
+		SlowTask.MakeDialog(true);
+	}
+
+	const double ApplyStart = FPlatformTime::Seconds();
+	const int32 BatchSize = FMath::Max(1, Options.BatchSize);
+	double SaveSeconds = 0.0;
+	bool bCancelled = false;
+
+	for (int32 BatchStart = 0; BatchStart < Wrappers.Num(); BatchStart += BatchSize)
+	{
+		if (SlowTask.ShouldCancel())
+		{
+			bCancelled = true;
+			break;
+		}
+
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Wrappers.Num());
+		SlowTask.EnterProgressFrame(BatchEnd - BatchStart);
+
+		TSet<UPackage*> CreatedPackages;
+		for (int32 i = BatchStart; i < BatchEnd; ++i)
+		{
+			FWrapperGroup& Wrapper = Wrappers[i];
+			const FString PackageName = TargetPath / Wrapper.AssetName;
+
+			UPackage* Package = CreatePackage(*PackageName);
+			USSVoiceCultureSound* VoiceSound = NewObject<USSVoiceCultureSound>(Package, *Wrapper.AssetName,
+			                                                                   RF_Public | RF_Standalone | RF_Transactional);
+			VoiceSound->VoiceCultures = MoveTemp(Wrapper.Entries);
+			FAssetRegistryModule::AssetCreated(VoiceSound);
+			VoiceSound->MarkPackageDirty();
+
+			CreatedPackages.Add(Package);
+			OutReport.Created.Add(VoiceSound->GetPathName());
+			OutReport.NumEntries += VoiceSound->VoiceCultures.Num();
+		}
+		Stats.AssetsModified += CreatedPackages.Num();
+
+		if (Options.bForceSave)
+		{
+			const double SaveStart = FPlatformTime::Seconds();
+			Stats.PackagesSaved += SavePackages(CreatedPackages);
+			SaveSeconds += FPlatformTime::Seconds() - SaveStart;
+		}
+		if (Options.bCollectGarbageBetweenBatches)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	Stats.SaveSeconds = SaveSeconds;
+	Stats.ApplySeconds = FPlatformTime::Seconds() - ApplyStart - SaveSeconds;
+	Stats.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Wrapper creation %s: %d asset(s) created with %d entries, %d saved (%.2fs)"),
+	       bCancelled ? TEXT("cancelled") : TEXT("done"), Stats.AssetsModified, OutReport.NumEntries, Stats.PackagesSaved,
+	       Stats.TotalSeconds);
+
+	return !bCancelled;
+}
+
+bool FSSVoiceCultureUtils::SaveWrapperReport(const FSSVoiceCultureWrapperReport& Report)
+{
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+		return false;
+
+	const FString ReportPath = FPaths::ProjectSavedDir() / TEXT("SSVoiceCulture/WrapperCreation.json");
+	if (!FFileHelper::SaveStringToFile(Json, *ReportPath))
+	{
+		UE_LOG(LogVoiceCultureEditor, Error, TEXT("[SSVoiceCulture] Failed to write %s"), *ReportPath);
+		return false;
+	}
+
+	UE_LOG(LogVoiceCultureEditor, Display, TEXT("[SSVoiceCulture] Wrapper creation report written to %s"), *ReportPath);
+	return true;
+}
@@ -0,0 +1,71 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SSVoiceCultureCommandlet.generated.h"
+
+class FJsonObject;
+
+/**
+ * Headless entry point for the VoiceCulture bulk operations (CI / build machines).
+ *
+ * Usage:
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=AutoPopulate -Culture=fr [-Override]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=AutoPopulate -Actor=NPC01 [-Cultures=fr+de]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=AutoPopulate -All
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=Coverage
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=ActorList
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=LevelManifest [-Maps=/Game/Maps/A+/Game/Maps/B]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=BuildBank -Bank=/Game/Dialogue/VB_Scene01 [-Actor=NPC01 | -Path=/Game/Dialogue/Scene01]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=Dedup [-Apply]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=Loudness [-Trim]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=AudioProfiles [-DryRun]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=Orphans [-Delete | -MoveTo=/Game/Dialogue/_Orphans]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=RenameCultures -Rename=jp:ja[+br:pt-BR]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=ExportMappings -File=C:/Vendor/Mappings.csv|.jsonl
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=ImportMappings -File=C:/Vendor/Mappings.csv|.jsonl [-DryRun]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=CreateWrappers -Path=/Game/Dialogue/Voice [-DryRun]
+ *   UnrealEditor-Cmd.exe Project.uproject -run=SSVoiceCulture -Mode=Migrate -Path=/Game/Dialogue/Chapter1[+/Game/Dialogue/Chapter2] [-Format=Table|Bank] [-Target=/Game/Dialogue/VT_Dialogue]
+ *
+ * Options:
+ *   -Profile=<Name>   Strategy profile to use for this run (not saved to the user config).
+ *   -Workers=<N>      Parallel chunks for name matching (0 = task graph workers).
+ *   -BatchSize=<N>    Voice assets loaded/saved per batch, GC runs between batches.
+ *   -NoSave           Do not save modified packages.
+ *   -Output=<Path>    JSON summary file (default: Saved/SSVoiceCulture/CommandletResult.json).
+ *   -Manifest=<Path>  LevelManifest object path (default: the settings' LevelManifest, else /Game/VoiceCulture/VoiceCultureLevelManifest).
+ *
+ * Returns 0 on success, 1 on invalid arguments or failure.
+ */
+UCLASS()
+class SSVOICECULTUREEDITOR_API USSVoiceCultureCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	USSVoiceCultureCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 RunAutoPopulate(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunCoverage(TSharedRef<FJsonObject> Result);
+	int32 RunActorList(TSharedRef<FJsonObject> Result);
+	int32 RunLevelManifest(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunBuildBank(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunMigrate(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunDedup(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunLoudness(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunAudioProfiles(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunOrphans(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunRenameCultures(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunExportMappings(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunImportMappings(const FString& Params, TSharedRef<FJsonObject> Result);
+	int32 RunCreateWrappers(const FString& Params, TSharedRef<FJsonObject> Result);
+};
@@ -10,9 +10,11 @@
 #include "ContentBrowserDelegates.h"
 #include "IContentBrowserSingleton.h"
 #include "SSVoiceCultureEditorTypes.h"
+#include "Dashboard/SSVoiceDashboardActorList.h"
 
 
 class SSSVoiceEditorProfileSelector;
+class FSSVoiceCultureJob;
 class FSSVoiceFilterCompleteCulture;
 class FSSVoiceFilterMissingCulture;
 class FSSVoiceFilterActorName;
@@ -35,12 +37,10 @@ protected:
 	// Display Data Structs
 	// ------------------------
 
-	/** Display data for the voice asset list (right panel) */
+	/** Display data for the voice asset list (right panel), culture details are read from the registry tag when the row is generated */
 	struct FVoiceCultureAssetDisplayData
 	{
-		FString AssetName;
-		FString AssetPath;
-		TArray<FString> AvailableCultures;
+		FAssetData AssetData;
 		int32 TotalCultures = 0;
 	};
 	
@@ -78,6 +78,39 @@ protected:
 	FReply OnGenerateReportClicked();
 	
 	void RefreshCoverageSection();
+
+	// ------------------------
+	// Loudness Section (bottom right)
+	// ------------------------
+
+	/** Last loaded loudness report */
+	FSSVoiceCultureLoudnessReport LoudnessReport;
+
+	TArray<TSharedPtr<FSSVoiceCultureLoudnessCulture>> LoudnessListData;
+	TSharedPtr<SListView<TSharedPtr<FSSVoiceCultureLoudnessCulture>>> LoudnessListView;
+
+	TSharedRef<SWidget> BuildLoudnessSection();
+	TSharedRef<ITableRow> OnGenerateLoudnessRow(TSharedPtr<FSSVoiceCultureLoudnessCulture> Entry, const TSharedRef<STableViewBase>& OwnerTable);
+	FReply OnClick_AnalyzeLoudness();
+	FReply OnClick_TrimSilence();
+	FReply OnClick_ApplyAudioProfiles();
+	FText GetLoudnessSummaryText() const;
+
+	void RefreshLoudnessSection();
+
+	// ------------------------
+	// Duration Section (bottom right)
+	// ------------------------
+
+	TArray<TSharedPtr<FSSVoiceCultureDurationMismatch>> DurationMismatchData;
+	TSharedPtr<SListView<TSharedPtr<FSSVoiceCultureDurationMismatch>>> DurationMismatchListView;
+
+	/** Result of the last search (count and time) */
+	FText DurationSummaryText;
+
+	TSharedRef<SWidget> BuildDurationSection();
+	TSharedRef<ITableRow> OnGenerateDurationMismatchRow(TSharedPtr<FSSVoiceCultureDurationMismatch> Entry, const TSharedRef<STableViewBase>& OwnerTable);
+	FReply OnClick_FindDurationMismatches();
 	// ------------------------
 	// Button Events (top left)
 	// ------------------------
@@ -91,35 +124,54 @@ protected:
 
 	TSharedRef<SWidget> BuildActorList();
 	TSharedRef<SWidget> BuildAssetList();
-	TSharedRef<ITableRow> GenerateActorRow(TSharedPtr<FString> InItem, const TSharedRef<STableViewBase>& OwnerTable);
-	TSharedRef<ITableRow> GenerateVoiceSoundAssetRow(TSharedPtr<FVoiceCultureAssetDisplayData> InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<ITableRow> GenerateActorRow(FSSVoiceDashboardActorList::FRow* InItem, const TSharedRef<STableViewBase>& OwnerTable);
+	TSharedRef<ITableRow> GenerateVoiceSoundAssetRow(const FVoiceCultureAssetDisplayData* InItem, const TSharedRef<STableViewBase>& OwnerTable);
 
-	TArray<TSharedPtr<FString>> AllActorItems;
-	TArray<TSharedPtr<FString>> FilteredActorItems;
-	TSharedPtr<SListView<TSharedPtr<FString>>> ActorListView;
+	/** Actor rows and name index, the list view only sees the filtered row pointers */
+	FSSVoiceDashboardActorList ActorList;
+	TSharedPtr<SListView<FSSVoiceDashboardActorList::FRow*>> ActorListView;
 
-	TSharedPtr<FString> SelectedActor;
+	FString SelectedActorName;
 
 	TSharedPtr<SSearchBox> ActorSearchBox;
 	FString ActorSearchFilter;
 
-	TArray<TSharedPtr<FAssetData>> FilteredAssetsForActor;
-	TSharedPtr<SListView<TSharedPtr<FAssetData>>> AssetListView;
-
 	void RefreshActorFilter();
 	void RefreshAssetsForSelectedActor();
 	
 	/**
 	 * Loads the list of voice actors from a saved JSON file and populates the Actor list UI.
 	 * The JSON file is expected to be an array of strings, e.g. ["NPC01", "Hero", "EnemyBoss"]
+	 * Per-actor details are then filled progressively by UpdateActorListProgressive, once the voice asset
+	 * registry query (run on the thread pool, on-disk assets only) returns.
 	 */
 	void LoadActorListFromJson();
 
+	/** Deferred actor list load (after the first paint) and progressive detail fill */
+	EActiveTimerReturnType UpdateActorListProgressive(double InCurrentTime, float InDeltaTime);
+
+	/** Registers UpdateActorListProgressive if not already running */
+	void RequestActorListUpdate();
+
+	bool bActorListLoaded = false;
+	bool bActorListTimerActive = false;
+
+	/** Latest registry query started by LoadActorListFromJson, older results are dropped */
+	int32 ActorAssetsQueryId = 0;
+
 	// ------------------------
 	// Voice Actor Tab - Filters
 	// ------------------------
 
 	FARFilter Filter;
+
+	/** Fuzzy line search, narrows Filter to the matching voice assets */
+	FString LineSearchFilter;
+	void RefreshLineFilter();
+
+	/** Applies the searches again once the voice asset index finished building in the background */
+	EActiveTimerReturnType RefreshSearchesWhenIndexReady(double InCurrentTime, float InDeltaTime);
+	bool bSearchRefreshPending = false;
 	FSetARFilterDelegate DelegateFilter;
 	FRefreshAssetViewDelegate DelegateRefreshView;
 	FGetCurrentSelectionDelegate DelegateSelection;
@@ -159,6 +211,23 @@ protected:
 	// Toolbar
 	// ------------------------
 	TSharedRef<SWidget> BuildToolbar();
+
+	// ------------------------
+	// Background jobs (progress strip under the toolbar)
+	// ------------------------
+
+	TSharedRef<SWidget> BuildJobProgressStrip();
+
+	/** Starts a job on the editor subsystem, notifies if another one is running. */
+	bool StartJob(const TSharedRef<FSSVoiceCultureJob>& Job);
+
+	/** False while a job runs, used to disable bulk operation buttons. */
+	bool CanStartJob() const;
+
+	EVisibility GetJobProgressVisibility() const;
+	TOptional<float> GetJobProgress() const;
+	FText GetJobStatusText() const;
+	FReply OnClick_CancelJob();
 	
 	// ------------------------
 	// Tab Management
@@ -0,0 +1,97 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+class USSVoiceCultureStrategy;
+
+/**
+ * Index-driven model behind the dashboard's voice actor list.
+ *
+ * Rows live in one stable array and the list view only receives pointers to the filtered rows,
+ * so no per-row allocation happens and Slate only builds widgets for the visible ones.
+ * Per-actor details (line count, complete lines) are filled progressively from the registry
+ * after the list is shown, see FillDetails.
+ */
+class SSVOICECULTUREEDITOR_API FSSVoiceDashboardActorList
+{
+public:
+	/** One voice actor */
+	struct FRow
+	{
+		FString Name;
+
+		/** Precomputed for search */
+		FString NameLower;
+
+		/** Voice assets of this actor, INDEX_NONE until details are filled */
+		int32 NumAssets = INDEX_NONE;
+
+		/** Voice assets having every supported culture */
+		int32 NumComplete = 0;
+
+		bool HasDetails() const { return NumAssets != INDEX_NONE; }
+	};
+
+	/** Replaces all rows (row pointers from before become invalid) and re-applies the search. */
+	void SetNames(TArray<FString>&& Names);
+
+	/**
+	 * Filters rows by case-insensitive substring.
+	 * When the new text extends the previous one, only the current results are scanned again.
+	 */
+	void SetSearch(const FString& InSearch);
+
+	/**
+	 * Shows the given actors in the given order (e.g. ranked search results), unknown names are skipped.
+	 * The next SetSearch rebuilds the list from every row.
+	 */
+	void SetRankedFilter(const TArray<FString>& RankedNames);
+
+	/** Filtered rows, used as the list view items source */
+	const TArray<FRow*>& GetFiltered() const { return Filtered; }
+	TArray<FRow*>& GetFiltered() { return Filtered; }
+
+	FRow* FindRow(const FString& Name);
+
+	int32 Num() const { return Rows.Num(); }
+
+	/**
+	 * Starts progressive detail filling: the voice assets are parsed a few at a time by FillDetails.
+	 * Details of previous rows are reset.
+	 */
+	void BeginFillDetails(USSVoiceCultureStrategy* InStrategy, TArray<FAssetData>&& VoiceAssets, int32 InNumCultures);
+
+	/**
+	 * Parses pending voice assets until the time budget is spent.
+	 *
+	 * @return true once every voice asset has been processed.
+	 */
+	bool FillDetails(double TimeBudgetSeconds);
+
+	bool IsFillingDetails() const { return PendingAssets.Num() > 0; }
+
+private:
+	void RebuildFiltered();
+
+	TArray<FRow> Rows;
+	TMap<FString, int32> RowIndexByName;
+	TArray<FRow*> Filtered;
+
+	FString SearchLower;
+
+	/** Filtered holds ranked results instead of substring matches */
+	bool bRankedFilter = false;
+
+	// Progressive detail fill
+	TWeakObjectPtr<USSVoiceCultureStrategy> Strategy;
+	TArray<FAssetData> PendingAssets;
+	int32 PendingCursor = 0;
+	int32 NumCultures = 0;
+};
@@ -9,6 +9,7 @@
 #include "CoreMinimal.h"
 #include "EdGraphUtilities.h"
 #include "Modules/ModuleManager.h"
+#include "SSVoiceCultureEditorTypes.h"
 #include "Slate/SSVoiceCultureSlateComponents.h"
 #include "SSVoiceCultureEditor.generated.h"
 
@@ -43,6 +44,17 @@ public:
     
     TSharedRef<SDockTab> SpawnVoiceDashboardTab(const FSpawnTabArgs& Args);
 
+    /** Content Browser folder menu: migration of the selected folders to a voice table or banks */
+    TSharedRef<FExtender> ExtendFolderContextMenu(const TArray<FString>& SelectedPaths);
+    void MigrateFolders(TArray<FString> SelectedPaths, ESSVoiceCultureMigrationFormat Format);
+
+    /** Content Browser asset menu: voice culture assets using the selected culture sounds */
+    TSharedRef<FExtender> ExtendAssetContextMenu(const TArray<FAssetData>& SelectedAssets);
+    void FindCultureSoundOwners(TArray<FAssetData> SelectedAssets);
+
 private:
     TSharedPtr<FSSVoiceCultureGraphNodeFactory> VoiceCultureGraphNodeFactory;
+
+    FDelegateHandle FolderContextMenuExtenderHandle;
+    FDelegateHandle AssetContextMenuExtenderHandle;
 };
@@ -12,8 +12,14 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Settings/SSVoiceCultureStrategy.h"
 #include "Subsystems/EngineSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Utils/SSVoiceCultureIngestService.h"
+#include "Utils/SSVoiceCultureOwnerIndex.h"
+#include "Utils/SSVoiceCultureSearchIndex.h"
 #include "SSVoiceCultureEditorSubsystem.generated.h"
 
+class FSSVoiceCultureJob;
+
 /**
  * Editor subsystem responsible for managing voice culture editor tools and settings.
  *
@@ -43,8 +49,9 @@ public:
 	 * Will refresh internal strategy and update editor behavior accordingly.
 	 *
 	 * @param ProfileName The name of the profile to activate.
+	 * @param bPersist    If false, the selection is not saved to the user config (e.g. commandlet override).
 	 */
-	void ChangeActiveProfileFromName(FString ProfileName);
+	void ChangeActiveProfileFromName(FString ProfileName, bool bPersist = true);
 
 	
 	/**
@@ -136,8 +143,152 @@ public:
 	 * Used to extend or filter the content browser based on voice-related workflows.
 	 */
 	static FContentBrowserModule& GetVoiceContentBrowser();
+
+	// ------------------------
+	// Background jobs
+	// ------------------------
+
+	/**
+	 * Starts a non-modal background job. Only one job runs at a time.
+	 *
+	 * @return false if another job is already running.
+	 */
+	bool StartJob(const TSharedRef<FSSVoiceCultureJob>& Job);
+
+	/** Requests cancellation of the running job, if any. */
+	void CancelActiveJob();
+
+	bool IsJobRunning() const { return ActiveJob.IsValid(); }
+
+	/** The running job, or null. */
+	TSharedPtr<FSSVoiceCultureJob> GetActiveJob() const { return ActiveJob; }
+
+	/** Broadcast when a job starts or finishes. */
+	FSimpleMulticastDelegate OnJobStateChanged;
+
+	// ------------------------
+	// Voice asset index
+	// ------------------------
+
+	/**
+	 * Ranked fuzzy search over the voice actors, line suffixes and culture codes of every voice culture asset.
+	 * Returns nothing until the index is built (see BuildVoiceAssetIndexAsync), it is then kept in sync with
+	 * the asset registry.
+	 *
+	 * @param Query       Text typed by the user (partial IDs and typos are tolerated).
+	 * @param Kinds       Kinds of results to return.
+	 * @param MaxResults  Maximum number of results, best first.
+	 */
+	void SearchVoiceAssets(const FString& Query, ESSVoiceSearchKind Kinds, int32 MaxResults,
+	                       TArray<FSSVoiceSearchResult>& OutResults);
+
+	/**
+	 * Starts building the voice asset index on the thread pool if not built yet (e.g. when the dashboard opens).
+	 * The registry is queried on the game thread first, the worker only parses the asset names.
+	 * Blueprint strategies extract actor names on the game thread once the worker returns.
+	 */
+	void BuildVoiceAssetIndexAsync();
+
+	bool IsVoiceAssetIndexReady() const { return bVoiceAssetIndexBuilt; }
+
+	/** Rebuilds the voice asset index on the next search (e.g. after a profile change). */
+	void InvalidateVoiceAssetIndex();
+
+	// ------------------------
+	// Culture sound owners
+	// ------------------------
+
+	/**
+	 * Voice culture assets using a culture sound, from the registry dependencies (nothing is loaded).
+	 * The index is built on first use, then kept in sync with the asset registry. Unsaved references are not seen.
+	 */
+	UFUNCTION(BlueprintCallable, Category="Voice Culture")
+	TArray<FSSVoiceCultureSoundOwner> GetCultureSoundOwners(const FSoftObjectPath& SoundPath);
+
+	/** GetCultureSoundOwners for many sounds at once, OutOwners holds the owners of every sound (see FSSVoiceCultureSoundOwner::Sound). */
+	UFUNCTION(BlueprintCallable, Category="Voice Culture")
+	void GetCultureSoundOwnersBatch(const TArray<FSoftObjectPath>& SoundPaths, TArray<FSSVoiceCultureSoundOwner>& OutOwners);
+
+	/** False while the initial registry scan runs, owners are then unknown. */
+	UFUNCTION(BlueprintCallable, Category="Voice Culture")
+	bool IsCultureSoundOwnerIndexReady();
+
+	/** Rebuilds the culture sound owner index on the next query (e.g. after a profile change). */
+	void InvalidateCultureSoundOwnerIndex();
+
+	// ------------------------
+	// Vendor watch folders
+	// ------------------------
+
+	/** Imports the audio files dropped in the watch folders of the editor settings and links them to their lines. */
+	FSSVoiceCultureIngestService& GetIngestService() { return IngestService; }
 	
 private:
+
+	void EnsureCultureSoundOwnerIndex();
+
+	FSSVoiceCultureOwnerIndex CultureSoundOwnerIndex;
+
+	bool bCultureSoundOwnerIndexBuilt = false;
+
+	FSSVoiceCultureIngestService IngestService;
+
+	void HandleEditorSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent);
+
+	void IndexVoiceAsset(const FAssetData& AssetData);
+	void UnindexVoiceAsset(const FSoftObjectPath& AssetPath);
+
+	void HandleAssetAdded(const FAssetData& AssetData);
+	void HandleAssetRemoved(const FAssetData& AssetData);
+	void HandleAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void HandleAssetUpdated(const FAssetData& AssetData);
+
+	/** Indexed voice asset -> its line document and voice actor */
+	struct FIndexedVoiceAsset
+	{
+		int32 LineDocument = INDEX_NONE;
+		FString LineText;
+		FString ActorName;
+	};
+
+	/** Search documents and the ids they were given, plain data so a worker can build it */
+	struct FVoiceAssetIndex
+	{
+		FSSVoiceCultureSearchIndex Search;
+
+		TMap<FSoftObjectPath, FIndexedVoiceAsset> Assets;
+
+		/** Voice actor -> its document and number of indexed voice assets */
+		TMap<FString, TPair<int32, int32>> Actors;
+
+		TSet<FString> Cultures;
+
+		void AddAsset(const FSoftObjectPath& AssetPath, const FString& LineText, const FString& ActorName);
+		void SetActor(const FSoftObjectPath& AssetPath, const FString& ActorName);
+		void RemoveAsset(const FSoftObjectPath& AssetPath);
+		void AddCulture(const FString& Culture);
+	};
+
+	/** Swaps in the index built by the worker and applies the registry changes it missed */
+	void FinishVoiceAssetIndexBuild(FVoiceAssetIndex&& Index, const TArray<FAssetData>& VoiceAssets,
+	                                bool bResolveActors, double StartTime);
+
+	FVoiceAssetIndex VoiceAssetIndex;
+
+	bool bVoiceAssetIndexBuilt = false;
+	bool bVoiceAssetIndexBuilding = false;
+
+	/** Bumped by InvalidateVoiceAssetIndex, a worker result of an older generation is dropped */
+	int32 VoiceAssetIndexGeneration = 0;
+
+	/** Voice assets added, saved or removed while the worker builds the index */
+	TSet<FSoftObjectPath> PendingVoiceAssetChanges;
+
+	bool TickActiveJob(float DeltaTime);
+
+	TSharedPtr<FSSVoiceCultureJob> ActiveJob;
+
+	FTSTicker::FDelegateHandle JobTickerHandle;
 	
 	/** Cached pointer to the active voice strategy. */
 	UPROPERTY(Transient)
@@ -7,8 +7,10 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "UObject/Object.h"
 #include "Settings/SSVoiceCultureStrategy.h"
+#include "Sound/SoundWave.h"
 #include "SSVoiceCultureEditorTypes.generated.h"
 
 class USSVoiceCultureStrategy;
@@ -25,6 +27,89 @@ struct FSSVoiceStrategyProfile
 	TSoftClassPtr<USSVoiceCultureStrategy> StrategyClass;
 };
 
+/** Sample rate of the culture sounds up to a duration */
+USTRUCT(BlueprintType)
+struct FSSVoiceCultureSampleRateBucket
+{
+	GENERATED_BODY()
+
+	/** Sounds up to this duration (seconds) use this bucket, the first matching bucket wins */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture", meta = (ClampMin = "0", Units = "s"))
+	float MaxDuration = 5.f;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	ESoundwaveSampleRateSettings SampleRate = ESoundwaveSampleRateSettings::High;
+};
+
+/**
+ * A vendor delivery folder on disk whose audio files all belong to one culture
+ * (see FSSVoiceCultureIngestService). Sub-directories are watched too.
+ */
+USTRUCT(BlueprintType)
+struct FSSVoiceCultureWatchFolder
+{
+	GENERATED_BODY()
+
+	/** Culture of every file dropped in the folder (e.g. "fr") */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	FString Culture;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	FDirectoryPath SourceDirectory;
+
+	/** Content folder the culture sounds are imported into (e.g. /Game/Dialogue/Audio/fr) */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture", meta = (ContentDir))
+	FDirectoryPath DestinationPath;
+};
+
+/**
+ * Compression and loading settings applied to the culture sounds of one culture
+ * (see FSSVoiceCultureUtils::ApplyCultureAudioProfiles). Unchecked settings are left as imported.
+ */
+USTRUCT(BlueprintType)
+struct FSSVoiceCultureAudioProfile
+{
+	GENERATED_BODY()
+
+	/** Culture code (e.g. "fr"), "*" for every culture without a profile of its own */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	FString Culture;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture", meta = (InlineEditConditionToggle))
+	bool bOverrideCompressionQuality = false;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture", meta = (EditCondition = "bOverrideCompressionQuality", ClampMin = "1", ClampMax = "100"))
+	int32 CompressionQuality = 40;
+
+	UPROPERTY(EditAnywhere, Category = "Voice Culture", meta = (InlineEditConditionToggle))
+	bool bOverrideLoadingBehavior = false;
+
+	/** Streaming and retain-on-load behavior, e.g. LoadOnDemand for rarely played cultures */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture", meta = (EditCondition = "bOverrideLoadingBehavior"))
+	ESoundWaveLoadingBehavior LoadingBehavior = ESoundWaveLoadingBehavior::LoadOnDemand;
+
+	/** Sample rate by duration, sounds longer than every bucket keep their sample rate */
+	UPROPERTY(EditAnywhere, Category = "Voice Culture")
+	TArray<FSSVoiceCultureSampleRateBucket> SampleRateBuckets;
+};
+
+/** A voice culture asset using a culture sound (see USSVoiceCultureEditorSubsystem::GetCultureSoundOwners) */
+USTRUCT(BlueprintType)
+struct FSSVoiceCultureSoundOwner
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Voice Culture")
+	FSoftObjectPath Sound;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Voice Culture")
+	FSoftObjectPath VoiceAsset;
+
+	/** Culture parsed from the sound name by the active strategy, empty if the name does not follow it */
+	UPROPERTY(BlueprintReadOnly, Category = "Voice Culture")
+	FString Culture;
+};
+
 /**
  * One culture scan result
  */
@@ -63,4 +148,506 @@ struct FSSVoiceCultureReport
 	/** Timestamp of generation */
 	UPROPERTY()
 	FDateTime GeneratedAt;
-};
\ No newline at end of file
+};
+
+/**
+ * Tuning for batched voice culture operations (auto-populate, scans).
+ * Shared by the dashboard, the commandlet and any headless caller.
+ */
+USTRUCT()
+struct FSSVoiceCultureBatchOptions
+{
+	GENERATED_BODY()
+
+	/** Number of parallel chunks for worker-safe phases (name parsing, matching). 0 = one per task graph worker. */
+	UPROPERTY()
+	int32 NumWorkers = 0;
+
+	/** Number of voice assets loaded and modified before the batch is flushed (saved, then optionally collected). */
+	UPROPERTY()
+	int32 BatchSize = 256;
+
+	/** Show slow task dialogs and toast notifications. Disabled for headless runs. */
+	UPROPERTY()
+	bool bInteractive = true;
+
+	/** Save modified packages even if bAutoSaveAfterAutoPopulate is disabled in the editor settings. */
+	UPROPERTY()
+	bool bForceSave = false;
+
+	/** Never save modified packages, overrides bForceSave and bAutoSaveAfterAutoPopulate (dry runs, CI). */
+	UPROPERTY()
+	bool bNoSave = false;
+
+	/** Run garbage collection after each saved batch to keep memory bounded on large projects. */
+	UPROPERTY()
+	bool bCollectGarbageBetweenBatches = false;
+
+	/** Returns how many parallel chunks to split NumItems into. */
+	int32 GetNumChunks(int32 NumItems) const
+	{
+		const int32 Workers = NumWorkers > 0 ? NumWorkers : FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+		return FMath::Clamp(NumItems, 1, Workers);
+	}
+};
+
+/**
+ * Counters and timing breakdown (in seconds) of one batched operation.
+ */
+USTRUCT()
+struct FSSVoiceCultureOperationStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Operation;
+
+	UPROPERTY()
+	int32 AssetsScanned = 0;
+
+	UPROPERTY()
+	int32 AssetsMatched = 0;
+
+	UPROPERTY()
+	int32 AssetsModified = 0;
+
+	UPROPERTY()
+	int32 PackagesSaved = 0;
+
+	/** Registry queries */
+	UPROPERTY()
+	double ScanSeconds = 0.0;
+
+	/** Strategy name matching (worker-safe) */
+	UPROPERTY()
+	double MatchSeconds = 0.0;
+
+	/** Loading and modifying voice assets (game thread) */
+	UPROPERTY()
+	double ApplySeconds = 0.0;
+
+	UPROPERTY()
+	double SaveSeconds = 0.0;
+
+	UPROPERTY()
+	double TotalSeconds = 0.0;
+};
+
+/** Target representation of a voice line migration */
+UENUM()
+enum class ESSVoiceCultureMigrationFormat : uint8
+{
+	/** One voice table for all migrated lines, the voice assets become redirects to their row */
+	Table,
+
+	/** One voice bank per folder, the voice assets keep their cultures and resolve from the bank when cooked */
+	Bank,
+};
+
+/** A voice asset left as is by a migration */
+USTRUCT()
+struct FSSVoiceCultureMigrationSkip
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Asset;
+
+	UPROPERTY()
+	FString Reason;
+};
+
+/**
+ * Outcome of a voice line migration, written to Saved/SSVoiceCulture/MigrationReport.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureMigrationReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Format;
+
+	/** Tables or banks written */
+	UPROPERTY()
+	TArray<FString> Targets;
+
+	/** Voice assets now resolving from a target */
+	UPROPERTY()
+	TArray<FString> Migrated;
+
+	UPROPERTY()
+	TArray<FSSVoiceCultureMigrationSkip> Skipped;
+
+	/** Voice assets whose line ID is already a row of the table owned by another asset, left as is */
+	UPROPERTY()
+	TArray<FString> Conflicts;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+
+	void AddSkipped(const FString& Asset, const FString& Reason)
+	{
+		FSSVoiceCultureMigrationSkip& Skip = Skipped.AddDefaulted_GetRef();
+		Skip.Asset = Asset;
+		Skip.Reason = Reason;
+	}
+};
+
+/** Culture sounds with identical PCM data */
+USTRUCT()
+struct FSSVoiceCultureDuplicateCluster
+{
+	GENERATED_BODY()
+
+	/** Sound every reference is pointed at when the cluster is applied (first path in lexical order) */
+	UPROPERTY()
+	FString Canonical;
+
+	UPROPERTY()
+	TArray<FString> Duplicates;
+
+	/** Voice assets and table columns referencing one of the duplicates */
+	UPROPERTY()
+	TArray<FString> Referencers;
+
+	/** PCM size of one copy */
+	UPROPERTY()
+	int64 NumBytes = 0;
+};
+
+/**
+ * Result of the duplicate culture sound analysis, written to Saved/SSVoiceCulture/DuplicateSounds.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureDedupReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 SoundsHashed = 0;
+
+	/** Sounds whose hash came from the cache (package unchanged since the last analysis) */
+	UPROPERTY()
+	int32 CacheHits = 0;
+
+	/** PCM bytes saved if every cluster is applied and its duplicates deleted */
+	UPROPERTY()
+	int64 DuplicateBytes = 0;
+
+	UPROPERTY()
+	TArray<FSSVoiceCultureDuplicateCluster> Clusters;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/** Loudness summary of one culture against the reference culture */
+USTRUCT()
+struct FSSVoiceCultureLoudnessCulture
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Culture;
+
+	/** Culture sounds with an analysis */
+	UPROPERTY()
+	int32 Analyzed = 0;
+
+	/** Lines whose loudness differs from the reference culture by more than the tolerance */
+	UPROPERTY()
+	int32 Deviating = 0;
+
+	/** Mean loudness difference to the reference culture (LU), over the lines the reference has */
+	UPROPERTY()
+	float MeanDeviation = 0.f;
+
+	/** Silence removed by trimming every sound of this culture (seconds, padding kept) */
+	UPROPERTY()
+	float TrimmableSeconds = 0.f;
+};
+
+/** Culture sound whose loudness deviates from the reference culture of its line */
+USTRUCT()
+struct FSSVoiceCultureLoudnessFlag
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Asset;
+
+	UPROPERTY()
+	FString Culture;
+
+	/** Loudness minus the reference culture's (LU) */
+	UPROPERTY()
+	float Deviation = 0.f;
+};
+
+/**
+ * Loudness and silence of the culture sounds, written to Saved/SSVoiceCulture/LoudnessReport.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureLoudnessReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString ReferenceCulture;
+
+	UPROPERTY()
+	float ToleranceLU = 0.f;
+
+	UPROPERTY()
+	TArray<FSSVoiceCultureLoudnessCulture> Cultures;
+
+	/** Largest deviations first */
+	UPROPERTY()
+	TArray<FSSVoiceCultureLoudnessFlag> Flagged;
+
+	/** Voice assets with at least one culture sound worth trimming */
+	UPROPERTY()
+	TArray<FString> Trimmable;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/** Culture sounds of one culture touched by ApplyCultureAudioProfiles, compressed sizes for the running platform */
+USTRUCT()
+struct FSSVoiceCultureAudioProfileCulture
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Culture;
+
+	UPROPERTY()
+	int32 Sounds = 0;
+
+	UPROPERTY()
+	int32 Modified = 0;
+
+	/** Compressed data already built for the platform */
+	UPROPERTY()
+	int64 BytesBefore = 0;
+
+	/** Estimated from the platform sample rates and compression quality of the profile, nothing is recompressed */
+	UPROPERTY()
+	int64 BytesAfter = 0;
+
+	/** Sounds whose compressed data was not built yet, left out of the byte counts */
+	UPROPERTY()
+	int32 UnknownSizes = 0;
+};
+
+/**
+ * Outcome of ApplyCultureAudioProfiles, written to Saved/SSVoiceCulture/AudioProfileReport.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureAudioProfileReport
+{
+	GENERATED_BODY()
+
+	/** False for a dry run: sounds that would change are counted, with the same size estimate as an applied run */
+	UPROPERTY()
+	bool bApplied = false;
+
+	UPROPERTY()
+	TArray<FSSVoiceCultureAudioProfileCulture> Cultures;
+
+	/** Sounds referenced under several cultures, given the profile of the first one found */
+	UPROPERTY()
+	TArray<FString> SharedSounds;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/** Culture sound no voice asset, table column or bank chunk references */
+USTRUCT()
+struct FSSVoiceCultureOrphanSound
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString Asset;
+
+	UPROPERTY()
+	FString Culture;
+
+	UPROPERTY()
+	FString Suffix;
+
+	/** Package size on disk (bytes) */
+	UPROPERTY()
+	int64 DiskSize = 0;
+
+	/** Other assets referencing it (e.g. a level or cue), these keep it in the cook */
+	UPROPERTY()
+	int32 OtherReferencers = 0;
+};
+
+/**
+ * Outcome of FindOrphanCultureSounds, written to Saved/SSVoiceCulture/OrphanSounds.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureOrphanReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FSSVoiceCultureOrphanSound> Orphans;
+
+	UPROPERTY()
+	int64 TotalDiskSize = 0;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/** One culture code change made by RenameCultureCodes (audit log entry) */
+USTRUCT()
+struct FSSVoiceCultureRenameAudit
+{
+	GENERATED_BODY()
+
+	/** Asset path, or the settings class for a settings value */
+	UPROPERTY()
+	FString Asset;
+
+	/** Renamed field (e.g. "VoiceCultures", "SupportedVoiceCultures") */
+	UPROPERTY()
+	FString Field;
+
+	UPROPERTY()
+	FString OldCulture;
+
+	UPROPERTY()
+	FString NewCulture;
+
+	/** False when the asset already had the new culture, the entry was then left as is */
+	UPROPERTY()
+	bool bApplied = true;
+};
+
+/**
+ * Outcome of RenameCultureCodes, written to Saved/SSVoiceCulture/CultureRename.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureRenameReport
+{
+	GENERATED_BODY()
+
+	/** Old culture code -> new culture code */
+	UPROPERTY()
+	TMap<FString, FString> Renames;
+
+	UPROPERTY()
+	TArray<FSSVoiceCultureRenameAudit> Changes;
+
+	UPROPERTY()
+	int32 Conflicts = 0;
+
+	/** False if the run was cancelled before the settings were updated */
+	UPROPERTY()
+	bool bSettingsUpdated = false;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/**
+ * Outcome of CreateMissingVoiceCultureWrappers, written to Saved/SSVoiceCulture/WrapperCreation.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureWrapperReport
+{
+	GENERATED_BODY()
+
+	/** False for a dry run, Created then lists the wrappers that would be created */
+	UPROPERTY()
+	bool bApplied = false;
+
+	/** Object paths of the created voice culture assets */
+	UPROPERTY()
+	TArray<FString> Created;
+
+	/** Wrapper paths already taken by another asset, left untouched */
+	UPROPERTY()
+	TArray<FString> Conflicts;
+
+	/** Culture entries pre-filled across the created wrappers */
+	UPROPERTY()
+	int32 NumEntries = 0;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/**
+ * Outcome of ImportVoiceCultureMappings, written to Saved/SSVoiceCulture/MappingImport.json.
+ */
+USTRUCT()
+struct FSSVoiceCultureMappingImportReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FString File;
+
+	/** False for a validation-only run */
+	UPROPERTY()
+	bool bApplied = false;
+
+	UPROPERTY()
+	int32 RowsRead = 0;
+
+	/** Rows with at least one rejected cell (unknown voice asset, sound or culture) */
+	UPROPERTY()
+	int32 RowsInvalid = 0;
+
+	/** Culture entries added or pointed at another sound */
+	UPROPERTY()
+	int32 EntriesChanged = 0;
+
+	UPROPERTY()
+	int32 NumErrors = 0;
+
+	/** First errors as "line N: message", capped so huge files keep a small report */
+	UPROPERTY()
+	TArray<FString> Errors;
+
+	UPROPERTY()
+	FSSVoiceCultureOperationStats Stats;
+};
+
+/**
+ * One voice culture asset and the culture sounds matched for it, built from registry data only.
+ */
+struct FSSVoiceCultureAutoPopulateItem
+{
+	/** The USSVoiceCultureSound to modify */
+	FAssetData VoiceAsset;
+
+	/** Matched culture sounds, keyed by lowercase culture code */
+	TMap<FString, FSoftObjectPath> CultureSounds;
+};
+
+/**
+ * Culture sound of a line whose duration is off the reference culture's, found from the "VoiceDurations" registry tag.
+ */
+struct FSSVoiceCultureDurationMismatch
+{
+	FAssetData VoiceAsset;
+
+	/** Lowercase culture code */
+	FString Culture;
+
+	float ReferenceDuration = 0.f;
+	float Duration = 0.f;
+
+	/** Duration over the reference duration, above 1 when the culture is longer */
+	float GetRatio() const { return ReferenceDuration > 0.f ? Duration / ReferenceDuration : 0.f; }
+};
@@ -9,6 +9,7 @@
 #include "CoreMinimal.h"
 #include "SSVoiceCultureEditorStyle.h"
 #include "SSVoiceCultureSound.h"
+#include "Containers/Ticker.h"
 #include "Toolkits/AssetEditorToolkit.h"
 
 class USSVoiceCultureGraphNode;
@@ -61,6 +62,8 @@ public:
 class SSVOICECULTUREEDITOR_API FSSVoiceCultureSoundEditorToolkit : public FAssetEditorToolkit, public FNotifyHook
 {
 public:
+	virtual ~FSSVoiceCultureSoundEditorToolkit() override;
+
 	void Init(USSVoiceCultureSound* InAsset, const EToolkitMode::Type Mode, const TSharedPtr<IToolkitHost>& InitToolkitHost);
 
 	// FAssetEditorToolkit interface
@@ -84,8 +87,29 @@ private:
 	static const FName DetailsTabID;
 	static const FName GraphTabID;
 
+	/**
+	 * Refreshes only the nodes whose culture entry changed since the last refresh.
+	 * Nodes are transient views of the asset, so nothing goes through the undo buffer.
+	 */
 	void RefreshGraphEditor();
 	void OnDetailsChanged(const FPropertyChangedEvent& InEvent);
+
+	/** Culture (lowercase) -> sound path, as currently displayed by the nodes */
+	void SnapshotCultureEntries(TMap<FString, FSoftObjectPath>& OutEntries) const;
+	TMap<FString, FSoftObjectPath> DisplayedEntries;
+
+	/** One slot per supported culture, the node is only created once its slot gets on screen */
+	struct FCultureSlot
+	{
+		FString Culture;
+		TWeakObjectPtr<USSVoiceCultureGraphNode> Node;
+	};
+	TArray<FCultureSlot> CultureSlots;
+
+	/** Creates the nodes of the slots inside the graph view, returns true once every slot has its node */
+	bool CreateVisibleNodes();
+	bool TickDeferredNodes(float DeltaTime);
+	FTSTicker::FDelegateHandle DeferredNodesTickerHandle;
 	
 	/** Binds new graph commands to delegates */
 	void BindGraphCommands();
@@ -62,4 +62,67 @@ public:
 
 	UPROPERTY(EditAnywhere, Config, Category="Voice Culture")
 	bool bAutoPopulateOverwriteExisting = false;
+
+	/**
+	 * Game thread time (in milliseconds) given each frame to dashboard background jobs
+	 * (loading, modifying and saving assets). Lower keeps the editor smoother, higher finishes sooner.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Performance", meta=(ClampMin="1", ClampMax="100"))
+	float BackgroundJobFrameBudgetMs = 8.f;
+
+	/** Number of modified assets saved together by background jobs (when auto-save is enabled). */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Performance", meta=(ClampMin="1"))
+	int32 BackgroundJobSaveBatchSize = 64;
+
+	/** Culture every other culture is compared to, line by line (loudness, duration). */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Analysis")
+	FString ReferenceCulture = TEXT("en");
+
+	/**
+	 * A line is flagged when a culture sound is this many times longer (or shorter) than the reference culture's,
+	 * e.g. 1.3 flags a 2 s line recorded in 2.7 s or 1.5 s.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Analysis", meta=(ClampMin="1.01"))
+	float DurationMismatchRatio = 1.3f;
+
+	/** A culture sound is flagged when its integrated loudness differs from the reference culture by more than this (LU). */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Loudness", meta=(ClampMin="0.1"))
+	float LoudnessToleranceLU = 2.f;
+
+	/** Samples quieter than this (dBFS) count as silence at the start and end of a culture sound. */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Loudness", meta=(ClampMin="-120", ClampMax="0"))
+	float SilenceThresholdDb = -50.f;
+
+	/** Silence kept on each side when trimming, so consonant attacks and breath tails are not cut. */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Loudness", meta=(ClampMin="0", Units="s"))
+	float TrimPaddingSeconds = 0.05f;
+
+	/**
+	 * Compression and loading settings per culture, applied to the culture sounds with the dashboard or
+	 * -run=SSVoiceCulture -Mode=AudioProfiles. Typically lower quality and load on demand for secondary cultures.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Audio Profiles", meta=(TitleProperty="Culture"))
+	TArray<FSSVoiceCultureAudioProfile> CultureAudioProfiles;
+
+
+	/**
+	 * Imports new or changed audio files of the watch folders as they arrive, named after the active strategy,
+	 * and links them to the matching voice culture assets. Saving the linked assets follows bAutoSaveAfterAutoPopulate.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Ingest")
+	bool bEnableWatchFolders = false;
+
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Ingest", meta=(TitleProperty="Culture", EditCondition="bEnableWatchFolders"))
+	TArray<FSSVoiceCultureWatchFolder> WatchFolders;
+
+	/** Prefix of the imported sound names when the file name does not follow the strategy already (e.g. "A" → "A_fr_NPC01_Hello") */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Ingest", meta=(EditCondition="bEnableWatchFolders"))
+	FString IngestAssetPrefix = TEXT("A");
+
+	/** Quiet time after the last file change before a delivery is imported, so files still being copied are not read. */
+	UPROPERTY(EditAnywhere, Config, Category="Voice Culture|Ingest", meta=(ClampMin="0.1", Units="s", EditCondition="bEnableWatchFolders"))
+	float IngestSettleSeconds = 2.f;
+
+	/** Profile of a culture (case-insensitive), else the "*" profile, else nullptr. */
+	const FSSVoiceCultureAudioProfile* FindCultureAudioProfile(const FString& Culture) const;
 };
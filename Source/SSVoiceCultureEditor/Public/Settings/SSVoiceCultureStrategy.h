@@ -27,7 +27,7 @@ class SSVOICECULTUREEDITOR_API USSVoiceCultureStrategy : public UObject
 {
 	GENERATED_BODY()
 
-protected:
+public:
 	/**
 	 * Builds the expected asset suffix for a given culture and suffix.
 	 * Each strategy can override this to define its naming convention.
@@ -51,7 +51,33 @@ protected:
 	virtual bool ParseAssetName(const FString& AssetName, FString& OutPrefix, FString& OutCulture,
 	                            FString& OutSuffix) const;
 
-public:
+	/**
+	 * Extracts the line suffix from a voice culture asset name (e.g. "LVA_NPC01_Hello" → "NPC01_Hello").
+	 * Name-only, safe to call from worker threads.
+	 *
+	 * @return The suffix, or an empty string if the name does not follow the strategy's pattern.
+	 */
+	virtual FString ExtractSuffixFromBaseName(const FString& BaseName) const;
+
+	/**
+	 * Builds the voice culture asset name of a line suffix, the inverse of ExtractSuffixFromBaseName
+	 * (e.g. "NPC01_Hello" → "LVA_NPC01_Hello"). Name-only, safe to call from worker threads.
+	 *
+	 * @return The asset name, or an empty string if the strategy does not define one.
+	 */
+	virtual FString BuildVoiceAssetName(const FString& Suffix) const;
+
+	/**
+	 * Parses a culture sound from its registry data into culture code and line suffix.
+	 * Voice culture assets themselves are rejected. Name-only, safe to call from worker threads.
+	 *
+	 * @param AssetData     The registry entry of a USoundBase asset (e.g. "A_EN_NPC01_Hello").
+	 * @param OutCulture    The extracted culture code, lowercase (e.g. "en").
+	 * @param OutSuffix     The line suffix (e.g. "NPC01_Hello").
+	 * @return true if the asset follows the strategy's culture naming rule.
+	 */
+	virtual bool ParseCultureSoundAsset(const FAssetData& AssetData, FString& OutCulture, FString& OutSuffix) const;
+
 	/**
 	 * Returns a short description of the pattern used by this strategy to match voice cultures.
 	 * This is used for UI feedback in dashboards or tooltips.
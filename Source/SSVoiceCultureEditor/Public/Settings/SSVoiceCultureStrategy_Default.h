@@ -19,7 +19,7 @@ class SSVOICECULTUREEDITOR_API USSVoiceCultureStrategy_Default : public USSVoice
 {
 	GENERATED_BODY()
 
-protected:
+public:
 
 	virtual FString BuildExpectedAssetSuffix(const FString& CultureCode, const FString& BaseSuffix) const override;
 	
@@ -27,7 +27,10 @@ protected:
 	 * Extracts the suffix portion of a base asset name by removing the prefix and culture code.
 	 * Example: "A_EN_NPC01_Scene01" → "NPC01_Scene01"
 	 */
-	virtual FString ExtractSuffixFromBaseName(const FString& BaseName) const;
+	virtual FString ExtractSuffixFromBaseName(const FString& BaseName) const override;
+
+	/** VoiceAssetPrefix + "_" + suffix (e.g. "NPC01_Scene01" → "LVA_NPC01_Scene01") */
+	virtual FString BuildVoiceAssetName(const FString& Suffix) const override;
 
 	/**
 	 * Parses an asset name into its prefix, culture code, and suffix components.
@@ -40,12 +43,21 @@ protected:
 	 * @return true if the name was successfully parsed; false otherwise.
 	 */
 	virtual bool ParseAssetName(const FString& AssetName, FString& OutPrefix, FString& OutCulture, FString& OutSuffix) const override;
+
+	/** Same as the base rule, restricted to AllowedPrefixes when any are set. */
+	virtual bool ParseCultureSoundAsset(const FAssetData& AssetData, FString& OutCulture, FString& OutSuffix) const override;
+
+	/** Returns true if the prefix passes the AllowedPrefixes rule (always true when the list is empty). */
+	bool IsAllowedPrefix(const FString& Prefix) const;
 	
-public:
 	/** Culture code is expected at this index (e.g., 1 for "LVA_en_MyLine") */
 	UPROPERTY(EditAnywhere, Category = "Strategy")
 	int32 CultureIndex = 1;
 
+	/** Prefix of the voice culture assets created for new lines (the part ExtractSuffixFromBaseName drops) */
+	UPROPERTY(EditAnywhere, Category = "Strategy")
+	FString VoiceAssetPrefix = TEXT("LVA");
+
 	/** Allow filtering based on prefixes (optional) */
 	UPROPERTY(EditAnywhere, Category = "Strategy")
 	TArray<FString> AllowedPrefixes;
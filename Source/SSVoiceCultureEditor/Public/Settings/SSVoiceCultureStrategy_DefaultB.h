@@ -18,12 +18,11 @@ class SSVOICECULTUREEDITOR_API USSVoiceCultureStrategy_DefaultB : public USSVoic
 {
 	GENERATED_BODY()
 
-protected:
+public:
 
 	virtual FString BuildExpectedAssetSuffix(const FString& CultureCode, const FString& BaseSuffix) const override;
 	virtual bool ParseAssetName(const FString& AssetName, FString& OutPrefix, FString& OutCulture, FString& OutSuffix) const override;
-	
-public:
+
 	virtual FText DisplayMatchCultureRulePattern_Implementation() const override;
 	virtual FText DisplayMatchCultureRulePatternExample_Implementation() const override;
 };
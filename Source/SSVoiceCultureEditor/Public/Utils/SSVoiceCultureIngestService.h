@@ -0,0 +1,74 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SSVoiceCultureEditorTypes.h"
+#include "Containers/Ticker.h"
+#include "Misc/SecureHash.h"
+
+struct FFileChangeData;
+
+/**
+ * Watches the vendor delivery folders of the editor settings (one culture each) with the DirectoryWatcher.
+ * Changed audio files are collected until the folder is quiet for IngestSettleSeconds, then imported in one batch
+ * under the active strategy's naming and linked to the voice culture assets of their lines only.
+ * Owned by USSVoiceCultureEditorSubsystem.
+ */
+class SSVOICECULTUREEDITOR_API FSSVoiceCultureIngestService
+{
+public:
+	~FSSVoiceCultureIngestService();
+
+	/**
+	 * (Re)registers one watcher per configured folder. Does nothing unless bEnableWatchFolders is set.
+	 * Files still pending are kept when their folder is still configured.
+	 */
+	void Start();
+
+	/** Unregisters the watchers and drops the pending files. */
+	void Stop();
+
+	bool IsWatching() const { return Watches.Num() > 0; }
+
+	/** Number of changed files waiting for the folders to settle */
+	int32 NumPendingFiles() const { return PendingFiles.Num(); }
+
+	/** Imports and links the pending files now, without waiting for the folders to settle. */
+	void Flush();
+
+private:
+	void HandleDirectoryChanged(const TArray<FFileChangeData>& Changes, int32 FolderIndex);
+
+	/** Unregisters the watchers and the ticker, pending files are left as is */
+	void Unwatch();
+
+	bool Tick(float DeltaTime);
+
+	struct FWatch
+	{
+		FString Directory;
+		FDelegateHandle Handle;
+	};
+	TArray<FWatch> Watches;
+
+	/** Settings snapshot taken by Start, indexed by the watcher callbacks */
+	TArray<FSSVoiceCultureWatchFolder> Folders;
+
+	/** Changed source file -> its watch folder */
+	TMap<FString, int32> PendingFiles;
+
+	double LastChangeTime = 0.0;
+
+	/** Content of the files imported this session, a file saved again unchanged is not re-imported */
+	TMap<FString, FMD5Hash> IngestedHashes;
+
+	/** Failed imports of a pending file, it is retried after the next settle delay until MaxImportAttempts */
+	TMap<FString, int32> ImportAttempts;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,94 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include <atomic>
+
+/**
+ * Non-modal background job run by USSVoiceCultureEditorSubsystem.
+ *
+ * A job is a list of phases executed in order:
+ * - Worker phases run once on the thread pool (registry queries, name parsing, matching, reports).
+ *   They must not touch UObjects other than reading native strategy rules.
+ * - Game thread phases are called every tick until they return true, and should do a small
+ *   amount of work per call (one asset). The subsystem calls them repeatedly within a frame budget.
+ *
+ * Cancellation is cooperative: phases check IsCancelRequested(), and no further phase starts once set.
+ */
+class SSVOICECULTUREEDITOR_API FSSVoiceCultureJob : public TSharedFromThis<FSSVoiceCultureJob>
+{
+public:
+	/** Worker phase body, run once off the game thread */
+	using FWorkerPhase = TFunction<void(FSSVoiceCultureJob& Job)>;
+
+	/** Game thread phase step, returns true once the phase is complete */
+	using FGameThreadStep = TFunction<bool(FSSVoiceCultureJob& Job)>;
+
+	/** Called on the game thread when the job is done (or cancelled) */
+	using FOnFinished = TFunction<void(bool bCancelled)>;
+
+	explicit FSSVoiceCultureJob(const FText& InTitle);
+
+	/** Appends a phase running on the thread pool. */
+	FSSVoiceCultureJob& AddWorkerPhase(const FText& Label, FWorkerPhase&& Work);
+
+	/** Appends a phase running on the game thread, time-sliced across ticks. */
+	FSSVoiceCultureJob& AddGameThreadPhase(const FText& Label, FGameThreadStep&& Step);
+
+	FSSVoiceCultureJob& OnFinished(FOnFinished&& Callback);
+
+	/** Requests cancellation, honored at the next phase step. Any thread. */
+	void Cancel() { bCancelRequested = true; }
+
+	bool IsCancelRequested() const { return bCancelRequested; }
+
+	/** Progress of the current phase in [0, 1], set by the phase itself. Any thread. */
+	void SetPhaseProgress(float InProgress) { PhaseProgress = FMath::Clamp(InProgress, 0.f, 1.f); }
+
+	/** Overall progress in [0, 1] */
+	float GetProgress() const;
+
+	const FText& GetTitle() const { return Title; }
+
+	/** Label of the running phase */
+	FText GetStatusText() const;
+
+	bool IsFinished() const { return bFinished; }
+
+	/**
+	 * Advances the job, called on the game thread by the subsystem.
+	 *
+	 * @param TimeBudgetSeconds  Time allowed for game thread steps during this call.
+	 * @return true once the job is finished.
+	 */
+	bool Tick(double TimeBudgetSeconds);
+
+private:
+	struct FPhase
+	{
+		FText Label;
+		FWorkerPhase Work;
+		FGameThreadStep Step;
+	};
+
+	void Finish();
+
+	FText Title;
+	TArray<FPhase> Phases;
+	FOnFinished FinishedCallback;
+
+	int32 CurrentPhase = 0;
+
+	/** Pending worker phase, the job must outlive it */
+	TFuture<void> WorkerFuture;
+
+	std::atomic<bool> bCancelRequested { false };
+	std::atomic<float> PhaseProgress { 0.f };
+	bool bFinished = false;
+};
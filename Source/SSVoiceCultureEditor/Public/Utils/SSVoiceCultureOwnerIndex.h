@@ -0,0 +1,57 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SSVoiceCultureEditorTypes.h"
+#include "AssetRegistry/AssetData.h"
+
+class IAssetRegistry;
+class USSVoiceCultureStrategy;
+
+/**
+ * Reverse lookup from a culture sound to the voice culture assets using it, built from the soft package
+ * dependencies of the voice assets in the registry. Never loads assets. The culture of each entry is parsed
+ * from the sound name by the strategy (empty when the name does not follow it).
+ */
+class SSVOICECULTUREEDITOR_API FSSVoiceCultureOwnerIndex
+{
+public:
+	/**
+	 * Rebuilds the index for the given voice assets. SoundAssets are the candidate culture sounds (every USoundBase);
+	 * dependency queries and name parsing are split into NumChunks parallel chunks.
+	 */
+	void Build(IAssetRegistry& AssetRegistry, const USSVoiceCultureStrategy* Strategy, const TArray<FAssetData>& VoiceAssets,
+	           const TArray<FAssetData>& SoundAssets, int32 NumChunks = 1);
+
+	/** Indexes (or re-indexes) one voice asset from its current registry dependencies. */
+	void AddVoiceAsset(IAssetRegistry& AssetRegistry, const USSVoiceCultureStrategy* Strategy, const FAssetData& VoiceAsset);
+
+	void RemoveVoiceAsset(FName VoicePackage);
+
+	/** Keeps the owners of a renamed sound until its voice assets are saved with the new path. */
+	void RenameSound(FName OldSoundPackage, const FAssetData& NewSound);
+
+	void RemoveSound(FName SoundPackage);
+
+	/** Owners of a culture sound package, or nullptr if no voice asset uses it. */
+	const TArray<FSSVoiceCultureSoundOwner>* Find(FName SoundPackage) const;
+
+	/** Number of indexed culture sounds */
+	int32 Num() const { return OwnersBySound.Num(); }
+
+	void Reset();
+
+private:
+	void Add(FName VoicePackage, TArray<FSSVoiceCultureSoundOwner>&& Owners);
+
+	/** Sound package -> voice assets using it */
+	TMap<FName, TArray<FSSVoiceCultureSoundOwner>> OwnersBySound;
+
+	/** Voice asset package -> its sound packages, to update one voice asset alone */
+	TMap<FName, TArray<FName>> SoundsByOwner;
+};
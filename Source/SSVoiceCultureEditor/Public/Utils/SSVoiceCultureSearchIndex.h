@@ -0,0 +1,108 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** What a search document stands for */
+enum class ESSVoiceSearchKind : uint8
+{
+	None = 0,
+	Actor = 1 << 0,
+	Line = 1 << 1,
+	Culture = 1 << 2,
+	All = Actor | Line | Culture
+};
+ENUM_CLASS_FLAGS(ESSVoiceSearchKind);
+
+/** One ranked search hit */
+struct FSSVoiceSearchResult
+{
+	ESSVoiceSearchKind Kind = ESSVoiceSearchKind::None;
+
+	/** Original text (actor name, line suffix or culture code) */
+	FString Text;
+
+	/** Voice asset of a line, empty for actors and cultures */
+	FSoftObjectPath AssetPath;
+
+	/** Higher is better, 1 for an exact match */
+	float Score = 0.f;
+};
+
+/**
+ * Trigram index for fuzzy search over voice actor names, line suffixes and culture codes.
+ *
+ * Every document is lowercased and padded ("  name ") before being split into trigrams, so one and
+ * two character queries still match prefixes. A query is ranked by trigram similarity
+ * (shared trigrams / query trigrams), with bonuses for prefix and substring matches, which tolerates typos and
+ * partial IDs. Only the posting lists of the query's trigrams are visited.
+ *
+ * Documents can be added and removed incrementally; removed documents are compacted lazily, which renumbers
+ * the ids. Search reuses scratch buffers and is meant to be called from one thread at a time.
+ */
+class SSVOICECULTUREEDITOR_API FSSVoiceCultureSearchIndex
+{
+public:
+	/** Adds a document and returns its id. */
+	int32 Add(ESSVoiceSearchKind Kind, const FString& Text, const FSoftObjectPath& AssetPath = FSoftObjectPath());
+
+	/** Removes a document by id (as returned by Add). */
+	void Remove(int32 DocumentId);
+
+	/**
+	 * Returns the best matches of Query, best first.
+	 *
+	 * @param Query       Text typed by the user (case-insensitive).
+	 * @param Kinds       Document kinds to return.
+	 * @param MaxResults  Maximum number of results.
+	 * @param MinScore    Results below this similarity are dropped (0 to 1).
+	 */
+	void Search(const FString& Query, ESSVoiceSearchKind Kinds, int32 MaxResults, TArray<FSSVoiceSearchResult>& OutResults,
+	            float MinScore = 0.2f) const;
+
+	/** Number of live documents */
+	int32 Num() const { return NumAlive; }
+
+	void Reset();
+
+	/**
+	 * Rebuilds the posting lists without removed documents if enough were removed.
+	 *
+	 * @param OutRemap  When compacted, old id -> new id (INDEX_NONE for removed documents). Ids kept by the
+	 *                  caller must be rewritten through it.
+	 * @return true if the documents were compacted.
+	 */
+	bool Compact(TArray<int32>& OutRemap);
+
+private:
+	struct FDocument
+	{
+		FString Text;
+		FString TextLower;
+		FSoftObjectPath AssetPath;
+		ESSVoiceSearchKind Kind = ESSVoiceSearchKind::None;
+		uint16 NumTrigrams = 0;
+		bool bAlive = true;
+	};
+
+	/** Distinct trigrams of a lowercase padded text */
+	static void ExtractTrigrams(const FString& TextLower, TArray<uint64>& OutTrigrams);
+
+	void IndexDocument(int32 DocumentId);
+
+	TArray<FDocument> Documents;
+
+	/** Trigram -> ids of the documents containing it */
+	TMap<uint64, TArray<int32>> Postings;
+
+	int32 NumAlive = 0;
+
+	/** Search scratch: shared trigram count per document, and the documents touched by the query */
+	mutable TArray<uint16> SharedCounts;
+	mutable TArray<int32> TouchedDocuments;
+};
@@ -0,0 +1,53 @@
+/**
+* Copyright (C) 2020-2025 Schartier Isaac
+*
+* Official Documentation: https://www.somndus-studio.com
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+class USSVoiceCultureStrategy;
+
+/**
+ * Lookup of culture sounds by line suffix and culture, built once from registry data.
+ *
+ * Replaces the per-asset linear scans over every USoundBase: matching a voice culture asset
+ * becomes a single map lookup. Building and querying never load assets, so both are worker-safe.
+ */
+class SSVOICECULTUREEDITOR_API FSSVoiceCultureSoundIndex
+{
+public:
+	/** One culture sound of a line */
+	struct FEntry
+	{
+		/** Lowercase culture code (e.g. "fr") */
+		FString Culture;
+		FAssetData Asset;
+	};
+
+	/**
+	 * Rebuilds the index from the given sounds using the strategy's naming rule.
+	 * Name parsing is split into NumChunks parallel chunks.
+	 */
+	void Build(const USSVoiceCultureStrategy& Strategy, const TArray<FAssetData>& SoundAssets, int32 NumChunks = 1);
+
+	/** Returns the sound matching the line suffix and culture, or nullptr. */
+	const FAssetData* Find(const FString& Suffix, const FString& Culture) const;
+
+	/** Returns all culture sounds of a line suffix, or nullptr if none. */
+	const TArray<FEntry>* FindLine(const FString& Suffix) const;
+
+	/** Number of indexed culture sounds */
+	int32 Num() const { return NumSounds; }
+
+	void Reset();
+
+private:
+	/** Culture sounds grouped by lowercase line suffix */
+	TMap<FString, TArray<FEntry>> SoundsBySuffix;
+
+	int32 NumSounds = 0;
+};
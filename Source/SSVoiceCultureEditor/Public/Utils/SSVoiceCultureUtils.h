@@ -9,24 +9,402 @@
 #include "CoreMinimal.h"
 #include "SSVoiceCultureSound.h"
 #include "SSVoiceCultureEditorTypes.h"
+#include "Utils/SSVoiceCultureJob.h"
+
+class USSVoiceCultureBank;
+class USSVoiceCultureLevelManifest;
+class USSVoiceCultureStrategy;
 
 class SSVOICECULTUREEDITOR_API FSSVoiceCultureUtils
 {
 public:
 
-	/** Save the given package to disk (compatible with UE4 and UE5) */
-	static bool SaveAsset(UPackage* Package, const FString& PackageFilename);
+	/** Save the given package to disk (compatible with UE4 and UE5). With bAsyncWrite, call UPackage::WaitForAsyncFileWrites() before relying on the file. */
+	static bool SaveAsset(UPackage* Package, const FString& PackageFilename, bool bAsyncWrite = false);
+
+	/** Saves all given packages with asynchronous file writes, then waits for the writes. Returns the number of saved packages. */
+	static int32 SavePackages(const TSet<UPackage*>& Packages);
+
+	/** Loads the packages of the given assets through async loading (parallel reads), returns once all are loaded. */
+	static void LoadAssetsParallel(TConstArrayView<FAssetData> Assets);
+
+	/** Loads the asset PackageName.AssetName, or creates it in a new package. nullptr if it exists with another class. */
+	static UObject* LoadOrCreateAsset(UClass* Class, const FString& PackageName, const FString& AssetName);
+
+	template <typename AssetType>
+	static AssetType* LoadOrCreateAsset(const FString& PackageName, const FString& AssetName)
+	{
+		return Cast<AssetType>(LoadOrCreateAsset(AssetType::StaticClass(), PackageName, AssetName));
+	}
 	
 	/** Fills the VoiceCultures array based on SoundBase assets following the naming convention: LVA_{lang}_{Suffix} */
 	static bool AutoPopulateFromNaming(USSVoiceCultureSound* TargetAsset, const bool bShowSlowTask = true, const bool bShowNotify = true);
 	
-	static bool AutoPopulateFromVoiceActor(const FString& VoiceActorName, bool bOnlyMissingCulture = true);
+	/** Limited to Cultures, the supported voice cultures of the settings when empty. */
+	static bool AutoPopulateFromVoiceActor(const FString& VoiceActorName, bool bOnlyMissingCulture = true,
+		const FSSVoiceCultureBatchOptions& Options = FSSVoiceCultureBatchOptions(), FSSVoiceCultureOperationStats* OutStats = nullptr,
+		const TArray<FString>& Cultures = TArray<FString>());
 	
 	static void GenerateCultureCoverageReport(FSSVoiceCultureReport& OutReport);
 
 	static bool LoadSavedCultureReport(FSSVoiceCultureReport& OutReport);
 	
-	static int32 AutoPopulateCulture(const FString& TargetCulture, bool bOverrideExisting);
+	static int32 AutoPopulateCulture(const FString& TargetCulture, bool bOverrideExisting,
+		const FSSVoiceCultureBatchOptions& Options = FSSVoiceCultureBatchOptions(), FSSVoiceCultureOperationStats* OutStats = nullptr);
+
+	/** Auto-populates every supported culture of every voice culture asset in one pass. Returns the number of modified assets. */
+	static int32 AutoPopulateAllCultures(bool bOverrideExisting,
+		const FSSVoiceCultureBatchOptions& Options = FSSVoiceCultureBatchOptions(), FSSVoiceCultureOperationStats* OutStats = nullptr);
 	
 	static void GenerateActorListJson();
+
+	/** Same as GenerateActorListJson, also returning the sorted actor names. */
+	static void GenerateActorListJson(TArray<FString>& OutActors);
+
+	/** Writes the actor names to Saved/SSVoiceCulture/VoiceActors.json. Worker-safe. */
+	static bool SaveActorListJson(const TArray<FString>& Actors);
+
+	// ------------------------
+	// Background jobs (see SSVoiceCultureUtils_Jobs.cpp), started with USSVoiceCultureEditorSubsystem::StartJob
+	// ------------------------
+
+	/** Non-modal version of AutoPopulateCulture. OnDone runs on the game thread once finished or cancelled. */
+	static TSharedRef<FSSVoiceCultureJob> MakeAutoPopulateCultureJob(const FString& TargetCulture, bool bOverrideExisting,
+	                                                                 FSSVoiceCultureJob::FOnFinished&& OnDone = nullptr);
+
+	/** Non-modal version of AutoPopulateFromVoiceActor. */
+	static TSharedRef<FSSVoiceCultureJob> MakeAutoPopulateFromVoiceActorJob(const FString& VoiceActorName,
+	                                                                        bool bOnlyMissingCulture = true,
+	                                                                        FSSVoiceCultureJob::FOnFinished&& OnDone = nullptr);
+
+	/** Non-modal version of GenerateActorListJson. */
+	static TSharedRef<FSSVoiceCultureJob> MakeRescanActorsJob(FSSVoiceCultureJob::FOnFinished&& OnDone = nullptr);
+
+	/** Non-modal version of GenerateCultureCoverageReport. OutReport must stay valid until OnDone. */
+	static TSharedRef<FSSVoiceCultureJob> MakeCoverageReportJob(const TSharedRef<FSSVoiceCultureReport>& OutReport,
+	                                                            FSSVoiceCultureJob::FOnFinished&& OnDone = nullptr);
+
+	/** Non-modal version of AnalyzeCultureLoudness on every voice asset, then fills and saves OutReport. */
+	static TSharedRef<FSSVoiceCultureJob> MakeLoudnessAnalysisJob(const TSharedRef<FSSVoiceCultureLoudnessReport>& OutReport,
+	                                                              FSSVoiceCultureJob::FOnFinished&& OnDone = nullptr);
+
+	// ------------------------
+	// Auto-populate plan (see SSVoiceCultureUtils_AutoPopulate.cpp)
+	// ------------------------
+
+	/**
+	 * Matches culture sounds for the given voice assets from registry data only (no loads).
+	 * Worker-safe: the strategy's name rules run in parallel, split into Options.NumWorkers chunks.
+	 *
+	 * @param Strategy           Active strategy providing the naming rules.
+	 * @param VoiceAssets        USSVoiceCultureSound registry entries to match.
+	 * @param SoundAssets        Candidate culture sounds (usually GetAllSoundBaseAssets()).
+	 * @param Cultures           Cultures to match. Empty matches every culture found for the line.
+	 * @param bOverrideExisting  If false, cultures already listed in the "VoiceCultures" tag are skipped.
+	 * @param Options            Worker count.
+	 * @param OutPlan            Voice assets with at least one matched culture sound.
+	 */
+	static void BuildAutoPopulatePlan(const USSVoiceCultureStrategy& Strategy, const TArray<FAssetData>& VoiceAssets,
+	                                  const TArray<FAssetData>& SoundAssets, const TArray<FString>& Cultures,
+	                                  bool bOverrideExisting, const FSSVoiceCultureBatchOptions& Options,
+	                                  TArray<FSSVoiceCultureAutoPopulateItem>& OutPlan);
+
+	/**
+	 * Applies one plan item on the game thread: loads the voice asset and writes its matched entries.
+	 * Culture sounds are assigned by soft path and are never loaded.
+	 *
+	 * @return true if the asset was modified (its package is then added to OutModifiedPackages).
+	 */
+	static bool ApplyAutoPopulateItem(const FSSVoiceCultureAutoPopulateItem& Item, bool bOverrideExisting,
+	                                  TSet<UPackage*>& OutModifiedPackages);
+
+	/**
+	 * Applies a whole plan on the game thread in batches of Options.BatchSize, saving each batch when
+	 * auto-save (or Options.bForceSave) is enabled. Returns the number of modified assets.
+	 */
+	static int32 ApplyAutoPopulatePlan(const TArray<FSSVoiceCultureAutoPopulateItem>& Plan, bool bOverrideExisting,
+	                                   const FSSVoiceCultureBatchOptions& Options, FSSVoiceCultureOperationStats& Stats);
+
+	/**
+	 * Game-thread fallback for strategies whose rules need loaded assets (Blueprint subclasses): runs
+	 * ExecuteOptimizedOneCultureAutoPopulateInAsset for each culture of one voice asset.
+	 *
+	 * @return true if the asset was modified (its package is then added to OutModifiedPackages).
+	 */
+	static bool ApplyStrategyAutoPopulate(const USSVoiceCultureStrategy& Strategy, USSVoiceCultureSound* Asset,
+	                                      const TArray<FString>& Cultures, bool bOverrideExisting,
+	                                      const TArray<FAssetData>& SoundAssets, TSet<UPackage*>& OutModifiedPackages);
+
+	/**
+	 * Per-asset fallback of BuildAutoPopulatePlan + ApplyAutoPopulatePlan for non-native strategies.
+	 * Voice assets already tagged with every culture are skipped unless overriding, the rest are loaded
+	 * and saved in batches of Options.BatchSize. Returns the number of modified assets.
+	 */
+	static int32 RunStrategyAutoPopulate(const USSVoiceCultureStrategy& Strategy, const TArray<FAssetData>& VoiceAssets,
+	                                     const TArray<FString>& Cultures, bool bOverrideExisting,
+	                                     const FSSVoiceCultureBatchOptions& Options, FSSVoiceCultureOperationStats& Stats);
+
+	/** Returns the lowercase cultures listed in the "VoiceCultures" registry tag of a voice asset. */
+	static TSet<FString> GetTaggedCultures(const FAssetData& VoiceAsset);
+
+	/**
+	 * Lowercase culture -> sound object path from the "VoiceCultureSounds" registry tag of a voice asset.
+	 * Returns false if the asset was saved before the tag existed. Worker-safe.
+	 */
+	static bool GetTaggedCultureSounds(const FAssetData& VoiceAsset, TMap<FString, FString>& OutSounds);
+
+	// ------------------------
+	// Level manifest (see SSVoiceCultureUtils_LevelManifest.cpp)
+	// ------------------------
+
+	/** Default object path of the generated level manifest when none is set in the settings. */
+	static const TCHAR* DefaultLevelManifestPath;
+
+	/**
+	 * Finds the voice culture assets each map references through hard package dependencies (registry only,
+	 * maps are never loaded; World Partition external actors count for their map), then fills the manifest
+	 * with their culture sounds. Sublevels are maps of their own so each gets its own entry.
+	 *
+	 * @param MapPackages  Long package names of the maps to scan, every /Game map when empty.
+	 * @param Manifest     Manifest to fill (previous content is replaced).
+	 * @param OutStats     Maps scanned, levels with voice, voice assets referenced and timings.
+	 */
+	static void BuildLevelManifest(const TArray<FString>& MapPackages, USSVoiceCultureLevelManifest& Manifest,
+	                               FSSVoiceCultureOperationStats& OutStats);
+
+	/**
+	 * Builds the manifest at ManifestObjectPath (created if missing) and saves it unless bSave is false.
+	 * Returns nullptr if the path is not a valid asset path.
+	 */
+	static USSVoiceCultureLevelManifest* GenerateLevelManifest(const FString& ManifestObjectPath,
+	                                                           const TArray<FString>& MapPackages, bool bSave,
+	                                                           FSSVoiceCultureOperationStats& OutStats);
+
+	// ------------------------
+	// Voice banks (see SSVoiceCultureUtils_Bank.cpp)
+	// ------------------------
+
+	/**
+	 * Packs the given voice assets into a bank: one chunk package per culture (<Bank>_<culture>) holding a copy
+	 * of every line's culture sound, then redirects the voice assets to the bank. Culture sounds are loaded.
+	 * Lines and cultures dropped since the previous build are released: their voice assets no longer redirect
+	 * to the bank and their chunks are deleted.
+	 *
+	 * @param BankObjectPath  Bank to create or rebuild (e.g. /Game/Dialogue/VB_Scene01.VB_Scene01).
+	 * @param VoiceAssets     Lines of the bank, the bank's SourceLines when empty (rebuild).
+	 * @param bSave           Save the bank, its chunks and the redirected voice assets.
+	 * @param OutStats        Lines scanned, culture sounds packed, voice assets redirected, packages saved.
+	 * @return The bank, nullptr if the path is invalid or there is nothing to pack.
+	 */
+	static USSVoiceCultureBank* BuildVoiceBank(const FString& BankObjectPath, const TArray<FAssetData>& VoiceAssets,
+	                                           bool bSave, FSSVoiceCultureOperationStats& OutStats);
+
+	// ------------------------
+	// Migration to tables and banks (see SSVoiceCultureUtils_Migration.cpp)
+	// ------------------------
+
+	/** Default target of a migrated folder: <Folder>/VT_<FolderName> for a table, <Folder>/VB_<FolderName> for a bank. */
+	static FString GetDefaultMigrationTarget(const FString& Folder, ESSVoiceCultureMigrationFormat Format);
+
+	/**
+	 * Migrates the voice assets under the given folders (recursive). Voice assets stay in place so every existing
+	 * reference keeps working:
+	 * - Table: one row per voice asset (line ID = asset name) in a single table, then each voice asset is emptied
+	 *   and redirected to its row. The table is saved before any voice asset is modified.
+	 * - Bank: one bank per folder (see BuildVoiceBank).
+	 * Voice assets are read in batches of Options.BatchSize, each batch loaded through async loading; culture
+	 * sounds are never loaded for a table. Assets with no culture, or already in a table or bank, are skipped.
+	 *
+	 * @param Folders           Long package paths (e.g. /Game/Dialogue/Chapter1).
+	 * @param TargetObjectPath  Table to create or extend, GetDefaultMigrationTarget(Folders[0]) when empty. Unused for banks.
+	 * @param Options           BatchSize, bForceSave (saves the targets and the voice assets), bCollectGarbageBetweenBatches, bInteractive.
+	 * @param OutReport         Targets written, migrated and skipped assets, stats.
+	 * @return false on invalid arguments or if the table could not be saved.
+	 */
+	static bool MigrateVoiceFolders(const TArray<FString>& Folders, ESSVoiceCultureMigrationFormat Format,
+	                                const FString& TargetObjectPath, const FSSVoiceCultureBatchOptions& Options,
+	                                FSSVoiceCultureMigrationReport& OutReport);
+
+	/** Writes the report to Saved/SSVoiceCulture/MigrationReport.json. */
+	static bool SaveMigrationReport(const FSSVoiceCultureMigrationReport& Report);
+
+	// ------------------------
+	// Duplicate culture sounds (see SSVoiceCultureUtils_Dedup.cpp)
+	// ------------------------
+
+	/**
+	 * Hashes the PCM data of every sound wave referenced by a voice asset or table column (registry soft references,
+	 * no voice asset is loaded) and groups identical ones. Waves are loaded in batches of Options.BatchSize and
+	 * hashed on worker threads; hashes are cached in Saved/SSVoiceCulture/PcmHashCache.bin by package saved hash,
+	 * so unchanged sounds are not loaded again. Only bit-exact PCM (same format) is considered a duplicate.
+	 */
+	static void FindDuplicateCultureSounds(const FSSVoiceCultureBatchOptions& Options, FSSVoiceCultureDedupReport& OutReport);
+
+	/**
+	 * Points every reference to a duplicate at its cluster's canonical sound (voice asset entries and table columns).
+	 * Duplicates themselves are not deleted. Saves when Options.bForceSave is set. Returns the number of modified assets.
+	 */
+	static int32 ApplyDuplicateClusters(const TArray<FSSVoiceCultureDuplicateCluster>& Clusters,
+	                                    const FSSVoiceCultureBatchOptions& Options, FSSVoiceCultureOperationStats& OutStats);
+
+	/** Writes the report to Saved/SSVoiceCulture/DuplicateSounds.json. */
+	static bool SaveDedupReport(const FSSVoiceCultureDedupReport& Report);
+
+	// ------------------------
+	// Loudness and silence (see SSVoiceCultureUtils_Loudness.cpp)
+	// ------------------------
+
+	/**
+	 * Decodes every culture sound wave of the given voice assets and stores its integrated loudness, peak and
+	 * leading/trailing silence in the voice asset (CultureAnalysis, "VoiceLoudness" registry tag). Voice assets and
+	 * their sounds are loaded in batches of Options.BatchSize and measured on worker threads. Only 16-bit PCM sources
+	 * are measured; lines migrated to a voice table have no culture entry and are skipped. Saves when Options.bForceSave is set.
+	 */
+	static void AnalyzeCultureLoudness(const TArray<FAssetData>& VoiceAssets, const FSSVoiceCultureBatchOptions& Options,
+	                                   FSSVoiceCultureOperationStats& OutStats);
+
+	/** One batch of AnalyzeCultureLoudness, modified voice asset packages are added to OutModifiedPackages. Returns the number of sounds measured. */
+	static int32 AnalyzeCultureLoudnessBatch(TConstArrayView<FAssetData> VoiceAssets, TSet<UPackage*>& OutModifiedPackages);
+
+	/** Last analysis of a voice asset: the loaded asset if any, else its "VoiceLoudness" tag. Game thread. */
+	static TArray<FSSCultureSoundAnalysis> GetTaggedAnalysis(const FAssetData& VoiceAsset);
+
+	/**
+	 * Compares each culture to the reference culture of the editor settings, line by line, and sums the silence
+	 * trimming would remove. Reads the last analysis of each voice asset, nothing is loaded.
+	 */
+	static void BuildLoudnessReport(const TArray<FAssetData>& VoiceAssets, FSSVoiceCultureLoudnessReport& OutReport);
+
+	/**
+	 * Cuts the leading/trailing silence of the culture sounds of the given voice assets down to the editor settings'
+	 * TrimPaddingSeconds, based on their last analysis. The wave source is replaced and its compressed data rebuilt;
+	 * cue points and markers are not moved. Returns the number of culture sounds trimmed.
+	 */
+	static int32 TrimCultureSilence(const TArray<FAssetData>& VoiceAssets, const FSSVoiceCultureBatchOptions& Options,
+	                                FSSVoiceCultureOperationStats& OutStats);
+
+	/** Writes the report to Saved/SSVoiceCulture/LoudnessReport.json. */
+	static bool SaveLoudnessReport(const FSSVoiceCultureLoudnessReport& Report);
+
+	static bool LoadSavedLoudnessReport(FSSVoiceCultureLoudnessReport& OutReport);
+
+	// ------------------------
+	// Duration mismatches (see SSVoiceCultureUtils_Duration.cpp)
+	// ------------------------
+
+	/**
+	 * Finds the culture sounds whose duration is more than MaxRatio times longer or shorter than the reference
+	 * culture's for the same line, from the "VoiceDurations" registry tag only (nothing is loaded). Lines without
+	 * a reference culture duration are ignored. Worker-safe, split into Options.NumWorkers chunks.
+	 * OutMismatches is sorted by ratio, most off first.
+	 */
+	static void FindDurationMismatches(const TArray<FAssetData>& VoiceAssets, const FString& ReferenceCulture, float MaxRatio,
+	                                   const FSSVoiceCultureBatchOptions& Options,
+	                                   TArray<FSSVoiceCultureDurationMismatch>& OutMismatches);
+
+	// ------------------------
+	// Culture audio profiles (see SSVoiceCultureUtils_AudioProfiles.cpp)
+	// ------------------------
+
+	/**
+	 * Applies the editor settings' CultureAudioProfiles (compression quality, loading behavior, sample rate by
+	 * duration) to every sound wave referenced by a voice asset or voice table column. Voice assets are read from
+	 * their "VoiceCultureSounds" registry tag (only untagged ones are loaded), waves are loaded in batches of
+	 * Options.BatchSize, GC runs between batches. Nothing is compressed to measure sizes: the size before is the
+	 * running platform's compressed data when already built, the size after an estimate from the platform sample
+	 * rates and the compression quality. When bApply is false nothing is modified and OutReport only counts the
+	 * sounds that would change. Saves when Options.bForceSave is set.
+	 */
+	static void ApplyCultureAudioProfiles(bool bApply, const FSSVoiceCultureBatchOptions& Options,
+	                                      FSSVoiceCultureAudioProfileReport& OutReport);
+
+	/** Writes the report to Saved/SSVoiceCulture/AudioProfileReport.json. */
+	static bool SaveAudioProfileReport(const FSSVoiceCultureAudioProfileReport& Report);
+
+	// ------------------------
+	// Orphan culture sounds (see SSVoiceCultureUtils_Orphans.cpp)
+	// ------------------------
+
+	/**
+	 * Finds the sounds following the strategy's culture naming that no voice asset, table column or bank chunk
+	 * references, from the registry dependency graph only (nothing is loaded). Referencers are queried in
+	 * Options.NumWorkers parallel chunks; the strategy must be native (ParseCultureSoundAsset runs on workers).
+	 * OutReport is sorted by disk size, biggest first.
+	 */
+	static void FindOrphanCultureSounds(const USSVoiceCultureStrategy& Strategy, const FSSVoiceCultureBatchOptions& Options,
+	                                    FSSVoiceCultureOrphanReport& OutReport);
+
+	/** Deletes the given sounds in batches of Options.BatchSize, without confirmation. Returns the number of assets deleted. */
+	static int32 DeleteOrphanCultureSounds(const TArray<FSSVoiceCultureOrphanSound>& Orphans, const FSSVoiceCultureBatchOptions& Options);
+
+	/**
+	 * Moves the given sounds to TargetFolder/<culture> in batches of Options.BatchSize, leaving redirectors for other
+	 * referencers. Saves when Options.bForceSave is set. Returns the number of assets moved.
+	 */
+	static int32 MoveOrphanCultureSounds(const TArray<FSSVoiceCultureOrphanSound>& Orphans, const FString& TargetFolder,
+	                                     const FSSVoiceCultureBatchOptions& Options);
+
+	/** Writes the report to Saved/SSVoiceCulture/OrphanSounds.json. */
+	static bool SaveOrphanReport(const FSSVoiceCultureOrphanReport& Report);
+
+	// ------------------------
+	// Culture code rename (see SSVoiceCultureUtils_CultureRename.cpp)
+	// ------------------------
+
+	/**
+	 * Renames culture codes (e.g. "jp" -> "ja") everywhere: voice asset entries and analysis, voice table and bank
+	 * cultures, then the runtime settings (SupportedVoiceCultures, CurrentLanguage, PreviewLanguage) and the editor
+	 * settings in one config write. Voice assets are found from their "VoiceCultures" tag, only affected ones are
+	 * loaded, in batches of Options.BatchSize. An entry whose new code already exists in the same asset is left as is
+	 * and reported as a conflict. Old codes match case-insensitively. Saves when Options.bForceSave is set.
+	 *
+	 * @return false on invalid renames or when cancelled (settings are then left unchanged).
+	 */
+	static bool RenameCultureCodes(const TMap<FString, FString>& Renames, const FSSVoiceCultureBatchOptions& Options,
+	                               FSSVoiceCultureRenameReport& OutReport);
+
+	/** Writes the report to Saved/SSVoiceCulture/CultureRename.json. */
+	static bool SaveCultureRenameReport(const FSSVoiceCultureRenameReport& Report);
+
+	// ------------------------
+	// Vendor mappings export / import (see SSVoiceCultureUtils_Mappings.cpp)
+	// ------------------------
+
+	/**
+	 * Streams one row per voice asset (line ID, asset path, actor, suffix, then sound path and status of each culture)
+	 * to a CSV file, or a JSON Lines file when the extension is .json/.jsonl. Registry data only (the
+	 * "VoiceCultureSounds" tag, else the voice asset's dependencies named after a culture), written Options.BatchSize
+	 * rows at a time. Status is "ok", "missing" (no sound) or "broken" (sound not in the registry).
+	 */
+	static bool ExportVoiceCultureMappings(const FString& FilePath, const FSSVoiceCultureBatchOptions& Options,
+	                                       FSSVoiceCultureOperationStats& OutStats);
+
+	/**
+	 * Streams a vendor mapping file in the export format (UTF-8, read in fixed-size chunks, CSV quoted fields may span
+	 * lines) record by record, and validates Options.BatchSize rows at a time
+	 * in parallel against the registry (voice asset by Asset path or LineId, sound paths, supported cultures).
+	 * When bApply is set, valid cells are written to the voice assets of the batch (batched loads, saves when
+	 * Options.bForceSave is set, GC between batches). Empty cells and status columns are ignored, entries are never removed.
+	 */
+	static bool ImportVoiceCultureMappings(const FString& FilePath, bool bApply, const FSSVoiceCultureBatchOptions& Options,
+	                                       FSSVoiceCultureMappingImportReport& OutReport);
+
+	/** Writes the report to Saved/SSVoiceCulture/MappingImport.json. */
+	static bool SaveMappingImportReport(const FSSVoiceCultureMappingImportReport& Report);
+
+	// ------------------------
+	// Wrapper creation (see SSVoiceCultureUtils_Wrappers.cpp)
+	// ------------------------
+
+	/**
+	 * Groups the culture sounds of the registry by the line suffix the strategy parses (supported cultures only) and
+	 * creates a voice culture asset in TargetPath for every suffix without one, named by Strategy.BuildVoiceAssetName.
+	 * Entries are filled from the sounds' soft paths, no sound is loaded. Saved in batches of Options.BatchSize
+	 * when Options.bForceSave is set. The strategy is called from worker threads.
+	 */
+	static bool CreateMissingVoiceCultureWrappers(const USSVoiceCultureStrategy& Strategy, const FString& TargetPath, bool bApply,
+	                                              const FSSVoiceCultureBatchOptions& Options, FSSVoiceCultureWrapperReport& OutReport);
+
+	/** Writes the report to Saved/SSVoiceCulture/WrapperCreation.json. */
+	static bool SaveWrapperReport(const FSSVoiceCultureWrapperReport& Report);
 };
@@ -37,6 +37,7 @@ public class SSVoiceCultureEditor : ModuleRules
                 "JsonUtilities", "Json", "WorkspaceMenuStructure",
                 "ContentBrowser",
                 "ContentBrowserData",
+                "DirectoryWatcher",
             }
         );
     }